@@ -1,115 +1,70 @@
-unsigned char boost_txt[] = {
-  0x42, 0x6f, 0x6f, 0x73, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x2d,
-  0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x30,
-  0x20, 0x2d, 0x20, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x20, 0x31, 0x37,
-  0x74, 0x68, 0x2c, 0x20, 0x32, 0x30, 0x30, 0x33, 0x0a, 0x0a, 0x50, 0x65,
-  0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20,
-  0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74,
-  0x65, 0x64, 0x2c, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6f, 0x66, 0x20,
-  0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x20, 0x6f, 0x72,
-  0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x0a, 0x6f, 0x62, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20,
-  0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79,
-  0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x22,
-  0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x29, 0x20, 0x74,
-  0x6f, 0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f,
-  0x64, 0x75, 0x63, 0x65, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
-  0x79, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x65, 0x2c, 0x0a, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72,
-  0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70,
-  0x65, 0x72, 0x6d, 0x69, 0x74, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x2d,
-  0x70, 0x61, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x77,
-  0x68, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74,
-  0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x75, 0x72, 0x6e,
-  0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x0a, 0x64, 0x6f, 0x20,
-  0x73, 0x6f, 0x2c, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x73, 0x75, 0x62, 0x6a,
-  0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
-  0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a, 0x0a, 0x0a, 0x54,
-  0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65, 0x6e,
-  0x74, 0x69, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e,
-  0x67, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20,
-  0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x67, 0x72, 0x61, 0x6e,
-  0x74, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74,
-  0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e,
-  0x67, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x72,
-  0x2c, 0x0a, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c,
-  0x6c, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x2c, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x6f,
-  0x72, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x0a, 0x61, 0x6c, 0x6c, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77,
-  0x61, 0x72, 0x65, 0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20,
-  0x6f, 0x72, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x0a, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
-  0x73, 0x6f, 0x6c, 0x65, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61,
-  0x63, 0x68, 0x69, 0x6e, 0x65, 0x2d, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x0a, 0x61, 0x20, 0x73, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
-  0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x2e, 0x0a, 0x0a,
-  0x54, 0x48, 0x45, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45,
-  0x20, 0x49, 0x53, 0x20, 0x50, 0x52, 0x4f, 0x56, 0x49, 0x44, 0x45, 0x44,
-  0x20, 0x22, 0x41, 0x53, 0x20, 0x49, 0x53, 0x22, 0x2c, 0x20, 0x57, 0x49,
-  0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e,
-  0x54, 0x59, 0x20, 0x4f, 0x46, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x4b, 0x49,
-  0x4e, 0x44, 0x2c, 0x20, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20,
-  0x4f, 0x52, 0x0a, 0x49, 0x4d, 0x50, 0x4c, 0x49, 0x45, 0x44, 0x2c, 0x20,
-  0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20, 0x42, 0x55,
-  0x54, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x45,
-  0x44, 0x20, 0x54, 0x4f, 0x20, 0x54, 0x48, 0x45, 0x20, 0x57, 0x41, 0x52,
-  0x52, 0x41, 0x4e, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4f, 0x46, 0x20, 0x4d,
-  0x45, 0x52, 0x43, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49,
-  0x54, 0x59, 0x2c, 0x0a, 0x46, 0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20,
-  0x46, 0x4f, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43,
-  0x55, 0x4c, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f, 0x53, 0x45,
-  0x2c, 0x20, 0x54, 0x49, 0x54, 0x4c, 0x45, 0x20, 0x41, 0x4e, 0x44, 0x20,
-  0x4e, 0x4f, 0x4e, 0x2d, 0x49, 0x4e, 0x46, 0x52, 0x49, 0x4e, 0x47, 0x45,
-  0x4d, 0x45, 0x4e, 0x54, 0x2e, 0x20, 0x49, 0x4e, 0x20, 0x4e, 0x4f, 0x20,
-  0x45, 0x56, 0x45, 0x4e, 0x54, 0x0a, 0x53, 0x48, 0x41, 0x4c, 0x4c, 0x20,
-  0x54, 0x48, 0x45, 0x20, 0x43, 0x4f, 0x50, 0x59, 0x52, 0x49, 0x47, 0x48,
-  0x54, 0x20, 0x48, 0x4f, 0x4c, 0x44, 0x45, 0x52, 0x53, 0x20, 0x4f, 0x52,
-  0x20, 0x41, 0x4e, 0x59, 0x4f, 0x4e, 0x45, 0x20, 0x44, 0x49, 0x53, 0x54,
-  0x52, 0x49, 0x42, 0x55, 0x54, 0x49, 0x4e, 0x47, 0x20, 0x54, 0x48, 0x45,
-  0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x42, 0x45,
-  0x20, 0x4c, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x0a, 0x46, 0x4f, 0x52, 0x20,
-  0x41, 0x4e, 0x59, 0x20, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x53, 0x20,
-  0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x20, 0x4c, 0x49, 0x41,
-  0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x2c, 0x20, 0x57, 0x48, 0x45, 0x54,
-  0x48, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x52,
-  0x41, 0x43, 0x54, 0x2c, 0x20, 0x54, 0x4f, 0x52, 0x54, 0x20, 0x4f, 0x52,
-  0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x57, 0x49, 0x53, 0x45, 0x2c, 0x0a,
-  0x41, 0x52, 0x49, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x46, 0x52, 0x4f, 0x4d,
-  0x2c, 0x20, 0x4f, 0x55, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x4f, 0x52, 0x20,
-  0x49, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x49, 0x4f,
-  0x4e, 0x20, 0x57, 0x49, 0x54, 0x48, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53,
-  0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x54,
-  0x48, 0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x4f, 0x54,
-  0x48, 0x45, 0x52, 0x0a, 0x44, 0x45, 0x41, 0x4c, 0x49, 0x4e, 0x47, 0x53,
-  0x20, 0x49, 0x4e, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4f, 0x46, 0x54,
-  0x57, 0x41, 0x52, 0x45, 0x2e, 0x0a
+// NOTE compressed copy of txt/boost.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char boost_txt[] = {
+  0x00, 0x00, 0x05, 0x3a, 0x78, 0xda, 0x75, 0x92, 0xc1, 0x6e, 0xeb, 0x36,
+  0x10, 0x45, 0xf7, 0xfc, 0x8a, 0x41, 0x56, 0x7d, 0x80, 0x12, 0xe4, 0xbd,
+  0x2e, 0x0a, 0x74, 0x27, 0x5b, 0x74, 0x4c, 0x54, 0x16, 0x0d, 0x8a, 0x4e,
+  0x9a, 0x25, 0x2d, 0xd1, 0x16, 0x5b, 0x49, 0x34, 0x48, 0x2a, 0xa9, 0xfb,
+  0xf5, 0x9d, 0x91, 0xed, 0x34, 0x41, 0x51, 0x40, 0x0b, 0x92, 0x9a, 0x7b,
+  0xe7, 0xce, 0x21, 0x17, 0xde, 0xc7, 0x04, 0xb5, 0x3f, 0xa4, 0x77, 0x13,
+  0x2c, 0x94, 0xae, 0xb1, 0x63, 0xb4, 0x70, 0x0f, 0xcf, 0x36, 0x44, 0xe7,
+  0x47, 0xf8, 0xfe, 0xf0, 0x88, 0xbb, 0x7c, 0x3a, 0x4e, 0x58, 0xf7, 0xfd,
+  0x97, 0xd4, 0x65, 0xf0, 0xe3, 0xf1, 0xf1, 0x67, 0xc6, 0xb6, 0x36, 0x0c,
+  0x2e, 0xce, 0x35, 0x2e, 0x42, 0x67, 0x83, 0xdd, 0x9f, 0xe1, 0x18, 0xcc,
+  0x98, 0x6c, 0x9b, 0xc1, 0x21, 0x58, 0x0b, 0xfe, 0x00, 0x4d, 0x67, 0xc2,
+  0xd1, 0x66, 0x90, 0x3c, 0x98, 0xf1, 0x0c, 0x27, 0x74, 0x45, 0x81, 0x0f,
+  0xf8, 0x1d, 0xcd, 0xe8, 0xfe, 0x36, 0x09, 0x0d, 0x98, 0xdf, 0x27, 0xe3,
+  0x46, 0x37, 0x1e, 0xc1, 0x40, 0xe3, 0x4f, 0x67, 0x52, 0xa6, 0xce, 0x42,
+  0xbc, 0xe5, 0x32, 0x63, 0x0b, 0xa6, 0x69, 0xfc, 0x70, 0x42, 0x17, 0xaa,
+  0x6b, 0x7d, 0x33, 0x0d, 0x76, 0x4c, 0xb3, 0x1e, 0x35, 0x6f, 0xd8, 0xbf,
+  0x85, 0xfd, 0x99, 0xa5, 0x0e, 0xd3, 0xf4, 0xd7, 0x31, 0x7e, 0x22, 0x93,
+  0xbb, 0xdb, 0x74, 0x77, 0xdf, 0x28, 0xc6, 0x14, 0x31, 0x4e, 0xb0, 0xa7,
+  0xe0, 0xdb, 0xa9, 0xc1, 0x65, 0xeb, 0xe2, 0xa9, 0x37, 0xe7, 0x79, 0x91,
+  0x82, 0xdb, 0x4f, 0xc9, 0x66, 0xcc, 0xfe, 0x65, 0x1b, 0x5a, 0xcc, 0x8d,
+  0x13, 0x0e, 0x15, 0x07, 0x97, 0xe6, 0x48, 0x37, 0xb3, 0xeb, 0x2f, 0x0f,
+  0x27, 0xf4, 0xa2, 0x88, 0xad, 0x0d, 0xee, 0x0d, 0xe3, 0xbc, 0x59, 0x78,
+  0xf7, 0xe1, 0xcf, 0x78, 0x9d, 0x81, 0xfd, 0x57, 0x40, 0xe0, 0xc8, 0xcc,
+  0x85, 0xf6, 0x1e, 0xa5, 0xc9, 0xd9, 0x48, 0xe7, 0xef, 0x9d, 0x1f, 0xbe,
+  0xb4, 0x20, 0xae, 0x87, 0x29, 0x8c, 0x2e, 0x76, 0x96, 0x94, 0xac, 0xf5,
+  0x48, 0x04, 0x7d, 0xfa, 0x1e, 0xe2, 0xb4, 0xff, 0xc3, 0x36, 0x89, 0x74,
+  0x24, 0x39, 0xf8, 0xbe, 0xf7, 0xef, 0x08, 0xe6, 0x57, 0xc6, 0x34, 0xee,
+  0x09, 0x62, 0x70, 0xc7, 0x2e, 0xc1, 0xe8, 0x13, 0xc2, 0x88, 0xe0, 0xc6,
+  0xaf, 0xde, 0x73, 0x18, 0x62, 0x85, 0x10, 0x1d, 0xee, 0x23, 0xa2, 0xb4,
+  0x44, 0x34, 0xc3, 0xd2, 0xa6, 0x9f, 0x5a, 0x34, 0x63, 0xa4, 0x30, 0x7b,
+  0x84, 0xfb, 0x41, 0x74, 0xbe, 0xe0, 0xec, 0xa2, 0x0c, 0x96, 0x80, 0x35,
+  0xf3, 0x0d, 0x5c, 0xec, 0x3e, 0x05, 0x21, 0x9c, 0x4d, 0x6f, 0xdc, 0x60,
+  0x43, 0xc6, 0x06, 0x7a, 0x3c, 0x7b, 0x7b, 0x75, 0xc6, 0x61, 0x30, 0x0d,
+  0x4d, 0x81, 0x31, 0x69, 0xf8, 0xeb, 0x6d, 0xff, 0x4b, 0x0a, 0x7f, 0x23,
+  0x8d, 0xde, 0xd2, 0x43, 0xc1, 0x35, 0x41, 0x9a, 0xf1, 0x31, 0x12, 0xfd,
+  0x0f, 0xe8, 0x4f, 0xf2, 0x69, 0xec, 0x6d, 0x8c, 0xc8, 0xa8, 0xe9, 0x3e,
+  0x5a, 0x84, 0x4f, 0x3a, 0x76, 0xd1, 0x11, 0x86, 0x88, 0x5d, 0xfa, 0xf3,
+  0x8d, 0xce, 0xc1, 0x87, 0x81, 0xec, 0x06, 0xd3, 0x74, 0x6e, 0xb4, 0xf7,
+  0x97, 0x67, 0x60, 0xf6, 0x94, 0xe4, 0xc2, 0xbb, 0xf1, 0x2d, 0x42, 0xb0,
+  0xa3, 0x0d, 0x88, 0x6b, 0x7e, 0x70, 0x06, 0x3d, 0xa6, 0xd0, 0x20, 0x22,
+  0x33, 0x1e, 0x27, 0x73, 0xb4, 0xf8, 0x22, 0x3c, 0x12, 0x8f, 0x3e, 0x3c,
+  0xe0, 0x65, 0xac, 0x39, 0xd4, 0x72, 0xa5, 0x5f, 0x72, 0xc5, 0x41, 0xd4,
+  0xb0, 0x55, 0xf2, 0x59, 0x14, 0xbc, 0x80, 0xbb, 0xbc, 0xc6, 0xfd, 0x5d,
+  0x06, 0x2f, 0x42, 0xaf, 0xe5, 0x4e, 0x03, 0x56, 0xa8, 0xbc, 0xd2, 0xaf,
+  0x20, 0x57, 0x90, 0x57, 0xaf, 0xf0, 0x9b, 0xa8, 0x8a, 0x0c, 0xf8, 0xef,
+  0x5b, 0xc5, 0xeb, 0x1a, 0xa4, 0x62, 0x62, 0xb3, 0x2d, 0x05, 0xc7, 0x33,
+  0x51, 0x2d, 0xcb, 0x5d, 0x21, 0xaa, 0x27, 0x58, 0xa0, 0xae, 0x92, 0x1a,
+  0x4a, 0xb1, 0x11, 0x1a, 0x4d, 0xb5, 0x04, 0x6a, 0x78, 0xb5, 0x12, 0xbc,
+  0x26, 0xb3, 0x0d, 0x57, 0xcb, 0x35, 0x6e, 0xf3, 0x85, 0x28, 0x85, 0x7e,
+  0xcd, 0xd8, 0x4a, 0xe8, 0x8a, 0x3c, 0x57, 0x52, 0x41, 0x0e, 0xdb, 0x5c,
+  0x69, 0xb1, 0xdc, 0x95, 0xb9, 0x82, 0xed, 0x4e, 0x6d, 0x65, 0xcd, 0x33,
+  0xd0, 0x42, 0x97, 0x1c, 0x53, 0x14, 0xe8, 0x5e, 0xdd, 0x8b, 0x6a, 0xa5,
+  0xb0, 0x1b, 0xdf, 0xf0, 0x4a, 0x3f, 0x60, 0x77, 0x3c, 0x04, 0xfe, 0x8c,
+  0x1b, 0x56, 0xaf, 0xf3, 0xb2, 0x9c, 0x5b, 0x2e, 0xe5, 0xf6, 0x55, 0x89,
+  0xa7, 0xb5, 0x86, 0xb5, 0x2c, 0x0b, 0xae, 0x28, 0x31, 0x8d, 0x21, 0x2b,
+  0x0e, 0x85, 0xa8, 0xb5, 0x12, 0x98, 0x95, 0x22, 0x7f, 0x01, 0xb2, 0xe0,
+  0x18, 0x3d, 0x5f, 0x94, 0x9c, 0xad, 0x2e, 0xe5, 0x50, 0xe4, 0x9b, 0xfc,
+  0x89, 0xcf, 0x6a, 0x89, 0xa5, 0x6a, 0xfe, 0x7f, 0xc9, 0x0d, 0x2f, 0x6b,
+  0x3e, 0x1f, 0x61, 0x82, 0xa5, 0xac, 0xb4, 0xca, 0x97, 0x1a, 0xa3, 0x4a,
+  0xa5, 0x3f, 0xaa, 0x5f, 0x04, 0xa6, 0x67, 0xb9, 0x12, 0x35, 0xb5, 0x5a,
+  0x29, 0xb9, 0xc9, 0x80, 0xd8, 0x22, 0x05, 0x79, 0xd3, 0x55, 0x7c, 0xa9,
+  0x85, 0xac, 0x66, 0xee, 0x5f, 0xd3, 0x60, 0x09, 0xed, 0x77, 0x35, 0xff,
+  0x30, 0x64, 0x05, 0xcf, 0x4b, 0xf4, 0xaa, 0x49, 0xfc, 0xb9, 0xf8, 0x81,
+  0xfd, 0x03, 0x50, 0x44, 0xb4, 0xd0
 };
-unsigned int boost_txt_len = 1338;
+static constexpr unsigned int boost_txt_len = 762;
@@ -1,712 +1,248 @@
-unsigned char libzmq_txt[] = {
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x45, 0x53,
-  0x53, 0x45, 0x52, 0x20, 0x47, 0x45, 0x4e, 0x45, 0x52, 0x41, 0x4c, 0x20,
-  0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x4c, 0x49, 0x43, 0x45, 0x4e,
-  0x53, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2c,
-  0x20, 0x32, 0x39, 0x20, 0x4a, 0x75, 0x6e, 0x65, 0x20, 0x32, 0x30, 0x30,
-  0x37, 0x0a, 0x0a, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x30, 0x37, 0x20, 0x46,
-  0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
-  0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x3c, 0x68, 0x74, 0x74, 0x70, 0x3a,
-  0x2f, 0x2f, 0x66, 0x73, 0x66, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x3e, 0x0a,
-  0x20, 0x45, 0x76, 0x65, 0x72, 0x79, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73,
-  0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x74,
-  0x6f, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64,
-  0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65,
-  0x72, 0x62, 0x61, 0x74, 0x69, 0x6d, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65,
-  0x73, 0x0a, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63, 0x68, 0x61,
-  0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x2e,
-  0x0a, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20,
-  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c,
-  0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x69,
-  0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x73, 0x0a,
-  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62,
-  0x6c, 0x69, 0x63, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x64, 0x64,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x65, 0x72, 0x6d,
-  0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74,
-  0x65, 0x64, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x20,
-  0x20, 0x30, 0x2e, 0x20, 0x41, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x20, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x73, 0x20, 0x75, 0x73,
-  0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x69, 0x6e, 0x2c, 0x20, 0x22,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73,
-  0x73, 0x65, 0x72, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20,
-  0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x22, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x22, 0x20, 0x72, 0x65,
-  0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x47, 0x4e, 0x55, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
-  0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x22, 0x20, 0x72, 0x65,
-  0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x63, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x67,
-  0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x0a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20,
-  0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x61, 0x73,
-  0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x65, 0x6c,
-  0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x6e, 0x20, 0x22, 0x41,
-  0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20,
-  0x69, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x75,
-  0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x74,
-  0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x64, 0x0a, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20,
-  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74,
-  0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x62,
-  0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x44, 0x65, 0x66,
-  0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x63,
-  0x6c, 0x61, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x63, 0x6c,
-  0x61, 0x73, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x65, 0x6d, 0x65, 0x64,
-  0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a, 0x6f, 0x66, 0x20, 0x75,
-  0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x65,
-  0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x20,
-  0x22, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x22, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20,
-  0x6f, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61,
-  0x6e, 0x0a, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65,
-  0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0a, 0x77,
-  0x69, 0x74, 0x68, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65,
-  0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x63, 0x61, 0x6c,
-  0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22, 0x4c, 0x69, 0x6e,
-  0x6b, 0x65, 0x64, 0x0a, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x22, 0x4d, 0x69,
-  0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73,
-  0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x43, 0x6f,
-  0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x43, 0x6f,
-  0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64,
-  0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x66, 0x6f, 0x72, 0x20,
-  0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2c, 0x20,
-  0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69,
-  0x6e, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
-  0x20, 0x61, 0x72, 0x65, 0x0a, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x6e, 0x6b, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x22, 0x43, 0x6f,
-  0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20,
-  0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a,
-  0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20,
-  0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63,
-  0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e,
-  0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x61,
-  0x6e, 0x64, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x70,
-  0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x6e, 0x65, 0x65, 0x64,
-  0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f,
-  0x64, 0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x41, 0x70,
-  0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62,
-  0x75, 0x74, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x31,
-  0x2e, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x74, 0x6f, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x33,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20,
-  0x47, 0x50, 0x4c, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x59, 0x6f, 0x75, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x61,
-  0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x33, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x34,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74,
-  0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64,
-  0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x50, 0x4c, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x32, 0x2e, 0x20,
-  0x43, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x4d, 0x6f,
-  0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x49, 0x66, 0x20, 0x79,
-  0x6f, 0x75, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x20, 0x61, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x61, 0x6e, 0x64,
-  0x2c, 0x20, 0x69, 0x6e, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x6d, 0x6f,
-  0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
-  0x20, 0x61, 0x0a, 0x66, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20,
-  0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20,
-  0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x73,
-  0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61,
-  0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x0a, 0x74, 0x68, 0x61, 0x74, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79,
-  0x20, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e,
-  0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77,
-  0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x61, 0x63, 0x69,
-  0x6c, 0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x76, 0x6f,
-  0x6b, 0x65, 0x64, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x79,
-  0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65,
-  0x79, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
-  0x0a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x61, 0x29, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20,
-  0x61, 0x20, 0x67, 0x6f, 0x6f, 0x64, 0x20, 0x66, 0x61, 0x69, 0x74, 0x68,
-  0x20, 0x65, 0x66, 0x66, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x20,
-  0x20, 0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x76,
-  0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69,
-  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74,
-  0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79,
-  0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
-  0x74, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x65, 0x72,
-  0x66, 0x6f, 0x72, 0x6d, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x77, 0x68, 0x61,
-  0x74, 0x65, 0x76, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f,
-  0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73,
-  0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6d, 0x65,
-  0x61, 0x6e, 0x69, 0x6e, 0x67, 0x66, 0x75, 0x6c, 0x2c, 0x20, 0x6f, 0x72,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50,
-  0x4c, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6e, 0x6f, 0x6e, 0x65,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x64, 0x64, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69,
-  0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x70,
-  0x79, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x33, 0x2e, 0x20, 0x4f, 0x62, 0x6a,
-  0x65, 0x63, 0x74, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x49, 0x6e, 0x63,
-  0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x4d,
-  0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x66, 0x72, 0x6f, 0x6d,
-  0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x48, 0x65, 0x61,
-  0x64, 0x65, 0x72, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
-  0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f,
-  0x66, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x69, 0x6e, 0x63,
-  0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
-  0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x0a, 0x61,
-  0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x65,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x72,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62,
-  0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d,
-  0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x63, 0x6f,
-  0x64, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72,
-  0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63,
-  0x68, 0x6f, 0x69, 0x63, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2c, 0x20, 0x69, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f,
-  0x72, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69,
-  0x61, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69,
-  0x6d, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6e, 0x75, 0x6d,
-  0x65, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d,
-  0x65, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
-  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x0a, 0x6c, 0x61,
-  0x79, 0x6f, 0x75, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x63,
-  0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20,
-  0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73,
-  0x2c, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
-  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x0a, 0x28, 0x74, 0x65,
-  0x6e, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x6c,
-  0x69, 0x6e, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x65, 0x6e, 0x67,
-  0x74, 0x68, 0x29, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x64, 0x6f, 0x20,
-  0x62, 0x6f, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x61, 0x29, 0x20, 0x47, 0x69, 0x76, 0x65, 0x20, 0x70,
-  0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63,
-  0x68, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x64,
-  0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x69, 0x73,
-  0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x74, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x69, 0x74, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x72, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20,
-  0x41, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x64,
-  0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70,
-  0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x50, 0x4c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x34, 0x2e, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76,
-  0x65, 0x79, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f,
-  0x75, 0x72, 0x20, 0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x2c, 0x0a, 0x74, 0x61, 0x6b, 0x65, 0x6e, 0x20, 0x74, 0x6f,
-  0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2c, 0x20, 0x65, 0x66, 0x66, 0x65,
-  0x63, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x20, 0x64, 0x6f, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x20,
-  0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x70, 0x6f, 0x72, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x74,
-  0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
-  0x73, 0x65, 0x0a, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x65, 0x72, 0x69,
-  0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67,
-  0x67, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x6d, 0x6f,
-  0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
-  0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x61, 0x6c, 0x73, 0x6f,
-  0x20, 0x64, 0x6f, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x0a,
-  0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e,
-  0x67, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x29, 0x20, 0x47, 0x69,
-  0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e,
-  0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74, 0x68, 0x61, 0x74,
-  0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72,
-  0x61, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
-  0x69, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x75,
-  0x73, 0x65, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x6d, 0x70,
-  0x61, 0x6e, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x63,
-  0x29, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f,
-  0x74, 0x69, 0x63, 0x65, 0x73, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67,
-  0x0a, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
-  0x61, 0x6d, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65,
-  0x73, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20,
-  0x61, 0x73, 0x20, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x73, 0x20, 0x61,
-  0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50,
-  0x4c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x64, 0x29, 0x20,
-  0x44, 0x6f, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x29, 0x20,
-  0x43, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d,
-  0x69, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65,
-  0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f, 0x75,
-  0x72, 0x63, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f,
-  0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x69,
-  0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x66, 0x6f, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74, 0x2c, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x6c, 0x69, 0x6e,
-  0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x6e, 0x6b,
-  0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74,
-  0x6f, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x20,
-  0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x43, 0x6f, 0x6d,
-  0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x20,
-  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x73, 0x70, 0x65,
-  0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x69, 0x6e, 0x67,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x72, 0x72,
-  0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x29, 0x20, 0x55, 0x73, 0x65, 0x20, 0x61, 0x20, 0x73,
-  0x75, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72,
-  0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x6d,
-  0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x20, 0x41,
-  0x20, 0x73, 0x75, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6d, 0x65,
-  0x63, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x6f,
-  0x6e, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x28, 0x61, 0x29, 0x20,
-  0x75, 0x73, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x20,
-  0x74, 0x69, 0x6d, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x6c,
-  0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
-  0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65,
-  0x72, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x74,
-  0x65, 0x6d, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x62, 0x29, 0x20,
-  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x65,
-  0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x6c, 0x79, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65,
-  0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74,
-  0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x6e, 0x6b, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x65, 0x29, 0x20, 0x50, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x69,
-  0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20,
-  0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x73,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47,
-  0x50, 0x4c, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
-  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65,
-  0x6e, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x63, 0x68,
-  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73,
-  0x73, 0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x73, 0x74,
-  0x61, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x78, 0x65, 0x63,
-  0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69,
-  0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6d,
-  0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x70,
-  0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72,
-  0x65, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6f,
-  0x72, 0x20, 0x72, 0x65, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69,
-  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x28, 0x49, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x70, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x34, 0x64, 0x30, 0x2c, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x6d,
-  0x70, 0x61, 0x6e, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x72, 0x72,
-  0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x6f, 0x72,
-  0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x41,
-  0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20,
-  0x20, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x79,
-  0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x34, 0x64, 0x31, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d,
-  0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x66, 0x6f,
-  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x73, 0x70,
-  0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x73,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x0a,
-  0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65,
-  0x79, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70,
-  0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63,
-  0x65, 0x2e, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x35, 0x2e, 0x20, 0x43, 0x6f,
-  0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x69, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x59, 0x6f, 0x75,
-  0x20, 0x6d, 0x61, 0x79, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x6c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c,
-  0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61,
-  0x72, 0x65, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x61,
-  0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20,
-  0x62, 0x79, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61,
-  0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x72,
-  0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
-  0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0a, 0x66, 0x61, 0x63, 0x69,
-  0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6c,
-  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6f, 0x76,
-  0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x79, 0x6f, 0x75, 0x72, 0x0a, 0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x2c,
-  0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x64, 0x6f, 0x20, 0x62,
-  0x6f, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
-  0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x61, 0x29, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61,
-  0x6e, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69,
-  0x6e, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
-  0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
-  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x0a, 0x20,
-  0x20, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62,
-  0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x75, 0x6e, 0x63, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x62, 0x72,
-  0x61, 0x72, 0x79, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x69,
-  0x65, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65,
-  0x79, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x47, 0x69, 0x76, 0x65,
-  0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x6e,
-  0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74,
-  0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x0a,
-  0x20, 0x20, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x6b,
-  0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x69, 0x6e,
-  0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x66,
-  0x69, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x61,
-  0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x69, 0x6e, 0x67, 0x20,
-  0x75, 0x6e, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x66,
-  0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-  0x61, 0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2e, 0x0a, 0x0a, 0x20,
-  0x20, 0x36, 0x2e, 0x20, 0x52, 0x65, 0x76, 0x69, 0x73, 0x65, 0x64, 0x20,
-  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73,
-  0x65, 0x72, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50,
-  0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x46, 0x72,
-  0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
-  0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d,
-  0x61, 0x79, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x72,
-  0x65, 0x76, 0x69, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f,
-  0x72, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x73, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e,
-  0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x47, 0x65, 0x6e,
-  0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d,
-  0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x69, 0x6d,
-  0x65, 0x2e, 0x20, 0x53, 0x75, 0x63, 0x68, 0x20, 0x6e, 0x65, 0x77, 0x0a,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x77, 0x69, 0x6c,
-  0x6c, 0x20, 0x62, 0x65, 0x20, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72,
-  0x20, 0x69, 0x6e, 0x20, 0x73, 0x70, 0x69, 0x72, 0x69, 0x74, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
-  0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62,
-  0x75, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x0a, 0x64, 0x69, 0x66, 0x66, 0x65,
-  0x72, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x20,
-  0x74, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6e,
-  0x65, 0x77, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x6c, 0x65, 0x6d, 0x73, 0x20,
-  0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x65, 0x72, 0x6e, 0x73, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65,
-  0x6e, 0x20, 0x61, 0x20, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x75,
-  0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x20, 0x49,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72,
-  0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x72, 0x65, 0x63,
-  0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20, 0x73, 0x70, 0x65,
-  0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x61, 0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x6e, 0x75,
-  0x6d, 0x62, 0x65, 0x72, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e,
-  0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x47, 0x65, 0x6e,
-  0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x22, 0x6f, 0x72, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x61, 0x70, 0x70, 0x6c, 0x69,
-  0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x2c, 0x20, 0x79, 0x6f,
-  0x75, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f,
-  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6f, 0x6c,
-  0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
-  0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x63, 0x6f, 0x6e,
-  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70,
-  0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x72,
-  0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
-  0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20,
-  0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75, 0x0a, 0x72, 0x65,
-  0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20, 0x64, 0x6f,
-  0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
-  0x66, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65,
-  0x72, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75,
-  0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x68,
-  0x6f, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x0a, 0x47,
-  0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69,
-  0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x65, 0x76,
-  0x65, 0x72, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64,
-  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x65, 0x65,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x46, 0x6f,
-  0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20,
-  0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72,
-  0x61, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x72,
-  0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20, 0x73,
-  0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x78, 0x79, 0x20, 0x63, 0x61,
-  0x6e, 0x20, 0x64, 0x65, 0x63, 0x69, 0x64, 0x65, 0x0a, 0x77, 0x68, 0x65,
-  0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73,
-  0x65, 0x72, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50,
-  0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x0a, 0x61, 0x70, 0x70, 0x6c,
-  0x79, 0x2c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x78,
-  0x79, 0x27, 0x73, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20,
-  0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f,
-  0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x69, 0x73, 0x0a, 0x70, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x65,
-  0x6e, 0x74, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x79, 0x6f, 0x75,
-  0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69, 0x62, 0x72,
-  0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49, 0x41, 0x4c, 0x20, 0x45,
-  0x58, 0x43, 0x45, 0x50, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x47, 0x52, 0x41,
-  0x4e, 0x54, 0x45, 0x44, 0x20, 0x42, 0x59, 0x20, 0x43, 0x4f, 0x50, 0x59,
-  0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x48, 0x4f, 0x4c, 0x44, 0x45, 0x52,
-  0x53, 0x0a, 0x0a, 0x41, 0x73, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63,
-  0x69, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f,
-  0x6e, 0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x73, 0x20, 0x67, 0x69, 0x76,
-  0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72,
-  0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70,
-  0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
-  0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
-  0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x6c,
-  0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x69, 0x6e,
-  0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x6f,
-  0x64, 0x75, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
-  0x6f, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64,
-  0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x0a, 0x74, 0x68,
-  0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20,
-  0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x68, 0x6f, 0x69, 0x63,
-  0x65, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x61, 0x6c, 0x73,
-  0x6f, 0x0a, 0x6d, 0x65, 0x65, 0x74, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20,
-  0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20,
-  0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f,
-  0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x0a,
-  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x75,
-  0x6c, 0x65, 0x2e, 0x20, 0x41, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70,
-  0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
-  0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
-  0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6e,
-  0x6f, 0x74, 0x0a, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x20, 0x66,
-  0x72, 0x6f, 0x6d, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64,
-  0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x62,
-  0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x79, 0x6f, 0x75,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x79, 0x6f,
-  0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x6e,
-  0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x79, 0x6f, 0x75, 0x72,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e,
-  0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x3a, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72,
-  0x65, 0x6c, 0x69, 0x65, 0x76, 0x65, 0x73, 0x20, 0x79, 0x6f, 0x75, 0x20,
-  0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x62, 0x6c, 0x69, 0x67,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x34, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x35, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20,
-  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c,
-  0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a
+// NOTE compressed copy of txt/libzmq.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char libzmq_txt[] = {
+  0x00, 0x00, 0x21, 0x3c, 0x78, 0xda, 0xbd, 0x5a, 0x6d, 0x6f, 0x23, 0xb7,
+  0x11, 0xfe, 0xce, 0x5f, 0x41, 0xf8, 0x4b, 0x6c, 0x40, 0xd1, 0xbd, 0x26,
+  0x45, 0x0f, 0x45, 0x01, 0xc7, 0xa7, 0x73, 0x5c, 0x38, 0x3e, 0xc3, 0xbe,
+  0x6b, 0x7b, 0x1f, 0x57, 0xbb, 0x94, 0xc4, 0xde, 0xee, 0x52, 0x5d, 0xee,
+  0x5a, 0xe7, 0xfe, 0xfa, 0x3e, 0x33, 0x43, 0xee, 0x72, 0x57, 0x92, 0xcf,
+  0x41, 0x8a, 0x1a, 0x48, 0x62, 0x4b, 0xe4, 0x70, 0x5e, 0x9f, 0x79, 0x86,
+  0x8c, 0xd6, 0x93, 0x9f, 0xcb, 0x9b, 0xcf, 0xfa, 0x7a, 0x71, 0x7f, 0xbf,
+  0xb8, 0xd3, 0x97, 0x8b, 0x9b, 0xc5, 0xdd, 0xf9, 0xb5, 0xbe, 0xfd, 0xfc,
+  0xcb, 0xf5, 0xd5, 0x85, 0xc6, 0x3f, 0x8b, 0x9b, 0xfb, 0x85, 0xd2, 0x87,
+  0x7f, 0xfe, 0x6e, 0x1a, 0x6f, 0x5d, 0xad, 0xdf, 0xcc, 0xf4, 0xeb, 0x3f,
+  0xeb, 0xbf, 0x75, 0xb5, 0xd1, 0xaf, 0x5f, 0xbe, 0xfc, 0x93, 0x52, 0xfa,
+  0xc2, 0x6d, 0x1f, 0x1b, 0xbb, 0xde, 0xb4, 0xfa, 0xf4, 0xe2, 0x8c, 0x3f,
+  0xd4, 0x1f, 0x1a, 0x63, 0xf4, 0xbd, 0x5b, 0xb5, 0xbb, 0xac, 0x31, 0xfa,
+  0x83, 0xeb, 0xea, 0x22, 0x6b, 0xb1, 0x7b, 0xa6, 0xaf, 0xea, 0x7c, 0xae,
+  0xff, 0xb2, 0x69, 0xdb, 0xed, 0xbb, 0x17, 0x2f, 0x56, 0x7e, 0x35, 0x77,
+  0xcd, 0xfa, 0xc5, 0x5f, 0x95, 0x5e, 0x3c, 0x98, 0xe6, 0xd1, 0x41, 0xa8,
+  0xf5, 0x7a, 0x6b, 0x9a, 0xca, 0xb6, 0xad, 0x29, 0x74, 0xeb, 0x74, 0x0e,
+  0xe9, 0x3a, 0xab, 0x0b, 0x5d, 0x58, 0xdf, 0x36, 0x76, 0xd9, 0xb5, 0x46,
+  0x63, 0xed, 0x12, 0xf2, 0x2a, 0xfa, 0xd2, 0x1a, 0xaf, 0xb4, 0x5b, 0xe9,
+  0x76, 0x83, 0x9d, 0xa5, 0xcd, 0x4d, 0xed, 0x8d, 0x2e, 0x5c, 0xde, 0x55,
+  0xa6, 0x6e, 0x67, 0x1a, 0xeb, 0x75, 0xbe, 0xc9, 0xea, 0xb5, 0xad, 0xd7,
+  0xda, 0xb6, 0x24, 0xbe, 0x76, 0xad, 0xce, 0xca, 0xd2, 0xed, 0x4c, 0x31,
+  0x57, 0xd0, 0x5f, 0x7f, 0xa2, 0xad, 0x0f, 0xc1, 0x3e, 0x16, 0x65, 0xc4,
+  0x4f, 0xc6, 0x7b, 0xd3, 0xe8, 0x4b, 0x53, 0x9b, 0x26, 0x2b, 0xf5, 0x6d,
+  0xb7, 0x84, 0x7c, 0x7d, 0x1d, 0xce, 0xb0, 0x75, 0xee, 0x9a, 0xad, 0x6b,
+  0xb2, 0x16, 0x1a, 0xd0, 0x96, 0x16, 0x6a, 0x7b, 0x56, 0x35, 0x77, 0x75,
+  0x61, 0xc9, 0x5e, 0x4f, 0xe2, 0xa2, 0xe4, 0x37, 0xa9, 0xec, 0xb1, 0x50,
+  0x15, 0x84, 0xce, 0xb4, 0xef, 0xb6, 0xdb, 0xd2, 0x90, 0xee, 0x30, 0x7f,
+  0xf9, 0xc8, 0xeb, 0xb3, 0x42, 0xa4, 0x61, 0x39, 0xbb, 0xc6, 0x7b, 0x16,
+  0x5d, 0xc2, 0x21, 0xb4, 0xc8, 0xc0, 0x94, 0x39, 0xd9, 0xf1, 0x72, 0xae,
+  0xcf, 0x87, 0xa5, 0xef, 0xcd, 0xca, 0xd6, 0xa2, 0x05, 0x7f, 0x7b, 0xee,
+  0x75, 0xe7, 0xb1, 0x7e, 0x63, 0x1a, 0x63, 0x11, 0x89, 0x13, 0xf6, 0x58,
+  0x38, 0xf8, 0x44, 0x37, 0x66, 0x05, 0x3d, 0xc9, 0xe3, 0x07, 0xf5, 0x15,
+  0x5f, 0xa8, 0xc3, 0xbe, 0x98, 0xb1, 0xd5, 0xb4, 0xf4, 0x84, 0x6d, 0xbb,
+  0xbd, 0xfe, 0x9e, 0xbc, 0x23, 0x82, 0x58, 0xd1, 0x93, 0x4f, 0x58, 0x73,
+  0x6d, 0x97, 0x4d, 0xd6, 0x3c, 0xa6, 0x72, 0x32, 0xf8, 0x15, 0xb2, 0x60,
+  0xc2, 0xce, 0x35, 0x5f, 0xf5, 0x9a, 0xfe, 0xa8, 0xa3, 0x97, 0x06, 0x53,
+  0x66, 0xca, 0xe1, 0x90, 0x06, 0x9f, 0x65, 0x35, 0xf4, 0xd2, 0xe7, 0x70,
+  0xa8, 0xcd, 0x39, 0xfd, 0xb4, 0x6b, 0x20, 0xe5, 0xc2, 0x55, 0x4b, 0x4b,
+  0x1b, 0xff, 0x41, 0x62, 0x32, 0xaf, 0x0b, 0xf2, 0xd4, 0xc8, 0x93, 0xe7,
+  0xb5, 0x3e, 0x49, 0xf6, 0x9d, 0x50, 0xda, 0x64, 0xf5, 0xa3, 0x1c, 0x0c,
+  0xc1, 0xad, 0xae, 0xb2, 0xaf, 0x86, 0x1d, 0x4a, 0x46, 0xe1, 0x14, 0x8b,
+  0x80, 0x35, 0xab, 0x2c, 0x37, 0x7a, 0xdb, 0xb8, 0x07, 0x5b, 0x98, 0x42,
+  0x85, 0xe8, 0x05, 0x4b, 0x24, 0x15, 0x77, 0x1b, 0x9b, 0x6f, 0x62, 0x12,
+  0xb2, 0x9e, 0x3b, 0x0b, 0x19, 0xcb, 0x8c, 0x22, 0x03, 0x05, 0x93, 0x0d,
+  0x73, 0x25, 0x11, 0x44, 0xde, 0x66, 0x48, 0x8b, 0x65, 0x5e, 0x66, 0x9e,
+  0xf3, 0x09, 0x7e, 0xe0, 0x5f, 0x7b, 0xb5, 0x47, 0xe7, 0x90, 0xf0, 0xc2,
+  0x20, 0x83, 0x0a, 0x2c, 0xac, 0x5c, 0x61, 0x14, 0xb6, 0x74, 0x9e, 0xc5,
+  0x1c, 0x52, 0x73, 0xb2, 0x5d, 0xcc, 0xd7, 0x27, 0x23, 0x27, 0x89, 0xfd,
+  0x62, 0x3d, 0xf6, 0x15, 0x5d, 0x2e, 0xfb, 0x72, 0x5e, 0x44, 0xa2, 0xe1,
+  0xd8, 0xd2, 0xd6, 0x5f, 0xe5, 0x14, 0x95, 0xba, 0x7c, 0x67, 0xdb, 0xcd,
+  0xe8, 0x00, 0xaa, 0x37, 0x1c, 0x9f, 0x35, 0xad, 0xcd, 0xbb, 0x32, 0x6b,
+  0xa6, 0x95, 0x17, 0xd6, 0x29, 0xde, 0x28, 0xfe, 0xa2, 0x8f, 0xc7, 0x51,
+  0xdb, 0x21, 0x6c, 0x55, 0x56, 0x30, 0x5c, 0x64, 0xa5, 0x07, 0x4c, 0xa0,
+  0xa2, 0x4d, 0xc8, 0xc1, 0x6b, 0x68, 0x02, 0xff, 0x07, 0xc4, 0x3a, 0x99,
+  0x4b, 0x8d, 0xe3, 0x8b, 0xdf, 0xa0, 0x6c, 0x85, 0xa4, 0xbb, 0x70, 0x4d,
+  0x63, 0xfc, 0x96, 0xaa, 0x14, 0x0a, 0xdf, 0xbb, 0xae, 0xc9, 0x51, 0x01,
+  0xab, 0x03, 0xd9, 0x51, 0x99, 0x0c, 0x95, 0x06, 0xa9, 0xea, 0xd0, 0x1e,
+  0xde, 0xb2, 0xa7, 0xdc, 0x4c, 0x9b, 0x6f, 0x79, 0xd9, 0x15, 0xe2, 0x8c,
+  0x47, 0xed, 0x65, 0x6d, 0x4e, 0xb1, 0xa0, 0x0d, 0xc0, 0x8c, 0x1e, 0x1b,
+  0xf6, 0x2d, 0xa3, 0xec, 0x9a, 0x11, 0x82, 0x78, 0x44, 0x87, 0x92, 0xdd,
+  0x22, 0x6a, 0xde, 0x95, 0x01, 0x3f, 0x81, 0xa7, 0x6a, 0x94, 0x2d, 0x89,
+  0xaf, 0xa5, 0x0c, 0x39, 0xb3, 0x62, 0x26, 0x91, 0x23, 0x22, 0x74, 0x0f,
+  0x7e, 0x18, 0xdb, 0x92, 0x46, 0xeb, 0x02, 0x4a, 0x7e, 0xcf, 0x13, 0x6e,
+  0xf9, 0x2f, 0x93, 0xb7, 0x6c, 0x0f, 0x1d, 0xf8, 0x02, 0x8b, 0x13, 0x13,
+  0x7b, 0x9f, 0x8c, 0x14, 0x03, 0x58, 0x26, 0x1e, 0x41, 0x33, 0xc8, 0x14,
+  0xe9, 0xda, 0xb5, 0xb6, 0xb4, 0xed, 0x23, 0x25, 0xd5, 0xba, 0xc9, 0x80,
+  0x9e, 0xb5, 0x31, 0x94, 0x93, 0x24, 0xa3, 0x31, 0x92, 0x6a, 0xb4, 0x69,
+  0xdf, 0x4d, 0xab, 0xc6, 0x55, 0xac, 0xcd, 0xe8, 0x18, 0x2a, 0xb1, 0xc1,
+  0xf9, 0xb4, 0xeb, 0xfe, 0x11, 0x20, 0x59, 0x85, 0xa4, 0x42, 0xaf, 0x38,
+  0xe8, 0x74, 0xf6, 0xcc, 0xab, 0xb9, 0x5e, 0x7c, 0xcb, 0xcd, 0x96, 0xfd,
+  0x00, 0xb8, 0xb9, 0x87, 0x91, 0xfb, 0xb0, 0x7d, 0x7b, 0xcd, 0x8b, 0xbf,
+  0xb8, 0x0e, 0xf9, 0x47, 0x15, 0x50, 0x3f, 0x98, 0xc7, 0x29, 0x34, 0xa1,
+  0xdd, 0x01, 0x80, 0xbc, 0x08, 0xf0, 0x90, 0x40, 0xb6, 0xbe, 0xed, 0xbb,
+  0x54, 0x00, 0x2a, 0xce, 0x70, 0x07, 0x8d, 0x97, 0x86, 0xb4, 0x5d, 0x52,
+  0x97, 0xa4, 0xaa, 0xf2, 0x4f, 0x1d, 0xfc, 0x7a, 0x0e, 0xd5, 0xe9, 0x4c,
+  0xda, 0xf2, 0x9b, 0x2b, 0xec, 0xca, 0x0e, 0x11, 0x16, 0xa0, 0xbf, 0x5a,
+  0xe9, 0x47, 0x52, 0x8f, 0xbe, 0x14, 0xd5, 0xd0, 0x41, 0xc7, 0xc5, 0xc5,
+  0x99, 0x42, 0x51, 0xa1, 0x95, 0x8d, 0x2c, 0x0d, 0x4e, 0xf4, 0xf8, 0x4e,
+  0x01, 0x21, 0x24, 0x30, 0x29, 0xfa, 0xae, 0xba, 0x3a, 0x8f, 0x28, 0x4a,
+  0x11, 0xa4, 0x4f, 0x97, 0x46, 0x3a, 0x96, 0x15, 0x40, 0x18, 0xc3, 0xad,
+  0x62, 0xa4, 0x04, 0x46, 0x72, 0xde, 0xe8, 0x5e, 0xe8, 0x69, 0x0a, 0xd0,
+  0x04, 0xac, 0xc8, 0xea, 0x35, 0xf7, 0x6b, 0xc0, 0x82, 0xa7, 0xdc, 0xde,
+  0x6d, 0x0c, 0x67, 0xf0, 0xa0, 0x08, 0xdc, 0x66, 0xeb, 0x07, 0x87, 0x74,
+  0x3e, 0x9b, 0xd1, 0x37, 0xb5, 0xd8, 0x38, 0x0e, 0xc1, 0x60, 0x67, 0x15,
+  0x3c, 0xa3, 0x02, 0xb8, 0xbc, 0x23, 0xc7, 0xe8, 0xec, 0x2c, 0x84, 0x66,
+  0xd4, 0x2f, 0x06, 0x28, 0x64, 0x7d, 0x45, 0xee, 0x57, 0xe4, 0x36, 0x5a,
+  0x8c, 0x43, 0x2e, 0x66, 0x04, 0x44, 0x66, 0x85, 0x9c, 0x6c, 0x61, 0x32,
+  0xc9, 0xc1, 0xb6, 0x0e, 0xbc, 0x46, 0x4a, 0xd5, 0x4a, 0xad, 0x99, 0x07,
+  0xd2, 0x7f, 0xd2, 0x6f, 0x0a, 0x67, 0x04, 0xea, 0xd9, 0x49, 0x0c, 0xb4,
+  0xb4, 0x7f, 0xea, 0xc9, 0xd9, 0xd8, 0x3f, 0x1e, 0x55, 0x51, 0x6a, 0x87,
+  0x5e, 0x4f, 0xdc, 0x42, 0xaa, 0x1a, 0x7f, 0x40, 0x81, 0xca, 0xd3, 0xf6,
+  0x1d, 0xce, 0xc5, 0x71, 0x0d, 0x83, 0x28, 0x59, 0x6c, 0x5b, 0x90, 0xa6,
+  0x0e, 0x64, 0x04, 0xad, 0xa4, 0x31, 0x55, 0x66, 0x91, 0x74, 0x54, 0xaf,
+  0xc8, 0x91, 0x55, 0x57, 0xce, 0x70, 0x0c, 0x9b, 0xbf, 0x1c, 0xcc, 0xef,
+  0x93, 0x6a, 0x26, 0x00, 0x5d, 0x13, 0xf5, 0x0a, 0xbe, 0x3b, 0x42, 0x37,
+  0xdc, 0x8a, 0x64, 0xa4, 0x9e, 0xd3, 0x99, 0x98, 0xba, 0x2c, 0x0d, 0xe5,
+  0x02, 0x7b, 0x8f, 0x82, 0xc0, 0x59, 0xf8, 0x66, 0xae, 0x3f, 0x0a, 0x50,
+  0x10, 0xa6, 0x10, 0xef, 0x0b, 0x6c, 0x89, 0x13, 0x17, 0x06, 0x34, 0x16,
+  0x07, 0x70, 0x19, 0xc7, 0xce, 0xf5, 0xab, 0xc9, 0x48, 0xbb, 0x0f, 0xb6,
+  0x34, 0xbe, 0x07, 0xab, 0x14, 0x6d, 0xc8, 0x03, 0xa1, 0xdf, 0xa6, 0x5e,
+  0xa6, 0x2c, 0x48, 0xd8, 0x18, 0xfe, 0x4e, 0xa4, 0xab, 0x0c, 0x8c, 0x87,
+  0xe5, 0xae, 0x6c, 0x29, 0x31, 0x63, 0x8e, 0x19, 0x5c, 0x37, 0xee, 0x4c,
+  0x93, 0xb2, 0xf6, 0x1d, 0x9a, 0x8f, 0x28, 0xa0, 0x58, 0x81, 0xe0, 0x3e,
+  0x26, 0x7a, 0x6e, 0x25, 0xc5, 0x93, 0x6f, 0x1c, 0xdc, 0x31, 0xc9, 0x22,
+  0xa4, 0x85, 0xc8, 0x4e, 0xf4, 0x2a, 0x54, 0xaf, 0x58, 0x20, 0x00, 0xa5,
+  0x05, 0xcf, 0x15, 0x9a, 0x5b, 0x23, 0xff, 0x1b, 0x18, 0x54, 0x92, 0x66,
+  0x59, 0x65, 0xb0, 0x10, 0x91, 0xe7, 0x32, 0x03, 0xed, 0xed, 0xf2, 0x16,
+  0x09, 0xa7, 0xca, 0x0c, 0x27, 0xb6, 0xc2, 0x31, 0xb3, 0x3c, 0x07, 0x25,
+  0x73, 0xb4, 0x8a, 0x00, 0x18, 0x6d, 0xad, 0x84, 0xea, 0x79, 0xe3, 0x3c,
+  0xa5, 0x24, 0x9a, 0xb1, 0xe9, 0xd3, 0x4c, 0x36, 0x00, 0x06, 0xb7, 0x25,
+  0x93, 0xd5, 0xd3, 0xd6, 0x70, 0xea, 0xad, 0xcc, 0xce, 0x70, 0xdf, 0x36,
+  0x54, 0x5c, 0xba, 0x34, 0xf5, 0xba, 0xdd, 0xa0, 0xbc, 0xa8, 0x02, 0x0a,
+  0xd4, 0x36, 0xca, 0x34, 0xba, 0x68, 0xe5, 0x88, 0x30, 0x23, 0x74, 0x7d,
+  0x21, 0x5d, 0xda, 0x07, 0x26, 0x11, 0x15, 0xb6, 0x23, 0xf1, 0x61, 0x0e,
+  0xbc, 0x20, 0xc9, 0x64, 0x32, 0xb8, 0x2d, 0xad, 0xc6, 0x34, 0x86, 0x1c,
+  0x80, 0x50, 0x07, 0x09, 0x65, 0x61, 0x6a, 0x4a, 0xad, 0xae, 0x0d, 0x5c,
+  0x52, 0x56, 0xf5, 0x4b, 0xe8, 0x43, 0x4a, 0x73, 0x62, 0x5c, 0xd4, 0x03,
+  0xb1, 0x3b, 0x42, 0xee, 0x84, 0xff, 0xcd, 0x63, 0xae, 0x9f, 0xe7, 0xe0,
+  0x27, 0x5b, 0xea, 0x37, 0x53, 0x1d, 0x58, 0xcb, 0x31, 0x60, 0x84, 0x72,
+  0x08, 0x87, 0x0f, 0xa3, 0x04, 0xc9, 0x8a, 0xd3, 0x04, 0x4b, 0x7e, 0x3b,
+  0x1f, 0xf7, 0x0e, 0x7f, 0xb8, 0x1f, 0x8c, 0xbb, 0xd5, 0xf1, 0xbc, 0x91,
+  0x6c, 0x51, 0x2d, 0x00, 0x87, 0xba, 0xce, 0xda, 0x10, 0x34, 0xce, 0x08,
+  0x6e, 0xa8, 0x0b, 0x3c, 0x18, 0x80, 0x06, 0x42, 0x41, 0xc9, 0x82, 0x8e,
+  0x8d, 0xf9, 0x07, 0x26, 0xa4, 0x68, 0x1d, 0xd4, 0x57, 0x53, 0x4e, 0x11,
+  0xdd, 0x06, 0x7d, 0xda, 0x8c, 0xf5, 0x08, 0x30, 0x35, 0x21, 0xbf, 0xb0,
+  0xb6, 0x21, 0x28, 0x81, 0xa1, 0x86, 0x66, 0x24, 0x83, 0x24, 0x44, 0x7d,
+  0x52, 0xff, 0x2d, 0xcc, 0xb2, 0x5b, 0xf3, 0xd8, 0xc4, 0x65, 0x30, 0xe9,
+  0x11, 0x56, 0x9a, 0x0c, 0x73, 0x2f, 0x28, 0xc8, 0x21, 0x07, 0x42, 0xfc,
+  0xf1, 0x5c, 0xd9, 0x67, 0x43, 0x02, 0x3b, 0xe6, 0xff, 0x9a, 0x2d, 0x13,
+  0xb6, 0xf9, 0x07, 0xf2, 0x45, 0xe7, 0x67, 0x18, 0x80, 0xf7, 0xf9, 0x14,
+  0xeb, 0x8c, 0x99, 0x16, 0x35, 0xf9, 0xe8, 0x59, 0xb4, 0xcc, 0xd0, 0xe2,
+  0x1c, 0x70, 0xf8, 0x8e, 0x22, 0xc1, 0xdd, 0xe6, 0x9b, 0xc9, 0xbb, 0x94,
+  0x46, 0x19, 0xd6, 0x60, 0xba, 0xa5, 0x27, 0x5e, 0xbd, 0x13, 0x2a, 0x27,
+  0x02, 0xf0, 0x21, 0xfc, 0x10, 0x04, 0xcf, 0xa8, 0xe5, 0xee, 0x0c, 0xd0,
+  0x82, 0x5a, 0xaf, 0x34, 0x78, 0x53, 0x63, 0x7b, 0x61, 0x1b, 0x4a, 0xb9,
+  0xc0, 0x9b, 0x3a, 0x9a, 0x7c, 0x19, 0xd4, 0x83, 0xf7, 0xb6, 0x09, 0x79,
+  0x3a, 0x66, 0xfc, 0xc4, 0xf2, 0xe2, 0x4c, 0xbf, 0x77, 0x3a, 0xe9, 0x2c,
+  0x93, 0xcc, 0xa0, 0x9f, 0x97, 0x67, 0x81, 0xcf, 0xf0, 0x82, 0xa7, 0x08,
+  0x7a, 0xd2, 0xbb, 0xfa, 0x42, 0xa2, 0xc3, 0xa3, 0xa4, 0xbd, 0x59, 0xf4,
+  0x69, 0x96, 0x4b, 0xe9, 0x93, 0x71, 0x47, 0x89, 0x02, 0x7c, 0x67, 0x5b,
+  0xee, 0x65, 0xf8, 0x50, 0xa4, 0xa4, 0x65, 0xcb, 0xf1, 0x92, 0x9b, 0x89,
+  0x59, 0xea, 0xa1, 0xb8, 0x1b, 0xce, 0x93, 0xf8, 0x6a, 0xe6, 0xae, 0x34,
+  0x0d, 0x4d, 0x69, 0x70, 0xcc, 0xa3, 0x48, 0x4e, 0x92, 0xc9, 0x27, 0x4a,
+  0xd9, 0x67, 0xed, 0x14, 0x84, 0x30, 0x73, 0xa5, 0x5b, 0x27, 0x13, 0x87,
+  0x54, 0x77, 0x94, 0x52, 0x65, 0x75, 0x4d, 0x04, 0x74, 0x6b, 0x72, 0x59,
+  0x9d, 0xb0, 0xca, 0x9f, 0xa7, 0x41, 0xa4, 0xb4, 0xc9, 0x23, 0xa5, 0x8c,
+  0x12, 0x0e, 0x05, 0x60, 0xde, 0x07, 0xed, 0xd5, 0x99, 0xfe, 0x4c, 0x95,
+  0x35, 0xb8, 0xcc, 0x6f, 0x32, 0x2a, 0xae, 0x32, 0xa4, 0x5e, 0x65, 0xe8,
+  0xce, 0xc5, 0xfa, 0x8a, 0xa5, 0xc7, 0xc9, 0x30, 0x8e, 0x82, 0x43, 0xc4,
+  0x62, 0xdf, 0x3d, 0x1f, 0x24, 0x0d, 0x5b, 0x91, 0x57, 0x94, 0x3b, 0xec,
+  0xf8, 0x53, 0xa2, 0x6e, 0x44, 0x24, 0xf1, 0x7b, 0xd3, 0xc1, 0x58, 0x5b,
+  0xf5, 0x62, 0x0e, 0x32, 0x5c, 0x20, 0x53, 0x83, 0xb6, 0x4f, 0xa3, 0x05,
+  0x92, 0xbf, 0xee, 0x47, 0x22, 0x8a, 0xda, 0x0f, 0x54, 0x6f, 0xd5, 0xb6,
+  0x43, 0x60, 0xfb, 0xd8, 0xf3, 0x98, 0x20, 0x51, 0x3f, 0x05, 0x1a, 0xec,
+  0x12, 0x06, 0x46, 0xee, 0xc7, 0x6f, 0x40, 0xe2, 0x23, 0xf1, 0x8b, 0x42,
+  0x26, 0x1a, 0x44, 0xaa, 0xd1, 0xcf, 0xdc, 0x3f, 0x32, 0xc2, 0xb4, 0x96,
+  0xcc, 0x4c, 0xc6, 0x62, 0x1e, 0x56, 0xc7, 0xb7, 0x6c, 0xe2, 0x6a, 0x73,
+  0xa6, 0x6f, 0x85, 0x54, 0x80, 0x3e, 0xf9, 0x16, 0x1d, 0x5e, 0xd2, 0xe8,
+  0xaa, 0xa6, 0xb4, 0x4d, 0x46, 0x1e, 0x57, 0x43, 0xb9, 0x80, 0xc8, 0x3b,
+  0xd7, 0x95, 0xc5, 0x70, 0xb5, 0xc0, 0xe8, 0x46, 0xac, 0xf0, 0xdf, 0x9d,
+  0x6d, 0x84, 0x6a, 0x04, 0xa2, 0x22, 0xb0, 0x6e, 0x07, 0x59, 0xe3, 0xb1,
+  0xa5, 0x4f, 0x14, 0x15, 0x6e, 0x0d, 0x99, 0x2c, 0x92, 0x7f, 0xf8, 0x34,
+  0x81, 0x06, 0x60, 0x53, 0x4b, 0xce, 0x65, 0x53, 0xf7, 0xe4, 0x49, 0x6d,
+  0xd6, 0x86, 0x88, 0x0a, 0x3b, 0xc4, 0xe1, 0x6b, 0xb6, 0x83, 0xe5, 0x08,
+  0xae, 0x99, 0xc3, 0x05, 0x11, 0x4f, 0x1e, 0x83, 0x66, 0x7a, 0xf9, 0x10,
+  0x0b, 0x2e, 0x5c, 0x3f, 0x48, 0xc9, 0x05, 0xf8, 0xa2, 0x9d, 0xcf, 0x2b,
+  0xbc, 0x43, 0x73, 0xb2, 0x3e, 0xbd, 0xe2, 0x82, 0x24, 0x77, 0xf2, 0x0d,
+  0x8f, 0xcc, 0x84, 0x6f, 0x8b, 0x97, 0x52, 0xf9, 0xc7, 0x82, 0xa1, 0xab,
+  0xce, 0xb7, 0x44, 0xcc, 0xa4, 0x91, 0xc4, 0xbe, 0xf5, 0x24, 0xa8, 0x91,
+  0x23, 0x8e, 0x02, 0x95, 0x38, 0xa0, 0x30, 0xf3, 0x38, 0xd3, 0x8d, 0xb4,
+  0x79, 0x25, 0x4c, 0x8d, 0x0f, 0x8d, 0x31, 0x9d, 0xaa, 0x47, 0x12, 0x52,
+  0x0d, 0x03, 0x0b, 0xf8, 0x3d, 0x00, 0xc1, 0x03, 0x4b, 0x8a, 0x11, 0x87,
+  0xc1, 0xe1, 0x8c, 0x52, 0xf6, 0xa7, 0x84, 0x1c, 0xf5, 0x23, 0xf7, 0x88,
+  0x20, 0xa1, 0xdd, 0xc1, 0xea, 0x88, 0x13, 0x61, 0xe4, 0xb1, 0x26, 0xe0,
+  0x2b, 0xdd, 0x16, 0x87, 0x7b, 0xa6, 0xf4, 0x92, 0x43, 0xc5, 0x92, 0xa2,
+  0x3b, 0x11, 0xd6, 0xd5, 0x46, 0x00, 0xa7, 0x8b, 0xad, 0x72, 0x10, 0x18,
+  0x19, 0x94, 0x44, 0x5c, 0xe6, 0xcc, 0xf0, 0x9d, 0x3a, 0x74, 0x18, 0x11,
+  0xab, 0xc4, 0xe1, 0x81, 0x5a, 0x87, 0x2f, 0x26, 0x94, 0x41, 0x8d, 0x3a,
+  0x4c, 0x3a, 0x22, 0x64, 0xe1, 0x26, 0x2c, 0x41, 0xc0, 0x03, 0x8c, 0x4f,
+  0xc5, 0x49, 0x21, 0x54, 0xea, 0x77, 0x29, 0xf6, 0x98, 0x92, 0xec, 0x1d,
+  0x71, 0x80, 0x95, 0x78, 0x4c, 0x0e, 0x89, 0xfb, 0x48, 0xce, 0xf8, 0x52,
+  0x71, 0x06, 0xc5, 0x7a, 0x41, 0x22, 0x00, 0xe2, 0x47, 0x7e, 0x4a, 0x82,
+  0x32, 0x93, 0xd6, 0x4f, 0x86, 0x9a, 0xe2, 0x58, 0xff, 0xdd, 0x63, 0x52,
+  0x4f, 0xb0, 0xbd, 0x83, 0x76, 0x48, 0x67, 0xed, 0x47, 0x59, 0x92, 0x32,
+  0x5c, 0x37, 0x1e, 0xba, 0x19, 0x9d, 0x05, 0xf8, 0x40, 0x2e, 0x49, 0xf9,
+  0xef, 0xe8, 0x4e, 0x9b, 0xe0, 0x65, 0x65, 0xa5, 0xf7, 0xb3, 0x03, 0xa3,
+  0xf7, 0x68, 0x45, 0x62, 0x75, 0x1c, 0x22, 0x47, 0xfe, 0x62, 0xe5, 0x7f,
+  0x9e, 0xeb, 0x3b, 0xf3, 0x60, 0x7d, 0x72, 0xa1, 0xf2, 0xec, 0xe7, 0x80,
+  0x7e, 0x5e, 0x3d, 0xf6, 0xf4, 0x21, 0xd9, 0x4f, 0x7b, 0xfc, 0x86, 0x38,
+  0x37, 0x1f, 0x13, 0xae, 0xcf, 0x6a, 0xb3, 0x8b, 0x90, 0xe4, 0xd5, 0xb3,
+  0x1f, 0x20, 0xe4, 0x0a, 0x0c, 0x8d, 0x90, 0xc1, 0x18, 0xff, 0x9d, 0xeb,
+  0x7b, 0xca, 0x46, 0x48, 0x8b, 0xd7, 0x1e, 0x5e, 0x1a, 0x19, 0xdd, 0xd2,
+  0x60, 0xd4, 0xa4, 0xcb, 0x56, 0x14, 0x8d, 0xdf, 0xda, 0xc6, 0xb6, 0x11,
+  0xc1, 0x63, 0x7f, 0x0c, 0x3b, 0xa4, 0xa1, 0x40, 0x57, 0x05, 0xa8, 0x04,
+  0x35, 0xa4, 0x0d, 0x85, 0xc1, 0x0c, 0x51, 0xf2, 0x25, 0x50, 0x51, 0x60,
+  0xb9, 0x67, 0x85, 0x11, 0x61, 0x34, 0x32, 0xca, 0x03, 0xc6, 0x86, 0xdc,
+  0x34, 0xe1, 0xfe, 0x69, 0x41, 0x94, 0x3e, 0x22, 0x2c, 0x22, 0xb9, 0x46,
+  0x3e, 0x50, 0xa9, 0xd2, 0x03, 0x0e, 0x62, 0xd1, 0xc1, 0x01, 0x14, 0x92,
+  0xb8, 0x02, 0x93, 0xef, 0xd2, 0x34, 0x0c, 0x71, 0x69, 0xa9, 0x83, 0x9d,
+  0x52, 0x91, 0x00, 0xe5, 0x0d, 0xf6, 0x13, 0x9d, 0xef, 0xe1, 0x2a, 0xd6,
+  0xaf, 0xc6, 0x99, 0x34, 0xdd, 0x04, 0x11, 0x49, 0x43, 0x7e, 0xb6, 0x0f,
+  0x4f, 0x88, 0x99, 0xa3, 0x02, 0x68, 0x30, 0xee, 0x6f, 0xa2, 0x4f, 0x14,
+  0x5f, 0x6c, 0x18, 0xbe, 0xf7, 0x22, 0xba, 0x47, 0x8a, 0x6c, 0xb2, 0x07,
+  0x81, 0xd7, 0x80, 0xbf, 0x38, 0xa2, 0xaf, 0x58, 0x3d, 0x7a, 0xfe, 0x51,
+  0xc9, 0xf3, 0x8f, 0xb1, 0x5c, 0x5a, 0xac, 0x0f, 0x65, 0xb9, 0xc4, 0x3f,
+  0xed, 0x40, 0x8d, 0x5c, 0x68, 0x4c, 0x54, 0x50, 0xc3, 0xca, 0x70, 0x3f,
+  0x7f, 0x2c, 0xaf, 0xa2, 0xe3, 0xf4, 0xd8, 0x71, 0x2a, 0x75, 0xdc, 0x70,
+  0x0d, 0xc5, 0x1e, 0xa4, 0xf9, 0x74, 0xec, 0xfd, 0xdf, 0xf1, 0xd2, 0xd3,
+  0x5f, 0xbb, 0x6d, 0x1c, 0x5d, 0x37, 0x91, 0xe6, 0x47, 0x9f, 0xce, 0x8e,
+  0x08, 0xd1, 0x72, 0x79, 0xf5, 0x6c, 0x0b, 0xc3, 0xa5, 0xe6, 0xbe, 0x91,
+  0x4f, 0x67, 0x07, 0x12, 0xf4, 0x1b, 0xf4, 0xcc, 0x28, 0x81, 0x73, 0x34,
+  0x0c, 0x05, 0x98, 0xe0, 0x68, 0xac, 0x3a, 0xba, 0x4d, 0xe9, 0x2b, 0xee,
+  0xf9, 0x4f, 0x7e, 0x60, 0xb9, 0x65, 0xc9, 0xc9, 0xf1, 0x38, 0x0b, 0x01,
+  0xa5, 0x33, 0x7e, 0xf0, 0x62, 0x4c, 0xae, 0xd1, 0x78, 0x5b, 0x7e, 0xbc,
+  0xe3, 0xa0, 0xe6, 0x74, 0x9b, 0x9c, 0xd1, 0x6c, 0x15, 0x42, 0x3c, 0x14,
+  0x85, 0xa2, 0x49, 0x22, 0x63, 0x7c, 0xcc, 0xba, 0x76, 0xe3, 0x1a, 0xfb,
+  0x1f, 0x41, 0x09, 0xea, 0xb4, 0x64, 0x19, 0xbd, 0x7c, 0x8a, 0x87, 0xf9,
+  0x9c, 0xb8, 0x33, 0xcc, 0x78, 0x6a, 0x78, 0xad, 0xf9, 0xf1, 0x7f, 0xfc,
+  0xa3, 0xd2, 0x07, 0xe0, 0xfb, 0xdb, 0xc5, 0xc5, 0xd5, 0xf9, 0xb5, 0x5e,
+  0xfc, 0xf3, 0x62, 0x71, 0xfb, 0xe9, 0xea, 0xe3, 0x8d, 0xbe, 0xbc, 0x3b,
+  0xbf, 0xf9, 0xb4, 0x78, 0xaf, 0x7f, 0xf9, 0xa2, 0x2f, 0x3e, 0xde, 0x7e,
+  0xb9, 0xbb, 0xba, 0xfc, 0xf5, 0x93, 0xfe, 0xf5, 0xe3, 0xf5, 0xfb, 0xc5,
+  0xdd, 0xbd, 0x52, 0xe7, 0x84, 0xdb, 0x1c, 0x08, 0x38, 0xcf, 0xc4, 0xdb,
+  0xf4, 0x59, 0x32, 0xab, 0x6e, 0x5c, 0x59, 0xd0, 0x8d, 0x32, 0x81, 0x02,
+  0x1b, 0x3a, 0x5c, 0x31, 0x92, 0xcd, 0x61, 0x6c, 0x82, 0x83, 0x46, 0x5d,
+  0x0e, 0xb0, 0x6e, 0xb6, 0x06, 0xff, 0xaa, 0xf9, 0xfa, 0xa3, 0x2b, 0xa5,
+  0x36, 0xfb, 0xb9, 0xa8, 0x0e, 0x64, 0x92, 0x26, 0x88, 0x19, 0xb2, 0x62,
+  0x9d, 0x35, 0x45, 0x69, 0xf8, 0xb9, 0x8c, 0xaf, 0x24, 0xe2, 0x7c, 0x9a,
+  0x34, 0x2e, 0xc3, 0x4f, 0xb8, 0x7b, 0x62, 0xc3, 0xf8, 0x78, 0xf0, 0xdd,
+  0x99, 0x45, 0x01, 0xff, 0xba, 0x92, 0xc7, 0xe4, 0xe1, 0xc8, 0xe7, 0xdf,
+  0x0b, 0xf6, 0x97, 0x26, 0xaa, 0x32, 0x06, 0xc8, 0x42, 0xf1, 0xe4, 0x2b,
+  0x90, 0x52, 0x28, 0xe8, 0xbe, 0x46, 0x33, 0xfd, 0xc4, 0xdb, 0xf2, 0xc8,
+  0xb8, 0x08, 0x32, 0xb2, 0x6f, 0x4e, 0x8f, 0x98, 0xfb, 0xe2, 0xa4, 0xb5,
+  0x86, 0xdf, 0xd3, 0xd7, 0x48, 0x05, 0x0b, 0xb8, 0x94, 0xb8, 0xad, 0x40,
+  0xad, 0xa4, 0xf3, 0xf2, 0x84, 0x1f, 0x66, 0xb5, 0xf1, 0xeb, 0x42, 0xfa,
+  0xdd, 0x40, 0x47, 0x15, 0x8f, 0x05, 0xe1, 0x6e, 0xc0, 0xa4, 0x8f, 0x2a,
+  0xec, 0x99, 0x09, 0x5e, 0x94, 0x7d, 0x2e, 0xdf, 0xb8, 0xd6, 0xbc, 0x9b,
+  0xee, 0x22, 0x62, 0x0f, 0xc0, 0x90, 0x82, 0x0f, 0x85, 0x84, 0xce, 0x63,
+  0xd7, 0x81, 0xb1, 0x4d, 0x1e, 0x5b, 0xde, 0xb2, 0x97, 0x7e, 0x52, 0x93,
+  0xff, 0x25, 0x40, 0xe2, 0x7a, 0x98, 0xe3, 0x1e, 0x69, 0xe8, 0xff, 0x05,
+  0x14, 0x83, 0x79, 0x01
 };
-unsigned int libzmq_txt_len = 8508;
+static constexpr unsigned int libzmq_txt_len = 2896;
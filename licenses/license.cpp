@@ -6,12 +6,12 @@
 #include "license.hpp"  // IWYU pragma: associated
 
 #include <opentxs/opentxs.hpp>
+#include <QByteArray>
 #include <algorithm>
 #include <cctype>
 #include <iterator>
-#include <map>
 #include <string>
-#include <type_traits>
+#include <vector>
 
 #include "boost.h"
 #include "libzmq.h"
@@ -21,56 +21,107 @@
 #include "qt.h"
 #include "sodium.h"
 
-auto width_ = std::size_t{0};
+namespace
+{
+struct License {
+    std::string_view name_;
+    std::string_view data_;
+    bool compressed_;
+};
+
+using Index = std::vector<License>;
 
-auto make_vector() noexcept -> LicenseData;
-auto make_vector() noexcept -> LicenseData
+auto make_index() noexcept -> Index;
+auto make_index() noexcept -> Index
 {
-    auto output = LicenseData{
-        {METIER_APPSTREAM_NAME,
-         std::string{reinterpret_cast<const char*>(LICENSE), LICENSE_len}},
-        {"Boost",
-         std::string{reinterpret_cast<const char*>(boost_txt), boost_txt_len}},
-        {"libsodium",
-         std::string{
-             reinterpret_cast<const char*>(sodium_txt), sodium_txt_len}},
-        {"LMDB",
-         std::string{reinterpret_cast<const char*>(lmdb_txt), lmdb_txt_len}},
-        {"OpenSSL",
-         std::string{
-             reinterpret_cast<const char*>(openssl_txt), openssl_txt_len}},
-        {"Qt", std::string{reinterpret_cast<const char*>(qt_txt), qt_txt_len}},
-        {"ZeroMQ",
-         std::string{
-             reinterpret_cast<const char*>(libzmq_txt), libzmq_txt_len}},
+    const auto compressed = [](const char* name,
+                               const unsigned char* data,
+                               const unsigned int size) -> License {
+        return {
+            name,
+            std::string_view{reinterpret_cast<const char*>(data), size},
+            true};
     };
-    const auto& ot = opentxs::LicenseData();
-    std::copy(ot.begin(), ot.end(), std::back_inserter(output));
+    auto output = Index{
+        compressed(METIER_APPSTREAM_NAME, LICENSE, LICENSE_len),
+        compressed("Boost", boost_txt, boost_txt_len),
+        compressed("libsodium", sodium_txt, sodium_txt_len),
+        compressed("LMDB", lmdb_txt, lmdb_txt_len),
+        compressed("OpenSSL", openssl_txt, openssl_txt_len),
+        compressed("Qt", qt_txt, qt_txt_len),
+        compressed("ZeroMQ", libzmq_txt, libzmq_txt_len),
+    };
+
+    // NOTE opentxs owns these strings for the life of the process so they
+    // are referenced rather than copied
+    for (const auto& [name, text] : opentxs::LicenseData()) {
+        output.push_back({name, text, false});
+    }
+
     std::sort(
         std::next(output.begin()),
         output.end(),
         [](const auto& lhs, const auto& rhs) {
             return std::lexicographical_compare(
-                std::begin(lhs.first),
-                std::end(lhs.first),
-                std::begin(rhs.first),
-                std::end(rhs.first),
+                std::begin(lhs.name_),
+                std::end(lhs.name_),
+                std::begin(rhs.name_),
+                std::end(rhs.name_),
                 [](const auto& c1, const auto& c2) {
                     return std::tolower(c1) < std::tolower(c2);
                 });
         });
-    for (const auto& [key, value] : output) {
-        width_ = std::max(width_, key.size());
-    }
 
     return output;
 }
 
-auto LongestLicenseDescription() noexcept -> std::size_t { return width_; }
-
-auto MetierLicenseData() noexcept -> const LicenseData&
+auto licenses() noexcept -> const Index&;
+auto licenses() noexcept -> const Index&
 {
-    static const auto data{make_vector()};
+    static const auto data{make_index()};
 
     return data;
 }
+}  // namespace
+
+auto LicenseCount() noexcept -> std::size_t { return licenses().size(); }
+
+auto LicenseName(const std::size_t index) noexcept -> std::string_view
+{
+    const auto& data = licenses();
+
+    if (index >= data.size()) { return {}; }
+
+    return data[index].name_;
+}
+
+auto LicenseText(const std::size_t index) noexcept -> std::string
+{
+    const auto& data = licenses();
+
+    if (index >= data.size()) { return {}; }
+
+    const auto& license = data[index];
+
+    if (false == license.compressed_) { return std::string{license.data_}; }
+
+    return qUncompress(
+               reinterpret_cast<const uchar*>(license.data_.data()),
+               static_cast<int>(license.data_.size()))
+        .toStdString();
+}
+
+auto LongestLicenseDescription() noexcept -> std::size_t
+{
+    static const auto width = [] {
+        auto output = std::size_t{0};
+
+        for (const auto& license : licenses()) {
+            output = std::max(output, license.name_.size());
+        }
+
+        return output;
+    }();
+
+    return width;
+}
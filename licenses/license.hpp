@@ -5,12 +5,15 @@
 
 #pragma once
 
-#include <iosfwd>
+#include <cstddef>
 #include <string>
-#include <utility>
-#include <vector>
-
-using LicenseData = std::vector<std::pair<std::string, std::string>>;
+#include <string_view>
 
+// NOTE licenses are ordered by name with the metier license first. Names
+// refer to static data and are valid for the life of the process.
+auto LicenseCount() noexcept -> std::size_t;
+auto LicenseName(const std::size_t index) noexcept -> std::string_view;
+// NOTE the text is decompressed on every call and is empty if the index is
+// out of range
+auto LicenseText(const std::size_t index) noexcept -> std::string;
 auto LongestLicenseDescription() noexcept -> std::size_t;
-auto MetierLicenseData() noexcept -> const LicenseData&;
@@ -1,188 +1,101 @@
-unsigned char lmdb_txt[] = {
-  0x54, 0x68, 0x65, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x4c, 0x44, 0x41, 0x50,
-  0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x32, 0x2e, 0x38, 0x2c, 0x20, 0x31, 0x37, 0x20, 0x41, 0x75,
-  0x67, 0x75, 0x73, 0x74, 0x20, 0x32, 0x30, 0x30, 0x33, 0x0a, 0x0a, 0x52,
-  0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
-  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x28, 0x22, 0x53, 0x6f,
-  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x29, 0x2c, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
-  0x74, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x65, 0x72, 0x6d,
-  0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
-  0x65, 0x64, 0x0a, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f,
-  0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65,
-  0x20, 0x6d, 0x65, 0x74, 0x3a, 0x0a, 0x0a, 0x31, 0x2e, 0x20, 0x52, 0x65,
-  0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
-  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x72, 0x65,
-  0x74, 0x61, 0x69, 0x6e, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x73, 0x2c, 0x0a, 0x0a, 0x32, 0x2e, 0x20, 0x52, 0x65,
-  0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20,
-  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x72, 0x65,
-  0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c,
-  0x69, 0x63, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e,
-  0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e,
-  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69,
-  0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6c, 0x61,
-  0x69, 0x6d, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73,
-  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20,
-  0x61, 0x6e, 0x64, 0x0a, 0x0a, 0x33, 0x2e, 0x20, 0x52, 0x65, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x6d, 0x75, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e,
-  0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x62, 0x61, 0x74, 0x69, 0x6d, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a,
-  0x54, 0x68, 0x65, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x4c, 0x44, 0x41, 0x50,
-  0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x65, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x45, 0x61, 0x63, 0x68, 0x20,
-  0x72, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x68, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x20, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x75, 0x73, 0x65, 0x0a,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x65, 0x0a, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x48, 0x49, 0x53, 0x20, 0x53,
-  0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x49, 0x53, 0x20, 0x50,
-  0x52, 0x4f, 0x56, 0x49, 0x44, 0x45, 0x44, 0x20, 0x42, 0x59, 0x20, 0x54,
-  0x48, 0x45, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x4c, 0x44, 0x41, 0x50, 0x20,
-  0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x41,
-  0x4e, 0x44, 0x20, 0x49, 0x54, 0x53, 0x0a, 0x43, 0x4f, 0x4e, 0x54, 0x52,
-  0x49, 0x42, 0x55, 0x54, 0x4f, 0x52, 0x53, 0x20, 0x60, 0x60, 0x41, 0x53,
-  0x20, 0x49, 0x53, 0x27, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x41, 0x4e,
-  0x59, 0x20, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x45, 0x44, 0x20,
-  0x4f, 0x52, 0x20, 0x49, 0x4d, 0x50, 0x4c, 0x49, 0x45, 0x44, 0x20, 0x57,
-  0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x49, 0x45, 0x53, 0x2c, 0x0a, 0x49,
-  0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x2c, 0x20, 0x42, 0x55,
-  0x54, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x45,
-  0x44, 0x20, 0x54, 0x4f, 0x2c, 0x20, 0x54, 0x48, 0x45, 0x20, 0x49, 0x4d,
-  0x50, 0x4c, 0x49, 0x45, 0x44, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e,
-  0x54, 0x49, 0x45, 0x53, 0x20, 0x4f, 0x46, 0x20, 0x4d, 0x45, 0x52, 0x43,
-  0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x0a,
-  0x41, 0x4e, 0x44, 0x20, 0x46, 0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20,
-  0x46, 0x4f, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43,
-  0x55, 0x4c, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f, 0x53, 0x45,
-  0x20, 0x41, 0x52, 0x45, 0x20, 0x44, 0x49, 0x53, 0x43, 0x4c, 0x41, 0x49,
-  0x4d, 0x45, 0x44, 0x2e, 0x20, 0x20, 0x49, 0x4e, 0x20, 0x4e, 0x4f, 0x20,
-  0x45, 0x56, 0x45, 0x4e, 0x54, 0x0a, 0x53, 0x48, 0x41, 0x4c, 0x4c, 0x20,
-  0x54, 0x48, 0x45, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x4c, 0x44, 0x41, 0x50,
-  0x20, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x2c,
-  0x20, 0x49, 0x54, 0x53, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x52, 0x49, 0x42,
-  0x55, 0x54, 0x4f, 0x52, 0x53, 0x2c, 0x20, 0x4f, 0x52, 0x20, 0x54, 0x48,
-  0x45, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4f, 0x52, 0x28, 0x53, 0x29, 0x0a,
-  0x4f, 0x52, 0x20, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x28, 0x53, 0x29, 0x20,
-  0x4f, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57,
-  0x41, 0x52, 0x45, 0x20, 0x42, 0x45, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x4c,
-  0x45, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x44, 0x49,
-  0x52, 0x45, 0x43, 0x54, 0x2c, 0x20, 0x49, 0x4e, 0x44, 0x49, 0x52, 0x45,
-  0x43, 0x54, 0x2c, 0x0a, 0x49, 0x4e, 0x43, 0x49, 0x44, 0x45, 0x4e, 0x54,
-  0x41, 0x4c, 0x2c, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49, 0x41, 0x4c, 0x2c,
-  0x20, 0x45, 0x58, 0x45, 0x4d, 0x50, 0x4c, 0x41, 0x52, 0x59, 0x2c, 0x20,
-  0x4f, 0x52, 0x20, 0x43, 0x4f, 0x4e, 0x53, 0x45, 0x51, 0x55, 0x45, 0x4e,
-  0x54, 0x49, 0x41, 0x4c, 0x20, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x53,
-  0x20, 0x28, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x2c,
-  0x0a, 0x42, 0x55, 0x54, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4c, 0x49, 0x4d,
-  0x49, 0x54, 0x45, 0x44, 0x20, 0x54, 0x4f, 0x2c, 0x20, 0x50, 0x52, 0x4f,
-  0x43, 0x55, 0x52, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x20, 0x4f, 0x46, 0x20,
-  0x53, 0x55, 0x42, 0x53, 0x54, 0x49, 0x54, 0x55, 0x54, 0x45, 0x20, 0x47,
-  0x4f, 0x4f, 0x44, 0x53, 0x20, 0x4f, 0x52, 0x20, 0x53, 0x45, 0x52, 0x56,
-  0x49, 0x43, 0x45, 0x53, 0x3b, 0x0a, 0x4c, 0x4f, 0x53, 0x53, 0x20, 0x4f,
-  0x46, 0x20, 0x55, 0x53, 0x45, 0x2c, 0x20, 0x44, 0x41, 0x54, 0x41, 0x2c,
-  0x20, 0x4f, 0x52, 0x20, 0x50, 0x52, 0x4f, 0x46, 0x49, 0x54, 0x53, 0x3b,
-  0x20, 0x4f, 0x52, 0x20, 0x42, 0x55, 0x53, 0x49, 0x4e, 0x45, 0x53, 0x53,
-  0x20, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x52, 0x55, 0x50, 0x54, 0x49, 0x4f,
-  0x4e, 0x29, 0x20, 0x48, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x52, 0x0a, 0x43,
-  0x41, 0x55, 0x53, 0x45, 0x44, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x4f, 0x4e,
-  0x20, 0x41, 0x4e, 0x59, 0x20, 0x54, 0x48, 0x45, 0x4f, 0x52, 0x59, 0x20,
-  0x4f, 0x46, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59,
-  0x2c, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 0x52, 0x20, 0x49, 0x4e,
-  0x20, 0x43, 0x4f, 0x4e, 0x54, 0x52, 0x41, 0x43, 0x54, 0x2c, 0x20, 0x53,
-  0x54, 0x52, 0x49, 0x43, 0x54, 0x0a, 0x4c, 0x49, 0x41, 0x42, 0x49, 0x4c,
-  0x49, 0x54, 0x59, 0x2c, 0x20, 0x4f, 0x52, 0x20, 0x54, 0x4f, 0x52, 0x54,
-  0x20, 0x28, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20,
-  0x4e, 0x45, 0x47, 0x4c, 0x49, 0x47, 0x45, 0x4e, 0x43, 0x45, 0x20, 0x4f,
-  0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x57, 0x49, 0x53, 0x45, 0x29,
-  0x20, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x49, 0x4e, 0x0a,
-  0x41, 0x4e, 0x59, 0x20, 0x57, 0x41, 0x59, 0x20, 0x4f, 0x55, 0x54, 0x20,
-  0x4f, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4f,
-  0x46, 0x20, 0x54, 0x48, 0x49, 0x53, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57,
-  0x41, 0x52, 0x45, 0x2c, 0x20, 0x45, 0x56, 0x45, 0x4e, 0x20, 0x49, 0x46,
-  0x20, 0x41, 0x44, 0x56, 0x49, 0x53, 0x45, 0x44, 0x20, 0x4f, 0x46, 0x20,
-  0x54, 0x48, 0x45, 0x0a, 0x50, 0x4f, 0x53, 0x53, 0x49, 0x42, 0x49, 0x4c,
-  0x49, 0x54, 0x59, 0x20, 0x4f, 0x46, 0x20, 0x53, 0x55, 0x43, 0x48, 0x20,
-  0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65,
-  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
-  0x20, 0x69, 0x6e, 0x0a, 0x61, 0x64, 0x76, 0x65, 0x72, 0x74, 0x69, 0x73,
-  0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
-  0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x6d,
-  0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6c, 0x65,
-  0x2c, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x64, 0x65, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x0a, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77,
-  0x61, 0x72, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20,
-  0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2c, 0x20, 0x77, 0x72,
-  0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x20,
-  0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x20,
-  0x20, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x0a, 0x74, 0x6f, 0x20, 0x63, 0x6f,
-  0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6c,
-  0x6c, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x72, 0x65, 0x6d, 0x61,
-  0x69, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x79,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x0a, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72,
-  0x73, 0x2e, 0x0a, 0x0a, 0x4f, 0x70, 0x65, 0x6e, 0x4c, 0x44, 0x41, 0x50,
-  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74,
-  0x65, 0x72, 0x65, 0x64, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61,
-  0x72, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4f, 0x70,
-  0x65, 0x6e, 0x4c, 0x44, 0x41, 0x50, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x43, 0x6f, 0x70, 0x79,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x31, 0x39, 0x39, 0x39, 0x2d, 0x32,
-  0x30, 0x30, 0x33, 0x20, 0x54, 0x68, 0x65, 0x20, 0x4f, 0x70, 0x65, 0x6e,
-  0x4c, 0x44, 0x41, 0x50, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x65, 0x64, 0x77, 0x6f, 0x6f, 0x64,
-  0x20, 0x43, 0x69, 0x74, 0x79, 0x2c, 0x0a, 0x43, 0x61, 0x6c, 0x69, 0x66,
-  0x6f, 0x72, 0x6e, 0x69, 0x61, 0x2c, 0x20, 0x55, 0x53, 0x41, 0x2e, 0x20,
-  0x20, 0x41, 0x6c, 0x6c, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20,
-  0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 0x20, 0x50,
-  0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f,
-  0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x72,
-  0x62, 0x61, 0x74, 0x69, 0x6d, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x63,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x61,
-  0x6e, 0x74, 0x65, 0x64, 0x2e, 0x0a
+// NOTE compressed copy of txt/lmdb.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char lmdb_txt[] = {
+  0x00, 0x00, 0x08, 0xa6, 0x78, 0xda, 0x75, 0x55, 0xcb, 0x72, 0xdb, 0x38,
+  0x10, 0xbc, 0xe3, 0x2b, 0xa6, 0x72, 0x49, 0x5c, 0xc5, 0xf5, 0xe6, 0x71,
+  0xd8, 0xcd, 0xe6, 0x04, 0x51, 0xb0, 0x85, 0x2a, 0x9a, 0xd4, 0x02, 0xa0,
+  0x1d, 0xdf, 0x02, 0x89, 0xb0, 0x85, 0x5a, 0x92, 0xd0, 0x12, 0xa4, 0x5d,
+  0xfe, 0xfb, 0xcc, 0x40, 0x4f, 0x97, 0x93, 0x93, 0x28, 0x62, 0x1e, 0xdd,
+  0x8d, 0x61, 0x8f, 0xd9, 0x38, 0xa8, 0xb6, 0xae, 0x2f, 0xe6, 0x7c, 0x09,
+  0xcb, 0x69, 0xd5, 0xfa, 0x35, 0x14, 0x7e, 0xed, 0xfa, 0xe8, 0x18, 0xc0,
+  0xad, 0x1b, 0xa2, 0x0f, 0x3d, 0x7c, 0xbe, 0xfc, 0x3b, 0x83, 0x4f, 0x7f,
+  0x01, 0x9f, 0x1e, 0xa7, 0x38, 0xc2, 0xe7, 0x8f, 0x1f, 0xbf, 0x30, 0xa6,
+  0x5c, 0xe3, 0xe3, 0x38, 0xf8, 0xd5, 0x34, 0x52, 0x8c, 0xed, 0x1b, 0x98,
+  0xa2, 0x83, 0xf0, 0x00, 0xe3, 0xc6, 0x47, 0x88, 0xe1, 0x61, 0x7c, 0xb6,
+  0x83, 0x4b, 0x07, 0x36, 0xc6, 0xb0, 0xf6, 0x76, 0x74, 0x0d, 0x34, 0x61,
+  0x3d, 0x75, 0xae, 0x1f, 0x2d, 0x65, 0xb1, 0x0f, 0xef, 0xf4, 0x3e, 0xee,
+  0xdd, 0x45, 0x06, 0xcf, 0x7e, 0xdc, 0x40, 0x18, 0xd2, 0x6f, 0x98, 0x46,
+  0xe8, 0x42, 0xe3, 0x1f, 0xfc, 0x3a, 0x85, 0x66, 0x40, 0xc5, 0xb6, 0x6e,
+  0xe8, 0xfc, 0x48, 0x75, 0xb6, 0x43, 0x78, 0xf2, 0x8d, 0x6b, 0xd8, 0xb8,
+  0xb1, 0x23, 0xb6, 0x74, 0xf0, 0x10, 0xda, 0x36, 0x3c, 0xfb, 0xfe, 0x11,
+  0xd6, 0xa1, 0x6f, 0x3c, 0x25, 0xc5, 0x94, 0xd4, 0xb9, 0xf1, 0x1f, 0xc6,
+  0x3e, 0x5d, 0xc2, 0x6b, 0xc8, 0x11, 0x7c, 0x8f, 0x30, 0xa7, 0x61, 0x4d,
+  0xb9, 0x43, 0x07, 0x1d, 0x91, 0x1b, 0xdc, 0x68, 0xf1, 0xfd, 0x3a, 0x6c,
+  0x5f, 0x06, 0xff, 0xb8, 0x19, 0x21, 0x22, 0x54, 0x47, 0x88, 0x23, 0x2a,
+  0x92, 0xd8, 0xf4, 0x61, 0x44, 0x89, 0x62, 0xc6, 0xd8, 0xe7, 0x5f, 0xd6,
+  0x5c, 0xf9, 0xde, 0x0e, 0x2f, 0xaf, 0x6a, 0x22, 0xda, 0x66, 0xc2, 0x3e,
+  0x76, 0xbb, 0x45, 0x89, 0xed, 0xaa, 0x75, 0xa7, 0x0e, 0x54, 0xf6, 0xd4,
+  0xe4, 0x55, 0x87, 0x9d, 0x94, 0x2d, 0x36, 0x20, 0x5d, 0x4f, 0xb4, 0xb2,
+  0x14, 0xf5, 0x8a, 0x34, 0x55, 0x41, 0x24, 0xeb, 0xd6, 0xfa, 0xce, 0x0d,
+  0x04, 0x83, 0x8e, 0x5f, 0xa9, 0x4d, 0x49, 0x7f, 0xa2, 0xbc, 0x01, 0x4f,
+  0x06, 0xe8, 0xb0, 0xe3, 0xe0, 0x6d, 0x1b, 0x4f, 0x52, 0x62, 0x89, 0x74,
+  0x05, 0x29, 0xf3, 0x8c, 0x55, 0x6a, 0xc7, 0xd8, 0x97, 0xb7, 0x6c, 0x13,
+  0x3d, 0xc4, 0x95, 0x34, 0xb3, 0xf0, 0xe4, 0x86, 0x15, 0xb6, 0xea, 0x12,
+  0xb9, 0xe3, 0x28, 0x1c, 0x40, 0x5c, 0x32, 0x66, 0xce, 0xe7, 0xed, 0x2a,
+  0x4c, 0x7d, 0xb3, 0x43, 0xd6, 0xd9, 0x17, 0x54, 0xe9, 0xc9, 0xe3, 0x00,
+  0xed, 0x29, 0xa7, 0x19, 0x84, 0x87, 0x21, 0x74, 0x80, 0x05, 0xf1, 0x75,
+  0x48, 0xbf, 0x97, 0x4c, 0xd8, 0xf5, 0x66, 0x17, 0x4b, 0x89, 0x54, 0x1e,
+  0x11, 0xa1, 0x00, 0x93, 0x8f, 0x1b, 0x9c, 0x8b, 0xd5, 0xcb, 0x0e, 0x47,
+  0x3a, 0xed, 0xa7, 0x6e, 0xe5, 0x86, 0x4b, 0x80, 0xfb, 0x30, 0xa5, 0x1e,
+  0x38, 0xa1, 0x2c, 0x35, 0x38, 0x8c, 0x1d, 0x20, 0x04, 0x14, 0x03, 0xa5,
+  0xe8, 0xe2, 0x11, 0xf0, 0xa1, 0xfb, 0xb1, 0x0b, 0x8a, 0xb6, 0x8f, 0xdb,
+  0x60, 0xfe, 0x21, 0xd6, 0xf6, 0x2f, 0x10, 0xa7, 0x55, 0x74, 0xff, 0x4f,
+  0xc8, 0xee, 0x2c, 0xfa, 0x21, 0x29, 0xb8, 0xaf, 0x42, 0xac, 0x17, 0x52,
+  0x83, 0xae, 0xae, 0xcc, 0x1d, 0x57, 0x02, 0xf0, 0x79, 0xa9, 0xaa, 0x5b,
+  0x39, 0x17, 0x73, 0x98, 0xdd, 0x83, 0x59, 0x08, 0xa8, 0x96, 0xa2, 0xdc,
+  0x49, 0x52, 0xd5, 0xe5, 0x9c, 0x1b, 0x59, 0x95, 0xc0, 0xcb, 0x39, 0x48,
+  0xa3, 0x59, 0x5e, 0x95, 0x46, 0xc9, 0x59, 0x6d, 0x2a, 0xa5, 0xe1, 0xc7,
+  0x0f, 0xae, 0xb1, 0xc0, 0xfb, 0xf7, 0xe9, 0x98, 0x97, 0xf7, 0x20, 0xbe,
+  0x2f, 0x95, 0xd0, 0x1a, 0x6b, 0x55, 0x0a, 0xe4, 0xcd, 0xb2, 0x90, 0xf8,
+  0x88, 0x7d, 0x14, 0x2f, 0x8d, 0x14, 0x3a, 0x63, 0xb2, 0xcc, 0x8b, 0x7a,
+  0x2e, 0xcb, 0xeb, 0x0c, 0xb0, 0x08, 0x94, 0x95, 0x81, 0x42, 0xde, 0x48,
+  0x83, 0x61, 0xa6, 0xca, 0x52, 0xfb, 0xb7, 0x69, 0x50, 0x5d, 0xc1, 0x8d,
+  0x50, 0xf9, 0x02, 0xff, 0xf2, 0x99, 0x2c, 0xa4, 0xb9, 0x67, 0xd4, 0xf1,
+  0x4a, 0x9a, 0x12, 0xbb, 0x21, 0x4e, 0x05, 0x1c, 0x96, 0x5c, 0x19, 0x99,
+  0xd7, 0x05, 0x57, 0xb0, 0xac, 0xd5, 0xb2, 0xd2, 0x02, 0x88, 0xe0, 0x5c,
+  0xea, 0xbc, 0xe0, 0xf2, 0x46, 0xcc, 0x51, 0x79, 0x59, 0x62, 0x4b, 0x10,
+  0xb7, 0xa2, 0x34, 0x4c, 0x2f, 0x78, 0x51, 0xfc, 0x8e, 0x70, 0x46, 0x6c,
+  0xe1, 0x9c, 0x6d, 0x46, 0x94, 0x28, 0x9a, 0xd7, 0x66, 0x51, 0xa9, 0x0f,
+  0xfa, 0x82, 0xe1, 0x8b, 0xea, 0xae, 0x14, 0xf4, 0x4c, 0x10, 0xe9, 0xf0,
+  0xa8, 0xeb, 0x4c, 0x20, 0x31, 0x3e, 0x2b, 0xc4, 0x0e, 0x1d, 0x6a, 0x33,
+  0x97, 0x4a, 0xe4, 0x06, 0x0b, 0x97, 0xfb, 0x27, 0x12, 0x03, 0x75, 0x47,
+  0x4e, 0x45, 0x06, 0x7a, 0x29, 0x72, 0x49, 0x0f, 0xe2, 0xbb, 0x40, 0x01,
+  0xb8, 0xba, 0x4f, 0x0d, 0x11, 0x81, 0x16, 0xff, 0xd6, 0x18, 0x84, 0x87,
+  0x30, 0xe7, 0x37, 0xfc, 0x1a, 0xf5, 0xf8, 0x70, 0x92, 0x91, 0xfd, 0x4a,
+  0x46, 0xbc, 0xd1, 0xbc, 0x56, 0xe2, 0x06, 0xd3, 0x08, 0x98, 0xae, 0x67,
+  0xda, 0x48, 0x53, 0x1b, 0x01, 0xd7, 0x55, 0x35, 0xd7, 0x54, 0x58, 0x0b,
+  0x75, 0x2b, 0x73, 0xa1, 0xbf, 0xb1, 0xa2, 0xd2, 0x49, 0xe1, 0x5a, 0x8b,
+  0x0c, 0x3b, 0x18, 0x9e, 0x1a, 0x63, 0x09, 0x94, 0x57, 0x7f, 0xa3, 0xe7,
+  0x59, 0xad, 0x65, 0x12, 0x5a, 0x96, 0x46, 0x28, 0x55, 0x2f, 0x49, 0xa1,
+  0x0b, 0x58, 0x54, 0x77, 0xa8, 0xa4, 0x62, 0x39, 0xaf, 0xe9, 0xc6, 0xe9,
+  0x46, 0xd2, 0xa4, 0xa4, 0x29, 0xaa, 0xd4, 0x3d, 0x15, 0x25, 0x0d, 0xd2,
+  0x85, 0x65, 0x70, 0xb7, 0x10, 0xf8, 0x5e, 0xd1, 0x1d, 0x24, 0x5d, 0x39,
+  0x89, 0xa1, 0x51, 0xdf, 0xdc, 0xb0, 0xb3, 0x30, 0x52, 0xb9, 0x52, 0xe6,
+  0x8c, 0x23, 0x94, 0xe2, 0xba, 0x90, 0xd7, 0xa2, 0xcc, 0x05, 0x9d, 0x56,
+  0x54, 0xe5, 0x4e, 0x6a, 0x71, 0x81, 0xf7, 0x2b, 0x35, 0x05, 0xc8, 0x92,
+  0x51, 0xdb, 0x3b, 0x8e, 0x3d, 0x6b, 0x73, 0xb8, 0x0b, 0x44, 0xb5, 0x7b,
+  0x3c, 0x9b, 0xf7, 0x2c, 0x5d, 0x3e, 0xc8, 0x2b, 0xe0, 0xf3, 0x5b, 0x99,
+  0x06, 0x35, 0x05, 0x33, 0x9c, 0x17, 0x2d, 0x77, 0x18, 0x76, 0x92, 0xe5,
+  0x8b, 0xbd, 0xdc, 0x7b, 0xa3, 0xe8, 0x6d, 0xe7, 0xe2, 0xe1, 0x6b, 0xb2,
+  0x13, 0xee, 0x84, 0x61, 0x67, 0x8f, 0x27, 0x73, 0xde, 0x84, 0x16, 0x3f,
+  0xcb, 0xbd, 0x0f, 0xa1, 0x6b, 0xc2, 0xca, 0xd1, 0x37, 0xde, 0xa0, 0xff,
+  0x31, 0xdb, 0xa0, 0x0d, 0x8c, 0xf8, 0x49, 0xe2, 0x46, 0x38, 0xb8, 0xde,
+  0x73, 0x72, 0x98, 0x40, 0x96, 0xd7, 0x85, 0xd1, 0xa5, 0xca, 0xd1, 0xb6,
+  0x2e, 0xdb, 0xed, 0xae, 0x83, 0x37, 0x36, 0xce, 0xb6, 0xe4, 0xa9, 0xc9,
+  0x45, 0xcf, 0xdd, 0xe2, 0xb0, 0x99, 0xe2, 0xd6, 0xad, 0x69, 0x35, 0xe1,
+  0xce, 0x1a, 0x68, 0x1f, 0xf5, 0x58, 0xd1, 0x63, 0x7a, 0xda, 0x4f, 0x91,
+  0x5c, 0x00, 0x47, 0xdf, 0xf8, 0xb1, 0x45, 0xbb, 0x08, 0x67, 0x78, 0xdf,
+  0x14, 0x8c, 0x1b, 0xdb, 0xb6, 0x80, 0x1b, 0x8c, 0x7e, 0xc8, 0xe0, 0x22,
+  0xfa, 0x48, 0x47, 0x6e, 0x9a, 0x9c, 0xf8, 0xb4, 0x24, 0xf6, 0x4c, 0x51,
+  0x9a, 0xa3, 0x7f, 0x62, 0x1d, 0x8b, 0xd1, 0x8f, 0xe8, 0x7f, 0x6e, 0x40,
+  0xce, 0xe3, 0x60, 0x1b, 0xcc, 0x1d, 0xfe, 0x3b, 0x68, 0xf6, 0x0b, 0xa7,
+  0xc5, 0xfc, 0xfc, 0x88, 0xe6, 0xd3, 0xd7, 0xaf, 0x5f, 0xff, 0xa0, 0x6d,
+  0x0e, 0xbf, 0xf1, 0xe5, 0x8c, 0x0c, 0xff, 0x39, 0x84, 0x06, 0x72, 0x3f,
+  0xbe, 0x64, 0x2c, 0x47, 0x59, 0x70, 0xad, 0xf5, 0xde, 0x66, 0x78, 0xd7,
+  0x1c, 0x39, 0x72, 0x84, 0xad, 0xa8, 0x58, 0xc4, 0xd0, 0xe8, 0x86, 0x27,
+  0xd7, 0xe0, 0xdb, 0xe5, 0x51, 0x06, 0xd8, 0xd3, 0x4f, 0x1b, 0xe4, 0xb8,
+  0x3b, 0xdc, 0xab, 0x4d, 0xe1, 0x5d, 0x7c, 0xb3, 0x2b, 0x88, 0xdc, 0xe3,
+  0x60, 0x7b, 0x5c, 0xf5, 0x97, 0xec, 0x27, 0x74, 0x36, 0xcb, 0x5e
 };
-unsigned int lmdb_txt_len = 2214;
+static constexpr unsigned int lmdb_txt_len = 1139;
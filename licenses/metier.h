@@ -1,1397 +1,448 @@
-unsigned char LICENSE[] = {
-  0x4d, 0x6f, 0x7a, 0x69, 0x6c, 0x6c, 0x61, 0x20, 0x50, 0x75, 0x62, 0x6c,
-  0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x56,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x30, 0x0a, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x31,
-  0x2e, 0x20, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x2e, 0x20, 0x22,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x22,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x65,
-  0x61, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75,
-  0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20,
-  0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x6f, 0x72, 0x20,
-  0x6f, 0x77, 0x6e, 0x73, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a,
-  0x31, 0x2e, 0x32, 0x2e, 0x20, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20,
-  0x28, 0x69, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x29, 0x20, 0x75, 0x73, 0x65,
-  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74,
-  0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x27, 0x73, 0x20, 0x43, 0x6f, 0x6e,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a,
-  0x31, 0x2e, 0x33, 0x2e, 0x20, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6f,
-  0x66, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c,
-  0x61, 0x72, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x34, 0x2e, 0x20, 0x22, 0x43,
-  0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77,
-  0x61, 0x72, 0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61,
-  0x6e, 0x73, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x77,
-  0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x69,
-  0x74, 0x69, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x74, 0x74,
-  0x61, 0x63, 0x68, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20,
-  0x45, 0x78, 0x68, 0x69, 0x62, 0x69, 0x74, 0x20, 0x41, 0x2c, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x2c,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x20,
-  0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
-  0x72, 0x65, 0x6f, 0x66, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x35, 0x2e, 0x20,
-  0x22, 0x49, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c,
-  0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x53, 0x65, 0x63, 0x6f, 0x6e,
-  0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x73, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x29, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69,
-  0x61, 0x6c, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63,
-  0x68, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69,
-  0x63, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x20,
-  0x45, 0x78, 0x68, 0x69, 0x62, 0x69, 0x74, 0x20, 0x42, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x3b, 0x20, 0x6f,
-  0x72, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x29, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65,
-  0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x77, 0x61, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x61, 0x76,
-  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20,
-  0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x6f,
-  0x72, 0x20, 0x65, 0x61, 0x72, 0x6c, 0x69, 0x65, 0x72, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c,
-  0x73, 0x6f, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x72,
-  0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x53, 0x65, 0x63, 0x6f,
-  0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x36, 0x2e, 0x20, 0x22, 0x45, 0x78,
-  0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x46, 0x6f, 0x72,
-  0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x74,
-  0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x53, 0x6f, 0x75,
-  0x72, 0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72,
-  0x6d, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x37, 0x2e, 0x20, 0x22, 0x4c, 0x61,
-  0x72, 0x67, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x22, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x77,
-  0x6f, 0x72, 0x6b, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d,
-  0x62, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x77,
-  0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6d, 0x61,
-  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x69, 0x6e, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
-  0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x69,
-  0x6c, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a,
-  0x31, 0x2e, 0x38, 0x2e, 0x20, 0x22, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x39, 0x2e, 0x20, 0x22, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x68, 0x61, 0x76,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x2c, 0x20,
-  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d,
-  0x75, 0x6d, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x6f,
-  0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x74, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x67,
-  0x72, 0x61, 0x6e, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73,
-  0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x2c, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c,
-  0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x65, 0x64,
-  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x30, 0x2e,
-  0x20, 0x22, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61,
-  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x29, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f,
-  0x72, 0x6d, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75,
-  0x6c, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6e, 0x20,
-  0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x2c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6c,
-  0x65, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20,
-  0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43,
-  0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x3b,
-  0x20, 0x6f, 0x72, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x29,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6c,
-  0x65, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
-  0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x6f, 0x66, 0x74,
-  0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x31, 0x2e,
-  0x20, 0x22, 0x50, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x43, 0x6c, 0x61,
-  0x69, 0x6d, 0x73, 0x22, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20,
-  0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d,
-  0x28, 0x73, 0x29, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69,
-  0x6e, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x6c,
-  0x69, 0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6d,
-  0x65, 0x74, 0x68, 0x6f, 0x64, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70,
-  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x61, 0x70, 0x70, 0x61, 0x72, 0x61, 0x74, 0x75, 0x73, 0x20, 0x63, 0x6c,
-  0x61, 0x69, 0x6d, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x66,
-  0x72, 0x69, 0x6e, 0x67, 0x65, 0x64, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x6e,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x62, 0x79,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x2c,
-  0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x6c,
-  0x69, 0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72, 0x69, 0x6e,
-  0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x61, 0x6c, 0x65, 0x2c, 0x20,
-  0x68, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x61, 0x64, 0x65, 0x2c, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72,
-  0x20, 0x6f, 0x66, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69,
-  0x74, 0x73, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x6f, 0x72, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e,
-  0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x32, 0x2e, 0x20, 0x22, 0x53, 0x65, 0x63,
-  0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e,
-  0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
-  0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x32, 0x2e, 0x30, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e,
-  0x55, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72,
-  0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62,
-  0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x31,
-  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x41, 0x66,
-  0x66, 0x65, 0x72, 0x6f, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x56, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x30, 0x2c, 0x20, 0x6f, 0x72,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x6f, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x33,
-  0x2e, 0x20, 0x22, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
-  0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
-  0x6f, 0x72, 0x6b, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65,
-  0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x6b, 0x69, 0x6e, 0x67,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x20, 0x22,
-  0x59, 0x6f, 0x75, 0x22, 0x20, 0x28, 0x6f, 0x72, 0x20, 0x22, 0x59, 0x6f,
-  0x75, 0x72, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61,
-  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69,
-  0x64, 0x75, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x6c, 0x65,
-  0x67, 0x61, 0x6c, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x65,
-  0x78, 0x65, 0x72, 0x63, 0x69, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x6c, 0x65, 0x67,
-  0x61, 0x6c, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2c,
-  0x20, 0x22, 0x59, 0x6f, 0x75, 0x22, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-  0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x65, 0x6e, 0x74, 0x69,
-  0x74, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x2c, 0x20, 0x69, 0x73,
-  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x59, 0x6f, 0x75, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72,
-  0x6f, 0x6c, 0x22, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x28, 0x61,
-  0x29, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2c,
-  0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c,
-  0x20, 0x74, 0x6f, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x72, 0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x6d, 0x65, 0x6e,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x65, 0x6e,
-  0x74, 0x69, 0x74, 0x79, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68,
-  0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 0x6e,
-  0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x28,
-  0x62, 0x29, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70,
-  0x20, 0x6f, 0x66, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61,
-  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x66, 0x74, 0x79, 0x20,
-  0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x20, 0x28, 0x35, 0x30, 0x25,
-  0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74,
-  0x73, 0x74, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x61,
-  0x72, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x65, 0x6e, 0x65, 0x66,
-  0x69, 0x63, 0x69, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x77,
-  0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x73,
-  0x75, 0x63, 0x68, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x2e, 0x0a,
-  0x0a, 0x32, 0x2e, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x47, 0x72, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43,
-  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x32, 0x2e, 0x31, 0x2e,
-  0x20, 0x47, 0x72, 0x61, 0x6e, 0x74, 0x73, 0x0a, 0x0a, 0x45, 0x61, 0x63,
-  0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f,
-  0x72, 0x20, 0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x67, 0x72, 0x61,
-  0x6e, 0x74, 0x73, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x61, 0x20, 0x77, 0x6f,
-  0x72, 0x6c, 0x64, 0x2d, 0x77, 0x69, 0x64, 0x65, 0x2c, 0x20, 0x72, 0x6f,
-  0x79, 0x61, 0x6c, 0x74, 0x79, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x2c, 0x0a,
-  0x6e, 0x6f, 0x6e, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x76,
-  0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x3a, 0x0a, 0x0a,
-  0x28, 0x61, 0x29, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6e,
-  0x74, 0x65, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x70,
-  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x73, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x61, 0x6e, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x72,
-  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x74,
-  0x6f, 0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f,
-  0x64, 0x75, 0x63, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x61,
-  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x2c, 0x20, 0x64, 0x69,
-  0x73, 0x70, 0x6c, 0x61, 0x79, 0x2c, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f,
-  0x72, 0x6d, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65,
-  0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x69,
-  0x74, 0x20, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
-  0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x61,
-  0x6e, 0x20, 0x75, 0x6e, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
-  0x20, 0x62, 0x61, 0x73, 0x69, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61,
-  0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20,
-  0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x3b,
-  0x20, 0x61, 0x6e, 0x64, 0x0a, 0x0a, 0x28, 0x62, 0x29, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x50, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x43,
-  0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f,
-  0x72, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x2c, 0x20, 0x75,
-  0x73, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x6c, 0x2c, 0x20, 0x6f, 0x66,
-  0x66, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x73, 0x61, 0x6c, 0x65, 0x2c, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6d,
-  0x61, 0x64, 0x65, 0x2c, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2c,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
-  0x73, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72, 0x20,
-  0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x74, 0x73, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20,
-  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x32, 0x2e,
-  0x32, 0x2e, 0x20, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65,
-  0x20, 0x44, 0x61, 0x74, 0x65, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e,
-  0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x72, 0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x0a, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x65,
-  0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x66,
-  0x69, 0x72, 0x73, 0x74, 0x0a, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a,
-  0x0a, 0x32, 0x2e, 0x33, 0x2e, 0x20, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x47, 0x72, 0x61,
-  0x6e, 0x74, 0x20, 0x53, 0x63, 0x6f, 0x70, 0x65, 0x0a, 0x0a, 0x54, 0x68,
-  0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x20, 0x67,
-  0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x32,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 0x6c,
-  0x79, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x67, 0x72, 0x61,
-  0x6e, 0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x0a, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e,
-  0x20, 0x4e, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x6f, 0x72,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x20, 0x77, 0x69,
-  0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65,
-  0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x64,
-  0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x72, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x69, 0x6e, 0x67,
-  0x20, 0x6f, 0x66, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20,
-  0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x4e, 0x6f, 0x74, 0x77, 0x69, 0x74, 0x68,
-  0x73, 0x74, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x31, 0x28, 0x62, 0x29, 0x20,
-  0x61, 0x62, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x6e, 0x6f, 0x20, 0x70, 0x61,
-  0x74, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x20, 0x61, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x6f, 0x72, 0x3a, 0x0a, 0x0a, 0x28, 0x61, 0x29, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x72,
-  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
-  0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74,
-  0x77, 0x61, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72,
-  0x0a, 0x0a, 0x28, 0x62, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e,
-  0x66, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20,
-  0x63, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x3a, 0x20, 0x28,
-  0x69, 0x29, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x69, 0x72, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x27, 0x73, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x6f, 0x76,
-  0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x69, 0x29, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
-  0x28, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x61, 0x73, 0x20, 0x70,
-  0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x3b,
-  0x20, 0x6f, 0x72, 0x0a, 0x0a, 0x28, 0x63, 0x29, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x20, 0x50, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x43, 0x6c,
-  0x61, 0x69, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x66, 0x72, 0x69, 0x6e, 0x67,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x73, 0x65, 0x6e, 0x63,
-  0x65, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x73,
-  0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b,
-  0x73, 0x2c, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6d,
-  0x61, 0x72, 0x6b, 0x73, 0x2c, 0x0a, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x67,
-  0x6f, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x28, 0x65,
-  0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x61, 0x73, 0x20, 0x6d, 0x61, 0x79,
-  0x20, 0x62, 0x65, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72,
-  0x79, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x79, 0x20,
-  0x77, 0x69, 0x74, 0x68, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d,
-  0x65, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x34, 0x29, 0x2e, 0x0a, 0x0a, 0x32,
-  0x2e, 0x34, 0x2e, 0x20, 0x53, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75, 0x65,
-  0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x0a,
-  0x0a, 0x4e, 0x6f, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x61, 0x64,
-  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x67, 0x72, 0x61,
-  0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73,
-  0x75, 0x6c, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20,
-  0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x0a, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66,
-  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x61, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x31, 0x30, 0x2e, 0x32, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72,
-  0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x53, 0x65, 0x63, 0x6f,
-  0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x28, 0x69, 0x66, 0x0a, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74,
-  0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x53,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x33, 0x29, 0x2e,
-  0x0a, 0x0a, 0x32, 0x2e, 0x35, 0x2e, 0x20, 0x52, 0x65, 0x70, 0x72, 0x65,
-  0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x0a, 0x45,
-  0x61, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
-  0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20,
-  0x62, 0x65, 0x6c, 0x69, 0x65, 0x76, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73,
-  0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f,
-  0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x69,
-  0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63,
-  0x69, 0x65, 0x6e, 0x74, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a,
-  0x74, 0x6f, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x69,
-  0x74, 0x73, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x32, 0x2e, 0x36, 0x2e,
-  0x20, 0x46, 0x61, 0x69, 0x72, 0x20, 0x55, 0x73, 0x65, 0x0a, 0x0a, 0x54,
-  0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x6e,
-  0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x0a, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x64, 0x6f, 0x63, 0x74, 0x72, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x66, 0x61, 0x69, 0x72, 0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x66,
-  0x61, 0x69, 0x72, 0x20, 0x64, 0x65, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x0a, 0x65, 0x71,
-  0x75, 0x69, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 0x0a,
-  0x32, 0x2e, 0x37, 0x2e, 0x20, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x0a, 0x0a, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x33, 0x2e, 0x31, 0x2c, 0x20, 0x33, 0x2e, 0x32, 0x2c, 0x20,
-  0x33, 0x2e, 0x33, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x33, 0x2e, 0x34,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e,
-  0x74, 0x65, 0x64, 0x0a, 0x69, 0x6e, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x31, 0x2e, 0x0a, 0x0a, 0x33, 0x2e, 0x20,
-  0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69,
-  0x74, 0x69, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x0a, 0x0a, 0x33, 0x2e, 0x31, 0x2e, 0x20, 0x44, 0x69, 0x73, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x53,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x0a, 0x0a,
-  0x41, 0x6c, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x6f, 0x76, 0x65,
-  0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43,
-  0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x0a,
-  0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x63,
-  0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x74, 0x6f, 0x20,
-  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x63, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x2c, 0x20, 0x6d, 0x75,
-  0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x0a,
-  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20,
-  0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70,
-  0x69, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x0a, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53,
-  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x67,
-  0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68,
-  0x65, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6f, 0x62, 0x74, 0x61, 0x69,
-  0x6e, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6e, 0x6f,
-  0x74, 0x0a, 0x61, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74, 0x20, 0x74, 0x6f,
-  0x20, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65,
-  0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-  0x65, 0x63, 0x69, 0x70, 0x69, 0x65, 0x6e, 0x74, 0x73, 0x27, 0x20, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65,
-  0x0a, 0x46, 0x6f, 0x72, 0x6d, 0x2e, 0x0a, 0x0a, 0x33, 0x2e, 0x32, 0x2e,
-  0x20, 0x44, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x0a, 0x0a, 0x49, 0x66,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20,
-  0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20,
-  0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x46,
-  0x6f, 0x72, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x3a, 0x0a, 0x0a, 0x28,
-  0x61, 0x29, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x76, 0x65,
-  0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x62,
-  0x65, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x46, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x73,
-  0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x31, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20,
-  0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70,
-  0x69, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x68, 0x6f, 0x77,
-  0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6f, 0x62,
-  0x74, 0x61, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20,
-  0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x53, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x46, 0x6f, 0x72, 0x6d, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x61, 0x73,
-  0x6f, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73,
-  0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x6c, 0x79,
-  0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2c, 0x20, 0x61, 0x74, 0x20,
-  0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x20, 0x6e, 0x6f, 0x20,
-  0x6d, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x61,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x6f,
-  0x66, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
-  0x63, 0x69, 0x70, 0x69, 0x65, 0x6e, 0x74, 0x3b, 0x20, 0x61, 0x6e, 0x64,
-  0x0a, 0x0a, 0x28, 0x62, 0x29, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61,
-  0x79, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6f,
-  0x72, 0x20, 0x73, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x69, 0x74, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x64, 0x69,
-  0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x64, 0x6f, 0x65,
-  0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x74, 0x74, 0x65, 0x6d, 0x70,
-  0x74, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x20, 0x6f,
-  0x72, 0x20, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70, 0x69, 0x65, 0x6e,
-  0x74, 0x73, 0x27, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
-  0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x33, 0x2e, 0x33, 0x2e,
-  0x20, 0x44, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x4c, 0x61, 0x72, 0x67, 0x65,
-  0x72, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x65, 0x20, 0x61, 0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65,
-  0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20,
-  0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x2c, 0x0a, 0x70, 0x72, 0x6f, 0x76,
-  0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x59, 0x6f,
-  0x75, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c,
-  0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-  0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x74, 0x68, 0x65, 0x20,
-  0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74,
-  0x77, 0x61, 0x72, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x6f, 0x76,
-  0x65, 0x72, 0x65, 0x64, 0x0a, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72,
-  0x65, 0x20, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69,
-  0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x6d, 0x70,
-  0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20,
-  0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x70, 0x65, 0x72,
-  0x6d, 0x69, 0x74, 0x73, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x74, 0x6f, 0x20,
-  0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79,
-  0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x0a, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x53, 0x65,
-  0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x28, 0x73, 0x29, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x69,
-  0x70, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x6d, 0x61, 0x79, 0x2c, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x69, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x66,
-  0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x0a, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x69,
-  0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x0a,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x28, 0x73, 0x29, 0x2e, 0x0a,
-  0x0a, 0x33, 0x2e, 0x34, 0x2e, 0x20, 0x4e, 0x6f, 0x74, 0x69, 0x63, 0x65,
-  0x73, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72,
-  0x20, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-  0x75, 0x62, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x0a, 0x28, 0x69, 0x6e, 0x63,
-  0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73,
-  0x2c, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x73, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6c, 0x61,
-  0x69, 0x6d, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61, 0x72,
-  0x72, 0x61, 0x6e, 0x74, 0x79, 0x2c, 0x0a, 0x6f, 0x72, 0x20, 0x6c, 0x69,
-  0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x29, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x75,
-  0x72, 0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72,
-  0x6d, 0x20, 0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76,
-  0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x2c, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x61,
-  0x6c, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73,
-  0x20, 0x74, 0x6f, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65,
-  0x6e, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20,
-  0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x65, 0x64, 0x79, 0x20, 0x6b, 0x6e,
-  0x6f, 0x77, 0x6e, 0x20, 0x66, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20,
-  0x69, 0x6e, 0x61, 0x63, 0x63, 0x75, 0x72, 0x61, 0x63, 0x69, 0x65, 0x73,
-  0x2e, 0x0a, 0x0a, 0x33, 0x2e, 0x35, 0x2e, 0x20, 0x41, 0x70, 0x70, 0x6c,
-  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x41,
-  0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x54, 0x65,
-  0x72, 0x6d, 0x73, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79,
-  0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6f,
-  0x66, 0x66, 0x65, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
-  0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x20, 0x61, 0x20, 0x66, 0x65,
-  0x65, 0x20, 0x66, 0x6f, 0x72, 0x2c, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61,
-  0x6e, 0x74, 0x79, 0x2c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
-  0x2c, 0x0a, 0x69, 0x6e, 0x64, 0x65, 0x6d, 0x6e, 0x69, 0x74, 0x79, 0x20,
-  0x6f, 0x72, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79,
-  0x20, 0x6f, 0x62, 0x6c, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x20, 0x74, 0x6f, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6d,
-  0x6f, 0x72, 0x65, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70, 0x69, 0x65, 0x6e,
-  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65,
-  0x64, 0x0a, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x20,
-  0x48, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x59, 0x6f, 0x75,
-  0x20, 0x6d, 0x61, 0x79, 0x20, 0x64, 0x6f, 0x20, 0x73, 0x6f, 0x20, 0x6f,
-  0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20,
-  0x6f, 0x77, 0x6e, 0x20, 0x62, 0x65, 0x68, 0x61, 0x6c, 0x66, 0x2c, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x0a, 0x62,
-  0x65, 0x68, 0x61, 0x6c, 0x66, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72,
-  0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x6d,
-  0x61, 0x6b, 0x65, 0x20, 0x69, 0x74, 0x20, 0x61, 0x62, 0x73, 0x6f, 0x6c,
-  0x75, 0x74, 0x65, 0x6c, 0x79, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x2c, 0x20,
-  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x64,
-  0x65, 0x6d, 0x6e, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6c,
-  0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x62, 0x6c,
-  0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x6f,
-  0x66, 0x66, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x0a, 0x59, 0x6f,
-  0x75, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20,
-  0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x64,
-  0x65, 0x6d, 0x6e, 0x69, 0x66, 0x79, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
-  0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x6c, 0x69, 0x61,
-  0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6e, 0x63, 0x75, 0x72,
-  0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20,
-  0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20,
-  0x6f, 0x66, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x2c,
-  0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x2c, 0x0a, 0x69, 0x6e,
-  0x64, 0x65, 0x6d, 0x6e, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x72, 0x20, 0x6c,
-  0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x74, 0x65, 0x72,
-  0x6d, 0x73, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72,
-  0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x64, 0x69, 0x73, 0x63, 0x6c, 0x61, 0x69,
-  0x6d, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61, 0x72, 0x72,
-  0x61, 0x6e, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6d,
-  0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x73, 0x70,
-  0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e,
-  0x79, 0x0a, 0x6a, 0x75, 0x72, 0x69, 0x73, 0x64, 0x69, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x34, 0x2e, 0x20, 0x49, 0x6e, 0x61, 0x62,
-  0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x43, 0x6f, 0x6d,
-  0x70, 0x6c, 0x79, 0x20, 0x44, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x53,
-  0x74, 0x61, 0x74, 0x75, 0x74, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x52, 0x65,
-  0x67, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x0a, 0x0a, 0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69,
-  0x6d, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d,
-  0x70, 0x6c, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72,
-  0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6f,
-  0x6d, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x64, 0x75,
-  0x65, 0x20, 0x74, 0x6f, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x75, 0x74, 0x65,
-  0x2c, 0x20, 0x6a, 0x75, 0x64, 0x69, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x6f,
-  0x72, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x67,
-  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x6e,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x3a, 0x20, 0x28,
-  0x61, 0x29, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x79, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x65, 0x78, 0x74, 0x65,
-  0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x3b,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x62, 0x29, 0x0a, 0x64, 0x65, 0x73,
-  0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69,
-  0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x74,
-  0x68, 0x65, 0x79, 0x20, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x2e, 0x20,
-  0x53, 0x75, 0x63, 0x68, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x0a, 0x62, 0x65,
-  0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61,
-  0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69,
-  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x20, 0x61, 0x6c, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0a, 0x53, 0x6f,
-  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2e, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x20,
-  0x70, 0x72, 0x6f, 0x68, 0x69, 0x62, 0x69, 0x74, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x74, 0x65, 0x0a, 0x6f, 0x72,
-  0x20, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
-  0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62,
-  0x65, 0x20, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74,
-  0x6c, 0x79, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x61, 0x0a, 0x72, 0x65, 0x63, 0x69, 0x70, 0x69,
-  0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x72, 0x64, 0x69, 0x6e,
-  0x61, 0x72, 0x79, 0x20, 0x73, 0x6b, 0x69, 0x6c, 0x6c, 0x20, 0x74, 0x6f,
-  0x20, 0x62, 0x65, 0x20, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x20, 0x69,
-  0x74, 0x2e, 0x0a, 0x0a, 0x35, 0x2e, 0x20, 0x54, 0x65, 0x72, 0x6d, 0x69,
-  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x35,
-  0x2e, 0x31, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x74,
-  0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74,
-  0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x69,
-  0x66, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x74,
-  0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x79, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73,
-  0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x2e, 0x20, 0x48, 0x6f, 0x77, 0x65,
-  0x76, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x59, 0x6f, 0x75, 0x20,
-  0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x0a, 0x63, 0x6f, 0x6d, 0x70, 0x6c,
-  0x69, 0x61, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x67, 0x72,
-  0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74,
-  0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72,
-  0x65, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x74, 0x65, 0x64, 0x20, 0x28, 0x61,
-  0x29, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x61,
-  0x6c, 0x6c, 0x79, 0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x6c,
-  0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x6c,
-  0x79, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73,
-  0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x73,
-  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x62, 0x29, 0x20, 0x6f, 0x6e,
-  0x20, 0x61, 0x6e, 0x0a, 0x6f, 0x6e, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20,
-  0x62, 0x61, 0x73, 0x69, 0x73, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x74, 0x6f, 0x20,
-  0x6e, 0x6f, 0x74, 0x69, 0x66, 0x79, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6e, 0x6f, 0x6e, 0x2d, 0x63, 0x6f,
-  0x6d, 0x70, 0x6c, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x79, 0x20,
-  0x73, 0x6f, 0x6d, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x70, 0x72,
-  0x69, 0x6f, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x36, 0x30, 0x20, 0x64, 0x61,
-  0x79, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x59, 0x6f, 0x75,
-  0x20, 0x68, 0x61, 0x76, 0x65, 0x0a, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x62,
-  0x61, 0x63, 0x6b, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d,
-  0x70, 0x6c, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x4d, 0x6f, 0x72,
-  0x65, 0x6f, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20,
-  0x67, 0x72, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
-  0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72,
-  0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x69, 0x6e, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x6e,
-  0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x61, 0x73, 0x69, 0x73, 0x20,
-  0x69, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x0a, 0x6e, 0x6f, 0x74, 0x69,
-  0x66, 0x69, 0x65, 0x73, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 0x70,
-  0x6c, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x6f,
-  0x6d, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x69, 0x72,
-  0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x59, 0x6f, 0x75, 0x20,
-  0x68, 0x61, 0x76, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
-  0x64, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20,
-  0x6e, 0x6f, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x69, 0x61, 0x6e,
-  0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x66, 0x72, 0x6f,
-  0x6d, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x63,
-  0x6f, 0x6d, 0x70, 0x6c, 0x69, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x69,
-  0x6f, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x33, 0x30, 0x20, 0x64, 0x61, 0x79,
-  0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x0a, 0x59, 0x6f, 0x75, 0x72,
-  0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x70, 0x74, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x2e, 0x0a,
-  0x0a, 0x35, 0x2e, 0x32, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x59, 0x6f, 0x75,
-  0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x74, 0x65, 0x20, 0x6c, 0x69,
-  0x74, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x67, 0x61,
-  0x69, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x65, 0x6e, 0x74,
-  0x69, 0x74, 0x79, 0x20, 0x62, 0x79, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72,
-  0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e,
-  0x74, 0x0a, 0x69, 0x6e, 0x66, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x20, 0x28, 0x65, 0x78,
-  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x63, 0x6c,
-  0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x6a, 0x75, 0x64, 0x67,
-  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x2c, 0x0a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2d, 0x63, 0x6c,
-  0x61, 0x69, 0x6d, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x72,
-  0x6f, 0x73, 0x73, 0x2d, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x29, 0x20,
-  0x61, 0x6c, 0x6c, 0x65, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
-  0x74, 0x6f, 0x72, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x6f, 0x72, 0x20,
-  0x69, 0x6e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x69,
-  0x6e, 0x66, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73,
-  0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x0a,
-  0x59, 0x6f, 0x75, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20,
-  0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32,
-  0x2e, 0x31, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c,
-  0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x2e, 0x0a,
-  0x0a, 0x35, 0x2e, 0x33, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x65,
-  0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x20, 0x35, 0x2e, 0x31, 0x20, 0x6f, 0x72, 0x20, 0x35, 0x2e, 0x32, 0x20,
-  0x61, 0x62, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x65,
-  0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6d, 0x65, 0x6e,
-  0x74, 0x73, 0x20, 0x28, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e,
-  0x67, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f,
-  0x72, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x73, 0x65, 0x6c,
-  0x6c, 0x65, 0x72, 0x73, 0x29, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a,
-  0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x76, 0x61,
-  0x6c, 0x69, 0x64, 0x6c, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6f, 0x72, 0x20,
-  0x59, 0x6f, 0x75, 0x72, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x0a, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x65,
-  0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x68,
-  0x61, 0x6c, 0x6c, 0x20, 0x73, 0x75, 0x72, 0x76, 0x69, 0x76, 0x65, 0x20,
-  0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
-  0x0a, 0x0a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x36, 0x2e, 0x20, 0x44, 0x69,
-  0x73, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20,
-  0x57, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x43, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
-  0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x6f, 0x6e,
-  0x20, 0x61, 0x6e, 0x20, 0x22, 0x61, 0x73, 0x20, 0x69, 0x73, 0x22, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x62,
-  0x61, 0x73, 0x69, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
-  0x74, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x20, 0x6f,
-  0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6b, 0x69, 0x6e, 0x64, 0x2c, 0x20,
-  0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
-  0x73, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65,
-  0x64, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20,
-  0x73, 0x74, 0x61, 0x74, 0x75, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x69,
-  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e,
-  0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20,
-  0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66,
-  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x65,
-  0x65, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x73,
-  0x2c, 0x20, 0x6d, 0x65, 0x72, 0x63, 0x68, 0x61, 0x6e, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x2c, 0x20, 0x66, 0x69, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a,
-  0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72,
-  0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20,
-  0x6e, 0x6f, 0x6e, 0x2d, 0x69, 0x6e, 0x66, 0x72, 0x69, 0x6e, 0x67, 0x69,
-  0x6e, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x69,
-  0x72, 0x65, 0x20, 0x72, 0x69, 0x73, 0x6b, 0x20, 0x61, 0x73, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a,
-  0x2a, 0x20, 0x20, 0x71, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e,
-  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x59,
-  0x6f, 0x75, 0x2e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a,
-  0x0a, 0x2a, 0x20, 0x20, 0x53, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53,
-  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76,
-  0x65, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20,
-  0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65,
-  0x63, 0x74, 0x2c, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f,
-  0x72, 0x29, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x20,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x20,
-  0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72,
-  0x2c, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x64, 0x69,
-  0x73, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20,
-  0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x20,
-  0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x65, 0x73, 0x73, 0x65, 0x6e,
-  0x74, 0x69, 0x61, 0x6c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2e, 0x20, 0x4e, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73,
-  0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x61, 0x75, 0x74, 0x68,
-  0x6f, 0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x75, 0x6e, 0x64,
-  0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x63,
-  0x6c, 0x61, 0x69, 0x6d, 0x65, 0x72, 0x2e, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0a, 0x0a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0a, 0x2a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a,
-  0x20, 0x20, 0x37, 0x2e, 0x20, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x69, 0x61, 0x62, 0x69,
-  0x6c, 0x69, 0x74, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a,
-  0x2a, 0x20, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a,
-  0x0a, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6e,
-  0x6f, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x6e, 0x6f, 0x20, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x74,
-  0x68, 0x65, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x74, 0x6f, 0x72, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x28, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-  0x64, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x65, 0x67, 0x6c, 0x69, 0x67, 0x65,
-  0x6e, 0x63, 0x65, 0x29, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61,
-  0x63, 0x74, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
-  0x77, 0x69, 0x73, 0x65, 0x2c, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61,
-  0x6e, 0x79, 0x6f, 0x6e, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x43, 0x6f,
-  0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x70, 0x65, 0x72, 0x6d,
-  0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x2c,
-  0x20, 0x62, 0x65, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74,
-  0x6f, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x69, 0x6e,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x73, 0x70, 0x65,
-  0x63, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x65,
-  0x6e, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x64,
-  0x61, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x73,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x70, 0x72,
-  0x6f, 0x66, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x67,
-  0x6f, 0x6f, 0x64, 0x77, 0x69, 0x6c, 0x6c, 0x2c, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x20,
-  0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x66, 0x61, 0x69,
-  0x6c, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x6c, 0x66,
-  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x72, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x74, 0x68, 0x65,
-  0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6c,
-  0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20,
-  0x6c, 0x6f, 0x73, 0x73, 0x65, 0x73, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x6e,
-  0x20, 0x69, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72,
-  0x74, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20,
-  0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
-  0x62, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x65,
-  0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73,
-  0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x73,
-  0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a,
-  0x20, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
-  0x79, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-  0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x61,
-  0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64,
-  0x65, 0x61, 0x74, 0x68, 0x20, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x2a, 0x0a,
-  0x2a, 0x20, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x61, 0x6c, 0x20,
-  0x69, 0x6e, 0x6a, 0x75, 0x72, 0x79, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c,
-  0x74, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x27, 0x73, 0x20, 0x6e,
-  0x65, 0x67, 0x6c, 0x69, 0x67, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a,
-  0x0a, 0x2a, 0x20, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x61,
-  0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6c, 0x61,
-  0x77, 0x20, 0x70, 0x72, 0x6f, 0x68, 0x69, 0x62, 0x69, 0x74, 0x73, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x53, 0x6f, 0x6d, 0x65, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x6a, 0x75, 0x72, 0x69, 0x73, 0x64, 0x69,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f,
-  0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72,
-  0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x66, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x65,
-  0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x73,
-  0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x64, 0x61,
-  0x6d, 0x61, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6e, 0x6f,
-  0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x59,
-  0x6f, 0x75, 0x2e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2a, 0x0a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0a, 0x0a, 0x38, 0x2e, 0x20, 0x4c,
-  0x69, 0x74, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a,
-  0x0a, 0x41, 0x6e, 0x79, 0x20, 0x6c, 0x69, 0x74, 0x69, 0x67, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x67,
-  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20,
-  0x62, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
-  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x63, 0x6f, 0x75, 0x72,
-  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x72, 0x69,
-  0x73, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x65,
-  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x65, 0x6e,
-  0x64, 0x61, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x61, 0x69,
-  0x6e, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x63,
-  0x69, 0x70, 0x61, 0x6c, 0x0a, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x6f,
-  0x66, 0x20, 0x62, 0x75, 0x73, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x74, 0x69,
-  0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c,
-  0x20, 0x62, 0x65, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64,
-  0x20, 0x62, 0x79, 0x20, 0x6c, 0x61, 0x77, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x0a, 0x6a, 0x75, 0x72, 0x69, 0x73, 0x64, 0x69,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f,
-  0x75, 0x74, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65,
-  0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x66,
-  0x6c, 0x69, 0x63, 0x74, 0x2d, 0x6f, 0x66, 0x2d, 0x6c, 0x61, 0x77, 0x20,
-  0x70, 0x72, 0x6f, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a,
-  0x4e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e,
-  0x74, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x27, 0x73, 0x20,
-  0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x62,
-  0x72, 0x69, 0x6e, 0x67, 0x0a, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x63,
-  0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x2d, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x2e,
-  0x0a, 0x0a, 0x39, 0x2e, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
-  0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a,
-  0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x73,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74,
-  0x65, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x63, 0x6f, 0x6e, 0x63, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x6d,
-  0x61, 0x74, 0x74, 0x65, 0x72, 0x20, 0x68, 0x65, 0x72, 0x65, 0x6f, 0x66,
-  0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x72, 0x6f,
-  0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x69,
-  0x73, 0x20, 0x68, 0x65, 0x6c, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65,
-  0x0a, 0x75, 0x6e, 0x65, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x61, 0x62,
-  0x6c, 0x65, 0x2c, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f,
-  0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c,
-  0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64,
-  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x0a, 0x6e, 0x65, 0x63, 0x65,
-  0x73, 0x73, 0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6b,
-  0x65, 0x20, 0x69, 0x74, 0x20, 0x65, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65,
-  0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x6c, 0x61,
-  0x77, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x72,
-  0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x0a, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
-  0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61,
-  0x63, 0x74, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x65, 0x64, 0x20, 0x61, 0x67,
-  0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x72,
-  0x61, 0x66, 0x74, 0x65, 0x72, 0x0a, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
-  0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x65, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x2e, 0x0a,
-  0x0a, 0x31, 0x30, 0x2e, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x31, 0x30,
-  0x2e, 0x31, 0x2e, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x56, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x0a, 0x4d, 0x6f, 0x7a, 0x69, 0x6c, 0x6c,
-  0x61, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x20, 0x73, 0x74, 0x65, 0x77, 0x61, 0x72, 0x64, 0x2e,
-  0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x61, 0x73, 0x20, 0x70,
-  0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x53,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x30, 0x2e, 0x33, 0x2c,
-  0x20, 0x6e, 0x6f, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x73, 0x74, 0x65, 0x77, 0x61,
-  0x72, 0x64, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x64, 0x69,
-  0x66, 0x79, 0x20, 0x6f, 0x72, 0x0a, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73,
-  0x68, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x20, 0x45, 0x61, 0x63, 0x68,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x6c,
-  0x6c, 0x20, 0x62, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x61,
-  0x0a, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x68,
-  0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x31, 0x30, 0x2e,
-  0x32, 0x2e, 0x20, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x66,
-  0x20, 0x4e, 0x65, 0x77, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x64,
-  0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f,
-  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x77,
-  0x68, 0x69, 0x63, 0x68, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6f, 0x72, 0x69,
-  0x67, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x63, 0x65,
-  0x69, 0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x76,
-  0x65, 0x72, 0x65, 0x64, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x2c, 0x0a, 0x6f, 0x72, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x0a, 0x73, 0x74, 0x65, 0x77, 0x61, 0x72, 0x64, 0x2e, 0x0a, 0x0a, 0x31,
-  0x30, 0x2e, 0x33, 0x2e, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65,
-  0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x0a,
-  0x49, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
-  0x65, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x79, 0x6f, 0x75,
-  0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2c,
-  0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20,
-  0x61, 0x0a, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x69,
-  0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
-  0x61, 0x6e, 0x79, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63,
-  0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61,
-  0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x73, 0x74, 0x65, 0x77, 0x61, 0x72,
-  0x64, 0x20, 0x28, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x6f,
-  0x20, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x73,
-  0x75, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x69, 0x66,
-  0x66, 0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x29, 0x2e,
-  0x0a, 0x0a, 0x31, 0x30, 0x2e, 0x34, 0x2e, 0x20, 0x44, 0x69, 0x73, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f, 0x75,
-  0x72, 0x63, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72,
-  0x6d, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x49, 0x6e,
-  0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x57,
-  0x69, 0x74, 0x68, 0x20, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72,
-  0x79, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x0a, 0x0a,
-  0x49, 0x66, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73,
-  0x65, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43,
-  0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x69, 0x73, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61,
-  0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x0a, 0x53,
-  0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6e, 0x6f,
-  0x74, 0x69, 0x63, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62,
-  0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x45, 0x78, 0x68, 0x69, 0x62, 0x69,
-  0x74, 0x20, 0x42, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x6d, 0x75, 0x73, 0x74,
-  0x20, 0x62, 0x65, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64,
-  0x2e, 0x0a, 0x0a, 0x45, 0x78, 0x68, 0x69, 0x62, 0x69, 0x74, 0x20, 0x41,
-  0x20, 0x2d, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x20, 0x4e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x0a, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68,
-  0x69, 0x73, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6f,
-  0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x73,
-  0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4d, 0x6f, 0x7a, 0x69, 0x6c, 0x6c, 0x61, 0x20, 0x50,
-  0x75, 0x62, 0x6c, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2c, 0x20, 0x76, 0x2e, 0x20, 0x32, 0x2e, 0x30, 0x2e,
-  0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x50, 0x4c, 0x20, 0x77, 0x61,
-  0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6f, 0x62, 0x74, 0x61,
-  0x69, 0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x61, 0x74, 0x20, 0x68, 0x74,
-  0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6d, 0x6f, 0x7a, 0x69, 0x6c, 0x6c, 0x61,
-  0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4d, 0x50, 0x4c, 0x2f, 0x32, 0x2e, 0x30,
-  0x2f, 0x2e, 0x0a, 0x0a, 0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c,
-  0x65, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x75, 0x74, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20,
-  0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72,
-  0x0a, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x69, 0x6e, 0x63, 0x6c,
-  0x75, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69,
-  0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61,
-  0x73, 0x20, 0x61, 0x20, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 0x45, 0x0a,
-  0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x72, 0x65,
-  0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x6f, 0x72, 0x79, 0x29, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20,
-  0x61, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70, 0x69, 0x65, 0x6e, 0x74, 0x20,
-  0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x6c, 0x69, 0x6b,
-  0x65, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x0a,
-  0x66, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x6e,
-  0x6f, 0x74, 0x69, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x61, 0x64, 0x64, 0x20, 0x61, 0x64, 0x64, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x61, 0x63, 0x63, 0x75, 0x72,
-  0x61, 0x74, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x2e, 0x0a,
-  0x0a, 0x45, 0x78, 0x68, 0x69, 0x62, 0x69, 0x74, 0x20, 0x42, 0x20, 0x2d,
-  0x20, 0x22, 0x49, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62,
-  0x6c, 0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x53, 0x65, 0x63, 0x6f,
-  0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x73, 0x22, 0x20, 0x4e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x0a, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x20, 0x20,
-  0x54, 0x68, 0x69, 0x73, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
-  0x43, 0x6f, 0x64, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73,
-  0x20, 0x22, 0x49, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62,
-  0x6c, 0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x53, 0x65, 0x63, 0x6f,
-  0x6e, 0x64, 0x61, 0x72, 0x79, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x73, 0x22, 0x2c, 0x20, 0x61, 0x73, 0x0a, 0x20, 0x20, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4d, 0x6f, 0x7a, 0x69, 0x6c, 0x6c, 0x61, 0x20, 0x50, 0x75, 0x62,
-  0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x20, 0x76, 0x2e, 0x20, 0x32, 0x2e, 0x30, 0x2e, 0x0a
+// NOTE compressed copy of LICENSE in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char LICENSE[] = {
+  0x00, 0x00, 0x41, 0x55, 0x78, 0xda, 0xcd, 0x5c, 0x5b, 0x8f, 0xe3, 0x36,
+  0xb2, 0x7e, 0xe7, 0xaf, 0x10, 0x06, 0x38, 0x48, 0xf7, 0xc2, 0xed, 0x24,
+  0xd3, 0xb9, 0xec, 0x66, 0x71, 0x1e, 0x66, 0x93, 0x49, 0x76, 0x80, 0x99,
+  0x20, 0xd8, 0x49, 0x4e, 0x70, 0x1e, 0x69, 0x89, 0xb6, 0x99, 0x91, 0x45,
+  0xaf, 0x28, 0xb5, 0xc7, 0xfb, 0xeb, 0x4f, 0x7d, 0x55, 0x45, 0x8a, 0x92,
+  0xdd, 0x73, 0x39, 0x98, 0x73, 0x69, 0x04, 0x49, 0xb7, 0x2d, 0x16, 0x59,
+  0xf7, 0xaf, 0x8a, 0xa5, 0xbc, 0x0a, 0xff, 0xf2, 0x6d, 0x6b, 0xab, 0x5f,
+  0xc6, 0x4d, 0xeb, 0xeb, 0xea, 0xa5, 0xaf, 0x5d, 0x17, 0x5d, 0xf5, 0x1f,
+  0xae, 0x8f, 0x3e, 0x74, 0xd5, 0xd3, 0xf5, 0x17, 0xe6, 0xdf, 0xdf, 0xfb,
+  0x63, 0xcc, 0x97, 0xeb, 0xea, 0x07, 0xb7, 0xf5, 0x9d, 0x1f, 0x68, 0x55,
+  0x34, 0x77, 0xb3, 0x1f, 0x7c, 0x4d, 0x0f, 0x3c, 0xf9, 0x3e, 0x74, 0x43,
+  0xef, 0x37, 0xe3, 0x10, 0xfa, 0x27, 0xa6, 0xa2, 0x9f, 0x83, 0xb3, 0x5d,
+  0xac, 0x9c, 0xad, 0xf7, 0x95, 0xef, 0x1a, 0xff, 0xe0, 0x9b, 0xd1, 0xb6,
+  0x55, 0xe8, 0xab, 0xd6, 0xed, 0xe8, 0x17, 0xd7, 0x0d, 0x7e, 0x38, 0x57,
+  0xc3, 0xde, 0x0e, 0x55, 0xdd, 0x3b, 0x3b, 0xb8, 0xb8, 0xaa, 0xea, 0x44,
+  0xc4, 0xc5, 0x6a, 0x08, 0x4c, 0x66, 0xd8, 0x3b, 0xf9, 0x1e, 0x27, 0x0e,
+  0xdb, 0x15, 0x28, 0x84, 0x13, 0x51, 0xfe, 0x3e, 0x3c, 0xb8, 0xde, 0x35,
+  0xd5, 0xeb, 0xb0, 0x1d, 0x4e, 0xb6, 0x77, 0x6b, 0x9c, 0xe4, 0xe9, 0xfc,
+  0x24, 0x89, 0xd5, 0xf2, 0x44, 0x4c, 0x30, 0x1c, 0x36, 0xbe, 0x4b, 0x34,
+  0xf9, 0xa3, 0xbc, 0x0a, 0x3c, 0xe2, 0xc3, 0x40, 0x9f, 0xf6, 0xb1, 0xba,
+  0xf1, 0xdb, 0xca, 0x76, 0xe7, 0xdb, 0x6a, 0x8c, 0xae, 0x61, 0x32, 0x9b,
+  0x73, 0x65, 0xab, 0x72, 0x13, 0xdb, 0x35, 0xc2, 0xc7, 0xd1, 0xf6, 0x83,
+  0xaf, 0xc7, 0xd6, 0xf6, 0xe5, 0xf7, 0x9f, 0xc5, 0x19, 0x71, 0x3e, 0xe7,
+  0x7d, 0x79, 0xce, 0xc5, 0x01, 0x97, 0x8c, 0xe1, 0x30, 0xf6, 0x11, 0xda,
+  0x4c, 0xec, 0x2b, 0x26, 0x36, 0x5f, 0x54, 0x12, 0x7c, 0x1d, 0xc6, 0xbe,
+  0x06, 0x87, 0x8d, 0xab, 0x7e, 0x0c, 0xfd, 0x81, 0x44, 0x5b, 0x9d, 0xf6,
+  0x9e, 0x14, 0x03, 0xc6, 0x59, 0xaf, 0xa4, 0x90, 0x92, 0xa3, 0xbd, 0x8d,
+  0x95, 0x1d, 0x06, 0xd2, 0x9d, 0xf2, 0x8c, 0x07, 0xbb, 0x40, 0x07, 0xc0,
+  0xf3, 0xd5, 0xf3, 0xb7, 0x7b, 0xbf, 0xf1, 0x43, 0xf5, 0x6c, 0xc5, 0x5f,
+  0x3c, 0x7f, 0xeb, 0xea, 0x71, 0xb0, 0x9b, 0x56, 0xc9, 0xd3, 0x79, 0xe3,
+  0x48, 0xd4, 0x8b, 0x7d, 0x99, 0x08, 0xbe, 0x5c, 0xb1, 0xb4, 0x5e, 0x85,
+  0xc6, 0x6f, 0x7d, 0x6d, 0xb3, 0xb0, 0x97, 0xcf, 0xeb, 0xb3, 0xb4, 0x17,
+  0x1b, 0x50, 0x6d, 0xa3, 0x90, 0xf0, 0x5d, 0xdd, 0x8e, 0x8d, 0xef, 0x76,
+  0xd5, 0x31, 0xf4, 0xb2, 0x1a, 0x6a, 0x72, 0x61, 0xcb, 0x92, 0xf8, 0x9a,
+  0x24, 0xf1, 0xa2, 0x23, 0xed, 0x1e, 0x89, 0x34, 0xce, 0xf3, 0xbb, 0x1f,
+  0x88, 0xae, 0x23, 0xbb, 0x6a, 0x6c, 0x7f, 0x4e, 0x1e, 0x10, 0x0b, 0xe9,
+  0x18, 0xfe, 0xf5, 0xc6, 0xde, 0x8a, 0x0a, 0x3f, 0x44, 0x22, 0xa5, 0x34,
+  0x1a, 0x17, 0x6b, 0x7a, 0x46, 0xc5, 0x24, 0x47, 0xcc, 0xf2, 0xf9, 0x1b,
+  0x24, 0x2d, 0xc6, 0x35, 0xd7, 0xce, 0x5f, 0xc9, 0x8a, 0x75, 0xe3, 0x4d,
+  0xb1, 0xf1, 0x85, 0xe6, 0x4f, 0xb4, 0xeb, 0xc1, 0x92, 0x38, 0xec, 0x83,
+  0xf5, 0x2d, 0x4b, 0x78, 0xec, 0x1a, 0xd7, 0xf3, 0xd3, 0x83, 0xeb, 0x0f,
+  0x10, 0x5e, 0xde, 0xf9, 0x41, 0xfd, 0x9a, 0x1c, 0x12, 0x5e, 0xe2, 0x6c,
+  0xdf, 0x7a, 0x7a, 0x56, 0x0d, 0x5c, 0x79, 0x5f, 0x55, 0xc4, 0x10, 0x4e,
+  0x5f, 0xd9, 0x36, 0x86, 0x89, 0x5c, 0xa6, 0x92, 0xc8, 0x92, 0xcd, 0x5d,
+  0x08, 0x8e, 0x85, 0xfc, 0x0d, 0x09, 0x79, 0xa1, 0xf2, 0xd2, 0xda, 0xc8,
+  0x59, 0xaa, 0xad, 0x9a, 0x01, 0xf6, 0x3d, 0x85, 0xfe, 0x8d, 0x38, 0x13,
+  0x18, 0xed, 0x2e, 0xb4, 0xcc, 0x34, 0xbf, 0x25, 0x9a, 0x2f, 0x6d, 0xbf,
+  0xa3, 0x87, 0x7e, 0xa7, 0xe7, 0x67, 0xf4, 0x84, 0x82, 0x04, 0x0a, 0xf6,
+  0x5b, 0x77, 0xc5, 0x47, 0x4e, 0x50, 0xb4, 0xec, 0x72, 0xa0, 0x58, 0xd2,
+  0x93, 0xfe, 0x60, 0x3e, 0x4c, 0xc7, 0x56, 0xd1, 0x91, 0xfb, 0xd0, 0xc7,
+  0xd5, 0xd6, 0xd3, 0x89, 0x49, 0x36, 0xf8, 0x6f, 0x5c, 0x09, 0x51, 0x1f,
+  0x59, 0x1c, 0x57, 0xe3, 0xc9, 0x9f, 0x71, 0x2e, 0xe1, 0x7d, 0x1e, 0x43,
+  0x68, 0x51, 0x13, 0xea, 0xf1, 0x40, 0x61, 0x8c, 0x1f, 0xfc, 0x4b, 0x7e,
+  0x10, 0x42, 0x29, 0x9f, 0xdd, 0xdb, 0x07, 0xd8, 0x2b, 0x44, 0xd1, 0xfb,
+  0xdd, 0x7e, 0x80, 0x4d, 0xec, 0x7a, 0xdb, 0x0d, 0xab, 0x64, 0x1d, 0x07,
+  0xfb, 0xd6, 0x1f, 0xc6, 0x43, 0xe5, 0xde, 0x0e, 0x44, 0x8e, 0x2c, 0x3b,
+  0x46, 0x18, 0xef, 0x8a, 0x89, 0x9c, 0xf6, 0x8e, 0xb9, 0x52, 0x13, 0x19,
+  0xfc, 0xc1, 0x25, 0xc9, 0x26, 0x3b, 0x65, 0x6a, 0xe0, 0x2a, 0x8e, 0x9b,
+  0xe8, 0xfe, 0x39, 0x12, 0x91, 0xf6, 0xbc, 0x62, 0x45, 0x90, 0xb3, 0x89,
+  0x08, 0xda, 0x36, 0xad, 0xe2, 0x43, 0x44, 0x84, 0xda, 0x07, 0x77, 0x26,
+  0x7e, 0x37, 0x67, 0x61, 0xa7, 0x54, 0xf1, 0x97, 0x5f, 0x10, 0x3b, 0x33,
+  0x27, 0x5d, 0x6a, 0x58, 0x89, 0x6d, 0x43, 0xdb, 0x86, 0x13, 0xf1, 0xf7,
+  0xdd, 0xe4, 0x47, 0x6c, 0x00, 0x90, 0xb3, 0xef, 0xae, 0x84, 0x1e, 0x48,
+  0xbc, 0x77, 0x71, 0x6c, 0xe9, 0x0c, 0xdb, 0x3e, 0x1c, 0xe8, 0xf1, 0xca,
+  0x36, 0x0d, 0xe7, 0x16, 0x12, 0xc8, 0x2a, 0xdb, 0x61, 0xe3, 0x5a, 0xc7,
+  0x1f, 0xe2, 0x29, 0x0e, 0xfb, 0x87, 0xe2, 0x40, 0xe9, 0x00, 0xc8, 0x18,
+  0xc4, 0x2f, 0x1b, 0xac, 0x6a, 0x30, 0x53, 0xb8, 0xee, 0x6d, 0x38, 0x5e,
+  0xe7, 0x4e, 0xef, 0x39, 0x22, 0xe8, 0x5a, 0xaf, 0xcc, 0x3e, 0x46, 0x58,
+  0x64, 0x85, 0xec, 0xf7, 0x8b, 0x65, 0xd5, 0x7d, 0xdf, 0x5a, 0x7f, 0x88,
+  0x4f, 0xc4, 0x7b, 0x8a, 0xf0, 0xb1, 0x10, 0xde, 0x51, 0x9e, 0xae, 0xf1,
+  0xf4, 0x4d, 0xbc, 0x5d, 0x15, 0x61, 0x0d, 0x76, 0x1c, 0xc8, 0x41, 0x5b,
+  0x7f, 0xf0, 0x03, 0x73, 0xba, 0xa2, 0x85, 0xf4, 0x59, 0x23, 0x92, 0x39,
+  0xf6, 0xa1, 0x76, 0x31, 0x4a, 0x18, 0xb5, 0x47, 0x36, 0xeb, 0x31, 0x0a,
+  0xa9, 0xc8, 0x01, 0xb3, 0xd8, 0x60, 0x32, 0x48, 0x68, 0x19, 0x31, 0x96,
+  0x69, 0x94, 0x71, 0x8d, 0x99, 0x3d, 0x85, 0xb1, 0x25, 0x43, 0x80, 0x38,
+  0xb6, 0x3d, 0x9d, 0xc2, 0x35, 0x12, 0x25, 0xb6, 0x41, 0x22, 0x8d, 0x1a,
+  0xd8, 0x36, 0xc7, 0x89, 0x29, 0x96, 0x9c, 0xd5, 0x82, 0xdf, 0xd0, 0xb2,
+  0x15, 0xe5, 0x48, 0xfe, 0x4f, 0x74, 0x6d, 0xcb, 0xbf, 0x84, 0xed, 0xd6,
+  0x81, 0x20, 0x53, 0x8a, 0x96, 0x6c, 0x5a, 0xdd, 0x41, 0x04, 0x42, 0x91,
+  0x8d, 0x8e, 0x7c, 0x40, 0x28, 0x67, 0x05, 0x0f, 0xb4, 0x4f, 0xdc, 0x4a,
+  0xc8, 0x72, 0x9e, 0xcd, 0xde, 0x0f, 0x71, 0x99, 0x9a, 0xf9, 0xc3, 0x0b,
+  0x46, 0x34, 0xd3, 0x8b, 0x4a, 0x00, 0x03, 0x2e, 0x82, 0xd7, 0x0c, 0x96,
+  0x78, 0x0d, 0x48, 0xae, 0xfa, 0xe9, 0xe7, 0xdf, 0xaa, 0x9f, 0x5c, 0xe7,
+  0x7a, 0xf2, 0xa4, 0x39, 0x50, 0x5a, 0x95, 0x48, 0x69, 0x95, 0x1e, 0x16,
+  0x01, 0x90, 0x0e, 0x68, 0xfd, 0xfb, 0xd7, 0x7d, 0x99, 0xd7, 0x55, 0xcf,
+  0x20, 0x8c, 0x90, 0xd6, 0x30, 0x99, 0xc7, 0xd6, 0xdd, 0x63, 0x3f, 0x46,
+  0x16, 0xe7, 0xaa, 0x45, 0x38, 0x4b, 0xb1, 0x3d, 0x8a, 0x16, 0x82, 0xa6,
+  0xc3, 0x56, 0xf3, 0x99, 0x70, 0x0d, 0x50, 0xb1, 0xb4, 0xe6, 0x25, 0xf2,
+  0xb9, 0x88, 0xcc, 0xc7, 0xde, 0xd1, 0xb1, 0x10, 0xf8, 0xa0, 0x23, 0x51,
+  0xe4, 0xcc, 0xd3, 0x94, 0x38, 0x40, 0xc6, 0x7f, 0x86, 0xf1, 0x49, 0x75,
+  0x43, 0x8f, 0xe1, 0xb7, 0xfe, 0xc9, 0xed, 0xcc, 0xac, 0x17, 0x28, 0xcf,
+  0xce, 0x71, 0x9e, 0x7b, 0xeb, 0xfa, 0xda, 0xc3, 0x3c, 0x52, 0x00, 0x4a,
+  0x99, 0xc7, 0xc7, 0xd2, 0xa4, 0xd6, 0x38, 0x75, 0xb9, 0xd4, 0x23, 0x4e,
+  0xcb, 0xce, 0xe2, 0x25, 0x4e, 0x7c, 0xa8, 0xc0, 0x8f, 0xbc, 0x9e, 0xa1,
+  0x63, 0x68, 0xe1, 0x03, 0x31, 0xfd, 0xd1, 0x72, 0x78, 0x63, 0x49, 0xfa,
+  0xb4, 0x21, 0xa5, 0x90, 0x03, 0x49, 0x58, 0x9f, 0x90, 0xbc, 0x41, 0xd4,
+  0x79, 0x5f, 0xf1, 0xb0, 0xb1, 0xa7, 0x08, 0xec, 0x54, 0xd2, 0x88, 0xf3,
+  0x19, 0xfb, 0xd2, 0x41, 0x74, 0xdd, 0x13, 0x65, 0x5b, 0x70, 0x83, 0xa3,
+  0x98, 0x7d, 0x72, 0xfd, 0xaa, 0x6a, 0x7c, 0xef, 0x6a, 0x39, 0x0f, 0xf6,
+  0xec, 0xe4, 0x6f, 0x0e, 0xf4, 0xb5, 0x25, 0x00, 0xc9, 0xcf, 0xca, 0x87,
+  0x1c, 0xc3, 0x20, 0xf0, 0xce, 0xee, 0x1c, 0xd2, 0x48, 0x86, 0x41, 0xc2,
+  0xd9, 0x3c, 0xfa, 0x93, 0x9f, 0xf1, 0xce, 0xb6, 0xe6, 0x40, 0xcf, 0x89,
+  0xee, 0xe4, 0x61, 0x32, 0xf4, 0x17, 0xa2, 0x1a, 0x41, 0x62, 0xb2, 0x90,
+  0xbd, 0x3f, 0x82, 0xcc, 0x21, 0xf4, 0x8e, 0x93, 0x2d, 0xd3, 0xd8, 0xfa,
+  0x2d, 0x09, 0xea, 0x48, 0xf2, 0xc7, 0x2e, 0x37, 0x5f, 0x7f, 0xf1, 0x6f,
+  0xb7, 0xc9, 0x02, 0x28, 0xd2, 0xc4, 0x81, 0x22, 0x09, 0xd4, 0x12, 0xf7,
+  0x14, 0xd1, 0xd8, 0xbd, 0x36, 0x64, 0xa1, 0xa4, 0x7d, 0xaf, 0x46, 0x3a,
+  0x23, 0x5d, 0x9c, 0x90, 0xec, 0x82, 0xfc, 0x2c, 0x15, 0x15, 0x3f, 0x21,
+  0x46, 0x44, 0x0e, 0x4b, 0xe4, 0x96, 0xcd, 0xd5, 0x5a, 0xe1, 0xf2, 0x07,
+  0x24, 0x28, 0x7e, 0xca, 0x62, 0x63, 0x9e, 0x03, 0xec, 0xcd, 0x60, 0x17,
+  0xc5, 0x5d, 0xe2, 0x7d, 0x27, 0xc4, 0x49, 0x4f, 0x02, 0x07, 0xda, 0xe6,
+  0xee, 0xe4, 0x11, 0x3c, 0xfa, 0x70, 0xb6, 0xed, 0x70, 0xbe, 0xdb, 0xf6,
+  0x8e, 0xf2, 0x65, 0x17, 0xba, 0x3b, 0xf7, 0x96, 0x8c, 0x24, 0xfa, 0x07,
+  0x97, 0x9c, 0x83, 0x32, 0x13, 0xb4, 0x24, 0xda, 0xf7, 0x94, 0x2d, 0xc8,
+  0x2c, 0xea, 0x01, 0x56, 0x4a, 0xb1, 0x94, 0xa4, 0x42, 0xb2, 0x51, 0x8b,
+  0xbc, 0x29, 0x50, 0x8a, 0x46, 0x50, 0x09, 0x4a, 0x8d, 0x3b, 0xd8, 0xfe,
+  0xcd, 0x6d, 0x61, 0xa7, 0x65, 0x4c, 0x9d, 0xc7, 0xd3, 0x80, 0x42, 0x81,
+  0x0e, 0xe6, 0x88, 0x7a, 0x33, 0xd6, 0xf4, 0x2b, 0xf9, 0x54, 0x01, 0xe0,
+  0x44, 0xaf, 0xec, 0x60, 0x67, 0x18, 0x4c, 0x3c, 0xb6, 0x96, 0x7e, 0xa1,
+  0x83, 0x6c, 0x19, 0xf2, 0xd2, 0x27, 0x5a, 0x02, 0x49, 0x8c, 0xcf, 0xaa,
+  0x26, 0x17, 0x3a, 0xb6, 0x81, 0x50, 0xe5, 0x45, 0xf4, 0x83, 0xa4, 0x57,
+  0x29, 0xa4, 0x05, 0x64, 0x00, 0xe2, 0x56, 0x5c, 0x18, 0x0e, 0x60, 0xa3,
+  0xa7, 0xaf, 0xd9, 0xd0, 0x67, 0x29, 0x1d, 0xb6, 0x23, 0xe0, 0x20, 0x72,
+  0x75, 0x21, 0x59, 0xab, 0x40, 0x61, 0x7f, 0x65, 0xf8, 0x60, 0x60, 0x5e,
+  0x22, 0xbd, 0x59, 0x96, 0xcb, 0xd6, 0xb0, 0x60, 0x1f, 0xec, 0xae, 0x44,
+  0x08, 0xc8, 0x03, 0x9a, 0x04, 0xc4, 0x12, 0xcb, 0x2c, 0xe0, 0x16, 0xf1,
+  0x7f, 0xce, 0x6c, 0x4e, 0x05, 0x53, 0x1e, 0xb8, 0x64, 0x5a, 0x73, 0xc1,
+  0x23, 0x79, 0xe0, 0x29, 0xaa, 0xc1, 0xe7, 0xb4, 0x39, 0x39, 0x1b, 0xed,
+  0xf6, 0x03, 0x1d, 0xde, 0x98, 0x5f, 0xf7, 0xd9, 0x30, 0xa2, 0x98, 0x15,
+  0x89, 0x08, 0x28, 0x40, 0x5d, 0x92, 0xcc, 0x51, 0x44, 0x45, 0xbe, 0x70,
+  0xa4, 0xcf, 0xc0, 0x91, 0x40, 0x80, 0x69, 0x5f, 0xb3, 0xa1, 0xd4, 0x42,
+  0x30, 0xcc, 0x65, 0xda, 0x5b, 0x86, 0xdb, 0xa5, 0x2c, 0xd8, 0xbd, 0x3b,
+  0xf1, 0x77, 0x00, 0xcf, 0x59, 0x89, 0xc9, 0x00, 0xb4, 0x8f, 0x83, 0x99,
+  0x94, 0x1d, 0x17, 0xb2, 0x4c, 0x2c, 0xdc, 0xc3, 0xc3, 0x12, 0x14, 0x88,
+  0x20, 0xc9, 0xbe, 0x52, 0xbd, 0xae, 0xc9, 0x76, 0x1f, 0x67, 0x87, 0x03,
+  0x57, 0xe6, 0xa9, 0xb2, 0xbd, 0x9c, 0x20, 0x74, 0x6d, 0xb6, 0xf6, 0xf4,
+  0x34, 0xab, 0xd6, 0xcc, 0x20, 0x60, 0xf5, 0x73, 0xc8, 0x98, 0x8c, 0xfc,
+  0x44, 0x17, 0x20, 0x2e, 0xa7, 0xad, 0x4e, 0x9e, 0x00, 0x25, 0x00, 0xc3,
+  0xe1, 0xd8, 0xc2, 0xc8, 0x18, 0xc9, 0x01, 0x1d, 0x64, 0x8e, 0x34, 0xbe,
+  0xc9, 0x0a, 0xc4, 0x97, 0x09, 0xa0, 0x4d, 0xa8, 0x7d, 0xca, 0x01, 0x13,
+  0xfc, 0xfc, 0x39, 0x0c, 0x50, 0x40, 0x8e, 0x4b, 0x85, 0x66, 0x18, 0xbe,
+  0x6d, 0x88, 0xc8, 0x8a, 0x10, 0x7b, 0x72, 0x51, 0x3d, 0x13, 0x22, 0x7c,
+  0x62, 0x09, 0x15, 0xba, 0x29, 0xa4, 0xad, 0x21, 0x60, 0xab, 0x19, 0xb5,
+  0x46, 0x72, 0x64, 0xe0, 0x63, 0x2f, 0x6a, 0xbc, 0xde, 0x1d, 0x88, 0xbe,
+  0x32, 0x74, 0x51, 0xb6, 0x69, 0x64, 0x17, 0x9f, 0xd8, 0x72, 0x88, 0x17,
+  0xc0, 0x74, 0x60, 0x0c, 0xca, 0x31, 0x1e, 0xdb, 0x7f, 0x57, 0xdd, 0xf8,
+  0x5b, 0x84, 0x2b, 0x69, 0x0e, 0x30, 0x60, 0xd6, 0xd8, 0xe2, 0xfb, 0x86,
+  0xbd, 0xed, 0xfc, 0x59, 0x9c, 0x22, 0x41, 0x59, 0x0a, 0x2f, 0x37, 0x95,
+  0x10, 0xef, 0xfd, 0xed, 0xb5, 0xce, 0xc5, 0x75, 0xb7, 0x28, 0x8a, 0xa1,
+  0x98, 0x44, 0x7d, 0x43, 0x81, 0xd1, 0x1d, 0x87, 0xd2, 0xd9, 0x17, 0xae,
+  0xc3, 0x84, 0xd4, 0x7d, 0x6e, 0x05, 0x33, 0xdf, 0xd4, 0xd7, 0x5d, 0x3f,
+  0xe3, 0x44, 0x88, 0xfa, 0x42, 0xab, 0x5e, 0xec, 0xde, 0x52, 0x31, 0xd2,
+  0xd5, 0x2e, 0x55, 0xa8, 0x17, 0x48, 0x6e, 0x0d, 0xf3, 0x9d, 0x34, 0x4f,
+  0xf5, 0x94, 0x93, 0x4a, 0x4c, 0xe0, 0x26, 0x84, 0xa6, 0x96, 0xa7, 0x04,
+  0x73, 0x24, 0x8e, 0x08, 0x2d, 0xfd, 0x03, 0xea, 0x6f, 0xf9, 0xd3, 0xc0,
+  0xd2, 0xc2, 0x2e, 0x48, 0xdd, 0x5a, 0xba, 0x2b, 0x64, 0x37, 0x71, 0x7e,
+  0xb0, 0x67, 0x58, 0x6d, 0xe7, 0x80, 0xa1, 0x01, 0x0d, 0x91, 0x98, 0x03,
+  0xd9, 0xf0, 0x99, 0x65, 0x66, 0x8a, 0xc2, 0xbe, 0xa7, 0x42, 0x8a, 0x12,
+  0xb5, 0x28, 0xb6, 0x08, 0x10, 0xf7, 0xeb, 0xaf, 0x6e, 0xd9, 0x33, 0x09,
+  0x10, 0xbd, 0xce, 0xf5, 0x56, 0xee, 0x2c, 0x18, 0xb2, 0xdf, 0xd9, 0xee,
+  0x08, 0x87, 0xb1, 0xf4, 0x26, 0xcd, 0x65, 0xe8, 0x27, 0x68, 0x21, 0x84,
+  0x43, 0xb3, 0xad, 0xd4, 0xfb, 0x80, 0xad, 0x87, 0x50, 0x04, 0x86, 0xeb,
+  0x8d, 0x01, 0x51, 0x8a, 0x2d, 0x2a, 0xbe, 0x5c, 0xfd, 0x2b, 0x6c, 0x31,
+  0x49, 0xac, 0x37, 0xd1, 0xb9, 0x7c, 0x7a, 0x2a, 0xec, 0x9e, 0xde, 0xc2,
+  0xa0, 0x2e, 0xdb, 0x08, 0xd7, 0xea, 0x7d, 0x74, 0xbf, 0x0c, 0xa5, 0x26,
+  0x0a, 0x40, 0x39, 0x54, 0xcc, 0x17, 0x4d, 0x62, 0xb9, 0x17, 0xb1, 0x7c,
+  0xbd, 0xae, 0xfe, 0x41, 0xb9, 0xcf, 0x91, 0xee, 0x25, 0x68, 0x5d, 0xc9,
+  0xea, 0x7d, 0x7a, 0x20, 0x96, 0xbd, 0x8f, 0xe9, 0xfb, 0x8d, 0xa3, 0xa0,
+  0xf2, 0x40, 0x62, 0x83, 0x79, 0xcf, 0x4d, 0x9b, 0xed, 0x8b, 0x83, 0x91,
+  0xdf, 0x79, 0x88, 0x33, 0xf5, 0x06, 0xa9, 0x8e, 0x92, 0x74, 0xc0, 0x6e,
+  0x1c, 0xc7, 0x2d, 0x10, 0x0c, 0xe4, 0x22, 0x36, 0x64, 0x52, 0xd5, 0x5d,
+  0xd6, 0xc0, 0xf4, 0xd9, 0x65, 0x7d, 0xf1, 0x8e, 0xc2, 0xf8, 0x29, 0x7a,
+  0x1f, 0x3f, 0x5a, 0xdf, 0x57, 0xbf, 0x45, 0xb7, 0xb0, 0x5e, 0xed, 0x22,
+  0x00, 0x60, 0x90, 0x94, 0x1a, 0xd0, 0xe6, 0x1a, 0xae, 0xb4, 0x63, 0xe0,
+  0x17, 0xce, 0x7c, 0x12, 0x73, 0xa9, 0x7c, 0xa3, 0xe0, 0xc5, 0x50, 0x82,
+  0xa2, 0xf9, 0x59, 0xba, 0x03, 0x4d, 0xa8, 0xe9, 0x30, 0x9d, 0xe0, 0xcf,
+  0x2d, 0xf6, 0xe2, 0x54, 0xca, 0xbf, 0x35, 0xce, 0x6a, 0x5d, 0xa5, 0x10,
+  0xd0, 0xc0, 0x48, 0x1f, 0x28, 0xa3, 0x92, 0x28, 0xf9, 0x7c, 0xdf, 0xae,
+  0x4b, 0xf4, 0x65, 0x54, 0x3b, 0x91, 0xd4, 0x43, 0x85, 0xc8, 0xfd, 0xfa,
+  0x29, 0xfe, 0x75, 0x2f, 0xb9, 0x96, 0x0c, 0x99, 0xa5, 0x59, 0xe7, 0xe7,
+  0x13, 0x2a, 0x5c, 0x26, 0x14, 0x33, 0xcf, 0x8f, 0xb4, 0xd1, 0x3d, 0x94,
+  0x1c, 0x8f, 0xb4, 0xc6, 0x6f, 0x7c, 0xcb, 0x20, 0xdd, 0x5c, 0x45, 0x77,
+  0xf7, 0x40, 0x77, 0x3f, 0xcc, 0x72, 0xc2, 0x36, 0x55, 0xdc, 0x28, 0x4f,
+  0x8c, 0x79, 0x46, 0x89, 0xa4, 0x59, 0x3c, 0x70, 0x2d, 0xa2, 0x5c, 0x6b,
+  0x0e, 0xa6, 0xa2, 0x99, 0x44, 0x6c, 0xe6, 0x2d, 0x45, 0x36, 0x2b, 0x88,
+  0x5b, 0x5a, 0xcb, 0x95, 0x40, 0x13, 0x69, 0x7a, 0xf2, 0xc7, 0xb9, 0xd1,
+  0x4c, 0xf8, 0x6c, 0x8c, 0x03, 0xa2, 0x42, 0x4a, 0x84, 0x85, 0x75, 0xcf,
+  0xb3, 0x22, 0x16, 0xf2, 0xc3, 0x14, 0xfe, 0x50, 0x46, 0x11, 0x8c, 0xf7,
+  0x47, 0x3f, 0x37, 0x63, 0x39, 0xa6, 0x99, 0xba, 0x09, 0xb9, 0xbd, 0xbc,
+  0x64, 0x89, 0xc4, 0x8b, 0xcf, 0xba, 0x64, 0x69, 0x8b, 0x6d, 0x4d, 0x2e,
+  0x0a, 0xa1, 0xac, 0x7d, 0x38, 0xe1, 0x11, 0xca, 0x5d, 0x04, 0xee, 0xc2,
+  0x06, 0xad, 0x09, 0xf2, 0x57, 0x58, 0xcd, 0x23, 0xc7, 0xa4, 0x40, 0x47,
+  0xe6, 0x68, 0x2c, 0xf9, 0xed, 0xe1, 0x28, 0x28, 0xa6, 0x45, 0x1d, 0xc9,
+  0xde, 0x07, 0x69, 0xd7, 0xea, 0x09, 0x99, 0x87, 0xcf, 0x16, 0xd1, 0xb6,
+  0xec, 0xde, 0x6a, 0x9f, 0xee, 0x1e, 0x88, 0x6a, 0xa9, 0xcd, 0x45, 0x2b,
+  0xd0, 0x98, 0x17, 0x1c, 0xcd, 0x0a, 0x20, 0x7b, 0x55, 0x9f, 0xcb, 0xa6,
+  0x31, 0x6d, 0xd9, 0x69, 0x9e, 0x56, 0x24, 0xb4, 0x58, 0xc3, 0x92, 0xe7,
+  0x9e, 0xe5, 0xc6, 0x2d, 0x9b, 0xa2, 0x73, 0xfb, 0x28, 0x9b, 0xcd, 0x71,
+  0xea, 0xd0, 0xce, 0xa3, 0xf8, 0x97, 0x22, 0xd8, 0x77, 0xe8, 0x54, 0xf3,
+  0xd6, 0xb5, 0x0e, 0xf7, 0xbb, 0xd5, 0xf1, 0x68, 0xf3, 0x1b, 0x8a, 0x26,
+  0x7b, 0x8c, 0x94, 0x07, 0x40, 0x4a, 0x4a, 0x48, 0x5e, 0x8a, 0xb6, 0x1e,
+  0x25, 0x21, 0xaa, 0x06, 0x3b, 0xd4, 0x91, 0x0c, 0x4d, 0xea, 0x3d, 0xa0,
+  0x38, 0x90, 0x0e, 0xea, 0x39, 0x3d, 0x8b, 0xed, 0x14, 0x06, 0x44, 0x4e,
+  0x1b, 0x33, 0xcf, 0xd1, 0x76, 0x62, 0x66, 0xa1, 0xc0, 0xef, 0xc9, 0x26,
+  0x0a, 0xa5, 0xf0, 0x29, 0x97, 0x8c, 0x5d, 0x89, 0xf0, 0xcb, 0x0a, 0x7d,
+  0xa5, 0x9d, 0xc6, 0x8c, 0xbb, 0x06, 0x5d, 0x45, 0xfe, 0x47, 0x80, 0x1d,
+  0x21, 0x97, 0xd7, 0xae, 0x50, 0x5f, 0x3d, 0x78, 0x8e, 0x85, 0xea, 0x1d,
+  0x65, 0xcf, 0x22, 0x37, 0x97, 0x96, 0x47, 0xc8, 0x30, 0xa0, 0xb0, 0x5d,
+  0x89, 0xa4, 0x80, 0x6f, 0x30, 0xe2, 0xac, 0x96, 0x0f, 0x32, 0xde, 0x39,
+  0x63, 0xb3, 0x78, 0x7e, 0x0f, 0x78, 0xbd, 0xb4, 0xe7, 0x59, 0x09, 0x64,
+  0x4c, 0x92, 0x9c, 0x06, 0x12, 0xd8, 0x4c, 0x21, 0xc4, 0xd9, 0xc3, 0x69,
+  0x93, 0x24, 0xb9, 0x22, 0xa7, 0xaf, 0xcc, 0x5c, 0x18, 0x5c, 0xc9, 0xc2,
+  0x96, 0x0b, 0xf4, 0xa1, 0x2c, 0x15, 0xb0, 0x63, 0xe1, 0xda, 0x10, 0x99,
+  0xb9, 0x16, 0x4c, 0xd6, 0xd5, 0x0b, 0xed, 0xf1, 0x17, 0x87, 0xf1, 0x91,
+  0x4d, 0x72, 0x06, 0x17, 0x53, 0x23, 0x73, 0xde, 0x36, 0xd7, 0x0e, 0x7b,
+  0x19, 0x8e, 0x42, 0xe7, 0xa4, 0xe3, 0xda, 0xbb, 0x2b, 0xd7, 0x27, 0x2b,
+  0xbd, 0xf2, 0x42, 0x9c, 0xbb, 0x0c, 0x6b, 0xd0, 0xdd, 0x87, 0x5c, 0xc2,
+  0xac, 0xe6, 0x38, 0x45, 0x60, 0x86, 0x24, 0xc9, 0xa1, 0xac, 0x3f, 0xda,
+  0x4b, 0xb3, 0x5d, 0x6e, 0x6b, 0xae, 0xd8, 0xad, 0x78, 0xe1, 0x72, 0x57,
+  0x6e, 0xb7, 0xc6, 0x30, 0x05, 0xec, 0x6c, 0x43, 0xf0, 0xf7, 0xa5, 0x0c,
+  0x0f, 0x28, 0xcd, 0xe5, 0x41, 0x4a, 0xbf, 0xe1, 0x28, 0x4d, 0xa0, 0xed,
+  0xd8, 0x33, 0xb6, 0xbe, 0x0e, 0xd2, 0xcc, 0x45, 0x75, 0x53, 0x1c, 0x2a,
+  0xf7, 0x1d, 0x0b, 0xad, 0xb2, 0x3b, 0x95, 0x67, 0x35, 0xd3, 0x59, 0xd9,
+  0x48, 0xbf, 0x42, 0x41, 0x06, 0x50, 0x1a, 0x27, 0x73, 0x84, 0x90, 0xa5,
+  0x56, 0xc9, 0x6e, 0xc1, 0x3b, 0x01, 0x10, 0x52, 0xe5, 0x54, 0xbb, 0x84,
+  0x84, 0x93, 0xbb, 0x75, 0x4a, 0xe1, 0x66, 0x4a, 0x9b, 0x13, 0xe8, 0xd0,
+  0x2f, 0x57, 0xa9, 0xa6, 0xca, 0x7f, 0x13, 0x8b, 0xdc, 0x5a, 0xc6, 0x4d,
+  0x28, 0x11, 0x24, 0xb6, 0x00, 0x09, 0xce, 0x02, 0xb8, 0xcb, 0xba, 0x74,
+  0x4b, 0x7f, 0x5a, 0xc6, 0x02, 0xe7, 0xdb, 0xd4, 0x3c, 0x27, 0x05, 0xc1,
+  0xbe, 0x1e, 0x73, 0x49, 0x95, 0xf7, 0x65, 0xbd, 0xa3, 0x78, 0x3d, 0x3b,
+  0x0a, 0xf8, 0x15, 0x0e, 0xaf, 0x30, 0x04, 0xb4, 0x0c, 0x32, 0x7a, 0x79,
+  0xa2, 0xfe, 0xc3, 0xf8, 0x0b, 0x6e, 0xd4, 0x9c, 0xab, 0x37, 0x5d, 0x38,
+  0x75, 0x04, 0xa0, 0xa4, 0xe9, 0x43, 0xde, 0x50, 0xd7, 0x63, 0x6f, 0x09,
+  0x1c, 0x46, 0x96, 0x2e, 0x01, 0xd6, 0x67, 0x02, 0xc4, 0x92, 0x97, 0x3c,
+  0x9b, 0xc0, 0xfa, 0xaf, 0x50, 0x5c, 0x11, 0x04, 0xf6, 0x21, 0xa0, 0x39,
+  0x11, 0xa4, 0xa9, 0xa1, 0x7e, 0x10, 0x52, 0xa8, 0xb6, 0xd5, 0xd6, 0xb1,
+  0x97, 0xae, 0x26, 0x49, 0x91, 0x46, 0x8e, 0xdc, 0xe0, 0x20, 0x14, 0x45,
+  0xd5, 0x4b, 0x87, 0xa6, 0x25, 0x0b, 0x4f, 0xa5, 0x45, 0xe9, 0xa3, 0xf5,
+  0xbb, 0x04, 0x5b, 0xc2, 0xcc, 0xf3, 0x66, 0xc9, 0xe8, 0xc2, 0xbe, 0xd6,
+  0xd5, 0xdf, 0xc3, 0x89, 0x60, 0x32, 0xed, 0x96, 0xc3, 0x7b, 0x80, 0x6d,
+  0x73, 0x95, 0x4f, 0xac, 0x70, 0xfc, 0x01, 0xef, 0x1b, 0xb7, 0xb7, 0xed,
+  0x56, 0x4e, 0x0b, 0xc3, 0xe1, 0x16, 0x06, 0x3e, 0xba, 0x52, 0x2e, 0x15,
+  0x30, 0x87, 0x1b, 0x57, 0x40, 0xb0, 0x9b, 0x18, 0x5a, 0xb2, 0x72, 0xa2,
+  0x5a, 0xb7, 0xce, 0xea, 0xa5, 0x01, 0x40, 0x17, 0xdb, 0xed, 0x25, 0xab,
+  0x55, 0x66, 0x75, 0xf5, 0x18, 0xaf, 0x08, 0x14, 0x2c, 0x43, 0x8e, 0x37,
+  0x46, 0xe2, 0x21, 0xf1, 0x3e, 0x65, 0x65, 0x6d, 0xfd, 0xd9, 0x5d, 0xef,
+  0x58, 0xe2, 0x4a, 0x73, 0x7b, 0xae, 0xc0, 0xf3, 0xbc, 0xc4, 0xd3, 0xca,
+  0xde, 0x4c, 0x3b, 0x91, 0x95, 0x8f, 0xbd, 0x10, 0xbf, 0xec, 0x52, 0x2d,
+  0x6a, 0xaf, 0x0f, 0xd7, 0x95, 0xf8, 0x31, 0x4e, 0xc7, 0x67, 0x9f, 0xb0,
+  0x96, 0xb6, 0xa6, 0x8b, 0xa8, 0x65, 0x1e, 0x71, 0x1d, 0xe6, 0xef, 0x31,
+  0xd7, 0xa9, 0xd0, 0x73, 0x02, 0x8c, 0xd5, 0xb6, 0x93, 0xf9, 0x63, 0xec,
+  0x7d, 0x6c, 0x7c, 0xad, 0xfd, 0x20, 0x8a, 0x04, 0x2f, 0xba, 0x7c, 0x18,
+  0x14, 0x9a, 0x9c, 0x3d, 0x7e, 0x18, 0x59, 0x42, 0xaf, 0x89, 0xe4, 0x28,
+  0x60, 0xf7, 0x1f, 0x6e, 0x37, 0xb6, 0x52, 0x7e, 0xdd, 0x7d, 0xfc, 0x0f,
+  0x63, 0x38, 0xcf, 0x37, 0xa3, 0xe8, 0xce, 0xc9, 0x75, 0x24, 0x0b, 0x59,
+  0x83, 0x73, 0x99, 0xb5, 0x8a, 0xdb, 0xc0, 0xab, 0x00, 0xf6, 0xa2, 0x9d,
+  0x16, 0xd1, 0x3b, 0xe3, 0xa0, 0xd5, 0x3e, 0x8a, 0x8e, 0x1b, 0xe6, 0xc8,
+  0x44, 0xe1, 0x68, 0x55, 0xfd, 0x41, 0x11, 0x0b, 0x0d, 0x69, 0x5a, 0xd7,
+  0xc0, 0xe0, 0x19, 0xc6, 0x26, 0x16, 0x19, 0x3b, 0x66, 0xb3, 0xfd, 0x8e,
+  0x9b, 0xf2, 0xcb, 0xaa, 0xfe, 0x2a, 0xa4, 0x7f, 0xcf, 0x05, 0x2c, 0xe3,
+  0x27, 0x74, 0xd7, 0x4d, 0xc2, 0x90, 0x5a, 0x1e, 0x4d, 0xca, 0xd3, 0x3c,
+  0x98, 0x5a, 0x4a, 0x84, 0x08, 0x2d, 0x37, 0x05, 0xd1, 0x1b, 0x20, 0xa3,
+  0x93, 0x75, 0x9c, 0x36, 0xf8, 0x6c, 0xe4, 0x76, 0xd5, 0xb1, 0xb5, 0xb5,
+  0x80, 0x51, 0x82, 0x7d, 0xb4, 0x63, 0xba, 0x88, 0x64, 0x03, 0x6a, 0x54,
+  0xa6, 0x8b, 0xa2, 0x28, 0x2e, 0x04, 0x65, 0xde, 0xd5, 0x41, 0x23, 0x44,
+  0x25, 0xf1, 0x53, 0x98, 0x4b, 0x4c, 0xf5, 0x81, 0x87, 0x12, 0xd4, 0x25,
+  0x44, 0xb0, 0x66, 0x26, 0xc7, 0x95, 0x78, 0xca, 0xf2, 0xd0, 0xc0, 0xdb,
+  0x53, 0x3d, 0x8d, 0x6c, 0xec, 0x28, 0xba, 0xb7, 0x7a, 0x63, 0x64, 0x4d,
+  0x99, 0x41, 0xa1, 0x1f, 0x8a, 0xb0, 0xe4, 0x9e, 0xf1, 0x0d, 0x5a, 0x84,
+  0x03, 0xa3, 0x75, 0x06, 0x77, 0x83, 0x0e, 0x1b, 0x70, 0x63, 0x8f, 0xac,
+  0x8b, 0xcc, 0x99, 0x42, 0x2f, 0x02, 0xac, 0x02, 0x94, 0x8b, 0xc1, 0xa2,
+  0xaf, 0x51, 0x3c, 0xfe, 0x3a, 0x95, 0xeb, 0xb3, 0x8e, 0xe5, 0x5c, 0x91,
+  0xdc, 0x8f, 0x1c, 0x94, 0x16, 0x6d, 0x48, 0x6e, 0x7e, 0x20, 0xa2, 0x35,
+  0xd0, 0x83, 0xf1, 0x52, 0x90, 0x50, 0x09, 0xdd, 0x3e, 0x62, 0xbc, 0xc0,
+  0x1d, 0x6c, 0x21, 0x45, 0x4c, 0xd5, 0x55, 0xd2, 0xeb, 0x35, 0xbc, 0xc8,
+  0xcb, 0xad, 0x3d, 0xac, 0x6d, 0xf8, 0xa0, 0x63, 0xc9, 0x05, 0x77, 0x31,
+  0xbb, 0x63, 0x66, 0x61, 0x88, 0x43, 0xbc, 0xef, 0xa0, 0x0c, 0x5a, 0x0f,
+  0xb3, 0x65, 0x94, 0x18, 0x15, 0xf6, 0xac, 0x88, 0x64, 0xeb, 0xa2, 0x58,
+  0xd9, 0xd8, 0x0d, 0x74, 0x7c, 0xbe, 0xc3, 0x2d, 0x69, 0xe0, 0x52, 0x80,
+  0x14, 0x03, 0xb5, 0xe0, 0xa9, 0xad, 0x17, 0xc0, 0x94, 0x45, 0x11, 0x25,
+  0x0b, 0x48, 0xd3, 0x69, 0x95, 0x0c, 0x5a, 0x6e, 0x09, 0x4c, 0xe8, 0x76,
+  0x01, 0x40, 0x40, 0xaf, 0x08, 0xfc, 0x95, 0x86, 0x3e, 0x84, 0xc6, 0x79,
+  0x09, 0xe9, 0x96, 0x62, 0xaf, 0xc4, 0x3e, 0xc6, 0x7e, 0xb8, 0x6d, 0x49,
+  0x62, 0xa9, 0xe5, 0x36, 0x04, 0x9e, 0x7d, 0x51, 0xe0, 0x1c, 0x7b, 0x2f,
+  0xe5, 0xf7, 0x37, 0x5f, 0x54, 0x8d, 0x3d, 0x13, 0x3b, 0x5b, 0xe4, 0xf2,
+  0xd4, 0x0c, 0x31, 0xdc, 0x4b, 0xdf, 0xd8, 0xfa, 0x0d, 0x9a, 0x27, 0xaa,
+  0x1e, 0x26, 0xb9, 0xae, 0x5e, 0x51, 0x16, 0x0c, 0x29, 0xc3, 0x25, 0x2e,
+  0x3e, 0x4e, 0xaa, 0x72, 0x1f, 0x32, 0xe3, 0xf4, 0x1a, 0xa3, 0x86, 0xf9,
+  0xf3, 0x2e, 0x16, 0x1c, 0x56, 0x1f, 0xc8, 0xa1, 0x00, 0x59, 0x44, 0x4b,
+  0x88, 0x85, 0x3b, 0xfb, 0x32, 0xa7, 0x91, 0xfb, 0x3d, 0xe4, 0x22, 0xce,
+  0xa3, 0xad, 0xac, 0xcd, 0x45, 0xa2, 0xbf, 0xa0, 0xad, 0x05, 0xc0, 0x64,
+  0x3b, 0x86, 0xb9, 0x5c, 0x1e, 0x73, 0x4a, 0x8f, 0x7a, 0x07, 0x91, 0xed,
+  0x72, 0x12, 0xf3, 0x7d, 0x29, 0x66, 0xc3, 0x82, 0xe3, 0xfd, 0x8f, 0xc3,
+  0xc4, 0x17, 0x4e, 0xc1, 0x0e, 0xf8, 0x94, 0x6b, 0x07, 0x10, 0x94, 0x69,
+  0x92, 0x01, 0xf1, 0x6d, 0x48, 0x49, 0xda, 0xee, 0x30, 0x03, 0x31, 0x94,
+  0x17, 0xae, 0x48, 0xc9, 0xb8, 0xfb, 0x1e, 0xb8, 0xf1, 0xa2, 0x80, 0xd1,
+  0x94, 0x7d, 0x70, 0x19, 0x46, 0xe0, 0xb6, 0xab, 0x02, 0xcd, 0xc6, 0xd1,
+  0x47, 0xbd, 0xa5, 0xf3, 0x9f, 0x11, 0xc9, 0x77, 0xfc, 0x94, 0x95, 0xd6,
+  0xd4, 0x8a, 0xf4, 0x4f, 0xb6, 0xed, 0xfa, 0xbb, 0x34, 0xc3, 0x00, 0x0e,
+  0xeb, 0x9e, 0x62, 0xb0, 0x7e, 0x72, 0x8b, 0x70, 0xe8, 0x76, 0x32, 0x44,
+  0x73, 0xd1, 0xb4, 0xd7, 0x86, 0xb5, 0x91, 0x5b, 0xd5, 0xf6, 0x5c, 0x5e,
+  0xbc, 0xb6, 0xe7, 0xdc, 0xa9, 0x2e, 0x07, 0x2f, 0x1e, 0x77, 0x61, 0x4a,
+  0x39, 0x2c, 0xdb, 0x73, 0x1a, 0x9e, 0xe1, 0x48, 0x5c, 0x6c, 0x17, 0x73,
+  0xd9, 0xfa, 0x48, 0x4b, 0x56, 0x1b, 0x0c, 0xb8, 0xd6, 0xbc, 0xc8, 0x36,
+  0x71, 0x6f, 0xcb, 0x28, 0xc5, 0xf2, 0xbf, 0x47, 0x46, 0x97, 0x38, 0xfd,
+  0xa0, 0x21, 0x74, 0x98, 0x42, 0xe2, 0x9c, 0x68, 0xac, 0xbe, 0x96, 0xc9,
+  0x2e, 0x52, 0x5b, 0xba, 0x07, 0x21, 0x8a, 0xc6, 0x21, 0x3c, 0x60, 0x1c,
+  0x21, 0x41, 0x63, 0xc6, 0x4c, 0x52, 0x42, 0x96, 0x5a, 0x48, 0x09, 0x05,
+  0x6c, 0x80, 0x37, 0xf4, 0x60, 0x49, 0xb2, 0x3d, 0x49, 0x98, 0x3b, 0x63,
+  0x86, 0x6d, 0x75, 0xe3, 0x48, 0x36, 0x0f, 0xb6, 0xf5, 0x4d, 0x7b, 0x2e,
+  0x6f, 0x54, 0xd8, 0x2f, 0x7a, 0x71, 0xc4, 0x19, 0xa9, 0xcb, 0xb8, 0x67,
+  0xb2, 0x2d, 0x96, 0xbc, 0x08, 0xfb, 0x71, 0xec, 0x1f, 0x70, 0x65, 0x56,
+  0x7c, 0x43, 0x82, 0xf8, 0xd3, 0x27, 0xfa, 0x31, 0x7f, 0xaa, 0x3e, 0xc9,
+  0x0f, 0x13, 0xfa, 0x86, 0x9b, 0x03, 0x0a, 0xe2, 0xa0, 0x99, 0xdf, 0x13,
+  0x86, 0xfb, 0x48, 0x42, 0x8f, 0x02, 0xad, 0x8f, 0x25, 0xf4, 0xc9, 0x58,
+  0xbb, 0x56, 0xb7, 0xe7, 0x0e, 0xc5, 0x95, 0x44, 0x26, 0x51, 0xf4, 0x89,
+  0x45, 0x94, 0x7b, 0x52, 0x12, 0x2a, 0x6e, 0x97, 0x31, 0xb6, 0x94, 0x51,
+  0xae, 0x16, 0x16, 0x6f, 0xc8, 0x15, 0xf3, 0xd5, 0x34, 0xe5, 0xaa, 0x1e,
+  0x73, 0x33, 0xcd, 0x2a, 0xdd, 0x1b, 0x32, 0x90, 0x13, 0x42, 0x82, 0x48,
+  0x28, 0x42, 0x14, 0x8d, 0xdd, 0xd5, 0xd5, 0x71, 0x28, 0xdd, 0x03, 0xb1,
+  0x3a, 0x57, 0xf1, 0xef, 0x61, 0x0d, 0xe3, 0x01, 0xdc, 0x2e, 0x73, 0x00,
+  0x67, 0x11, 0x23, 0x55, 0x3d, 0xd5, 0x6c, 0x1d, 0xb7, 0x9d, 0xa8, 0xa0,
+  0xf7, 0x32, 0xeb, 0x64, 0x67, 0x32, 0x2a, 0x26, 0x6e, 0x75, 0x26, 0x04,
+  0xa7, 0x45, 0xdc, 0xd6, 0xa0, 0x42, 0xff, 0x08, 0x3e, 0x41, 0x68, 0x44,
+  0xd6, 0xf1, 0xf1, 0x0d, 0x6a, 0x0b, 0x05, 0x5e, 0x99, 0xd0, 0x3f, 0xa9,
+  0xee, 0xf4, 0x8a, 0xfc, 0xf5, 0x9e, 0x3f, 0x55, 0xe8, 0x8f, 0xb5, 0x86,
+  0xa7, 0xb1, 0x94, 0xf2, 0x44, 0xaf, 0xf7, 0x3c, 0xa8, 0x55, 0x8c, 0xa4,
+  0x4d, 0x8b, 0xa0, 0x3d, 0xa7, 0x0c, 0xc2, 0xbf, 0x74, 0x12, 0x4c, 0x71,
+  0xb7, 0x94, 0x88, 0x99, 0xd0, 0x0d, 0xf7, 0xd7, 0xe6, 0x85, 0xdf, 0x2d,
+  0xe2, 0xfa, 0x78, 0x70, 0xb3, 0xfe, 0xa2, 0x0c, 0xcb, 0xa5, 0xdb, 0x32,
+  0xb9, 0x74, 0x63, 0xc5, 0x28, 0xa1, 0xde, 0x1d, 0xad, 0x17, 0x3c, 0x5e,
+  0x87, 0x5e, 0xe7, 0x5a, 0x20, 0x14, 0xcc, 0xcd, 0xcc, 0x7c, 0x27, 0x5b,
+  0x46, 0x4d, 0x81, 0x8c, 0x32, 0x09, 0xdf, 0x79, 0x93, 0x4d, 0x29, 0x21,
+  0xd8, 0x45, 0xc7, 0xd3, 0x8c, 0xe9, 0x76, 0xf2, 0xe2, 0x46, 0x1a, 0xf3,
+  0x33, 0xb9, 0x5e, 0xbd, 0x14, 0x99, 0x12, 0x22, 0xe8, 0xb7, 0x0f, 0xbd,
+  0xff, 0xd7, 0x75, 0x3b, 0xd6, 0xd6, 0x42, 0xf1, 0xcd, 0x74, 0xca, 0xf5,
+  0xff, 0x88, 0xaf, 0x7d, 0xaa, 0xc0, 0xf6, 0xff, 0x33, 0x44, 0x7e, 0x5b,
+  0x8e, 0x27, 0x40, 0x3b, 0x2f, 0x73, 0x29, 0xfb, 0x89, 0x42, 0xe4, 0xdd,
+  0xff, 0x55, 0x88, 0xfc, 0x8d, 0x6d, 0xa4, 0x23, 0x40, 0xea, 0xfb, 0x7a,
+  0x3c, 0x48, 0x57, 0x2d, 0x61, 0x71, 0xfd, 0x4a, 0xe6, 0xd4, 0xc8, 0x61,
+  0x38, 0x6e, 0xa5, 0x61, 0x2d, 0x72, 0xa6, 0xa1, 0x20, 0x54, 0x74, 0xdc,
+  0x3a, 0xb7, 0x6b, 0xfd, 0x0e, 0xb7, 0xe2, 0xb7, 0xab, 0x3c, 0xd0, 0xb5,
+  0x5a, 0x4c, 0x74, 0x49, 0x9e, 0x84, 0x99, 0x5f, 0x04, 0xed, 0x02, 0x07,
+  0x4a, 0xc7, 0x03, 0xdd, 0xa2, 0xd3, 0x3e, 0x54, 0xe5, 0x20, 0xc9, 0x85,
+  0x73, 0xd8, 0xb8, 0x20, 0x34, 0xdd, 0xe8, 0x2a, 0x8a, 0xd8, 0x38, 0xee,
+  0x41, 0x48, 0x95, 0xc6, 0xb5, 0x92, 0x8e, 0x4a, 0xa4, 0x01, 0xb6, 0x69,
+  0x94, 0x6d, 0x46, 0x88, 0xdb, 0x15, 0x32, 0x69, 0x5d, 0x53, 0xea, 0xa0,
+  0x78, 0xda, 0x6a, 0x2c, 0xe8, 0xf4, 0x5a, 0x1a, 0x1e, 0xdd, 0xd8, 0x83,
+  0xdd, 0xb9, 0x7c, 0x37, 0x8f, 0x66, 0x19, 0xb1, 0x4d, 0x82, 0x9a, 0x08,
+  0xbd, 0x27, 0xe4, 0x27, 0x0a, 0x5b, 0xbe, 0xe7, 0x8f, 0x5c, 0xcd, 0x52,
+  0xd0, 0xa6, 0x40, 0x4e, 0x7f, 0x31, 0xe1, 0x44, 0x68, 0x17, 0x42, 0x83,
+  0x62, 0x70, 0x25, 0x3d, 0xed, 0x38, 0x84, 0xe3, 0x91, 0x96, 0xae, 0x18,
+  0x28, 0x8f, 0xd8, 0x14, 0x15, 0xcd, 0xd8, 0x4b, 0x93, 0xcd, 0xb6, 0xdb,
+  0xb1, 0xab, 0x65, 0x0f, 0xe5, 0x38, 0xc7, 0x11, 0x05, 0x7f, 0x32, 0x46,
+  0x81, 0xa9, 0x41, 0x0c, 0x30, 0x96, 0xdc, 0xf0, 0x51, 0xb8, 0x8f, 0x0d,
+  0xe8, 0x96, 0x8b, 0x0a, 0x1e, 0xee, 0x28, 0x65, 0xc4, 0xea, 0x9c, 0xa0,
+  0x95, 0x5c, 0x34, 0xa1, 0x32, 0xd9, 0xea, 0xe8, 0x60, 0xd4, 0x5b, 0xd4,
+  0xe9, 0xf2, 0x48, 0xf7, 0xd0, 0x40, 0xaa, 0x84, 0xda, 0x99, 0xa3, 0x15,
+  0x3d, 0x23, 0xde, 0x80, 0x23, 0xfa, 0x11, 0x85, 0x2d, 0xdf, 0x97, 0xa4,
+  0x2f, 0x21, 0xb1, 0xc6, 0x59, 0xcc, 0x83, 0xf4, 0x85, 0xfa, 0x23, 0x77,
+  0x37, 0x7d, 0xf7, 0xc7, 0xd8, 0x9f, 0xb5, 0x13, 0xc6, 0x63, 0xba, 0xb9,
+  0xe6, 0xd0, 0x11, 0x95, 0xc2, 0x62, 0xcb, 0xb4, 0x96, 0x82, 0xb6, 0xb4,
+  0x16, 0x8a, 0x7b, 0xec, 0xd6, 0x9e, 0x72, 0xa7, 0x41, 0x47, 0x9a, 0xa6,
+  0x63, 0xaf, 0xc9, 0x24, 0x0f, 0xee, 0x9a, 0xaf, 0x95, 0x6d, 0x2e, 0x0c,
+  0xd6, 0xeb, 0xfb, 0x09, 0xad, 0x5c, 0xb3, 0x55, 0x3a, 0xd3, 0x97, 0x26,
+  0x8a, 0x4a, 0x31, 0x2c, 0x08, 0x4d, 0x76, 0xf8, 0xa8, 0x19, 0x6a, 0xfb,
+  0x9f, 0xe4, 0x3a, 0x91, 0x85, 0xb2, 0xe7, 0x84, 0x8a, 0x5d, 0x52, 0xbb,
+  0x3d, 0x4b, 0xb7, 0xcc, 0xcb, 0xff, 0x5b, 0xf1, 0xe8, 0x93, 0xa5, 0x91,
+  0x3f, 0x23, 0x62, 0xa7, 0x02, 0xcf, 0x2c, 0x3a, 0x2e, 0xcf, 0xb8, 0xbf,
+  0x9e, 0xcb, 0xbf, 0xde, 0xa1, 0x31, 0x84, 0xba, 0x2b, 0xcc, 0xd3, 0xa8,
+  0xce, 0xd1, 0x6c, 0xfa, 0x30, 0xe2, 0xfa, 0x80, 0x1b, 0xce, 0xd2, 0xe6,
+  0x47, 0x35, 0xd7, 0x0f, 0x3a, 0x4f, 0x52, 0xaa, 0x15, 0xd1, 0x51, 0xa7,
+  0xd0, 0x00, 0x52, 0xba, 0x06, 0x35, 0xeb, 0x81, 0xca, 0x4b, 0x19, 0xb3,
+  0x87, 0xb9, 0x50, 0xd5, 0x40, 0xea, 0x3b, 0xda, 0xd6, 0x70, 0x8f, 0x0c,
+  0x34, 0x36, 0x98, 0x28, 0x4f, 0x2d, 0x10, 0x35, 0xa7, 0x7c, 0x3c, 0x31,
+  0x7c, 0x3a, 0x47, 0x79, 0x73, 0x45, 0x16, 0xa8, 0xdd, 0x32, 0x3b, 0xcc,
+  0xda, 0xa7, 0x53, 0x64, 0xe1, 0x89, 0xe7, 0x64, 0xd2, 0x5e, 0xde, 0x85,
+  0xd8, 0x92, 0x05, 0x0f, 0x77, 0x61, 0x7b, 0xa7, 0x16, 0x2c, 0x5d, 0x98,
+  0xc8, 0xe3, 0x68, 0x7b, 0x88, 0x60, 0x39, 0x54, 0x27, 0x9b, 0x13, 0xa0,
+  0xe5, 0xb2, 0xcd, 0x66, 0x87, 0x29, 0xba, 0xb3, 0x1b, 0x80, 0x44, 0x53,
+  0x96, 0xb2, 0x62, 0x94, 0x65, 0xb9, 0x4b, 0xb5, 0xcf, 0x5f, 0xd6, 0xd5,
+  0x2b, 0x02, 0x21, 0x54, 0x8a, 0xd9, 0xce, 0x85, 0xf1, 0x72, 0x92, 0x62,
+  0x31, 0x69, 0x32, 0x9b, 0x9e, 0xd1, 0x0e, 0x80, 0x1b, 0x8a, 0xaa, 0x0f,
+  0xfc, 0xd4, 0x24, 0x90, 0xf4, 0xda, 0x49, 0x1c, 0x37, 0x7f, 0x60, 0x2c,
+  0xf9, 0x80, 0x1b, 0x55, 0x99, 0xa9, 0x0d, 0x5b, 0xae, 0xfb, 0xb9, 0x26,
+  0x4e, 0xcc, 0x5e, 0xd4, 0xab, 0xf4, 0xeb, 0xde, 0xb5, 0x8d, 0x34, 0xf1,
+  0xcc, 0xd8, 0x39, 0x44, 0xae, 0xda, 0x09, 0x66, 0x96, 0x28, 0x91, 0xd7,
+  0x66, 0x5d, 0x90, 0x70, 0x35, 0xbc, 0x75, 0xe2, 0x2d, 0x53, 0x0f, 0xd2,
+  0xcc, 0xe6, 0xae, 0xd2, 0xed, 0x42, 0x41, 0x75, 0x5d, 0xb1, 0x01, 0x92,
+  0x06, 0xe6, 0xfd, 0x5d, 0x99, 0xdb, 0xd0, 0xfa, 0x24, 0x9a, 0x8c, 0xfa,
+  0x49, 0x60, 0xbb, 0x91, 0x7c, 0x5a, 0xac, 0x2d, 0x0f, 0x48, 0xe7, 0xb3,
+  0x30, 0xd4, 0xec, 0x47, 0xe4, 0x39, 0x6d, 0x64, 0xb0, 0xf9, 0xf5, 0xd2,
+  0x19, 0x99, 0xe2, 0x26, 0x86, 0x3f, 0xa2, 0xdc, 0x19, 0xa5, 0x25, 0x73,
+  0x49, 0xe4, 0x3e, 0xc8, 0xf2, 0xdd, 0xbb, 0x2f, 0xd6, 0xa9, 0x01, 0x11,
+  0x17, 0xef, 0x59, 0x99, 0x77, 0xf6, 0xd7, 0x69, 0xe1, 0x97, 0x04, 0x6a,
+  0xdd, 0x29, 0x2f, 0x37, 0xe6, 0x95, 0xbe, 0xad, 0xf9, 0x23, 0x19, 0x48,
+  0x93, 0x2f, 0x49, 0x8a, 0x81, 0x1c, 0xca, 0x66, 0x8e, 0x12, 0x7a, 0x93,
+  0x3b, 0xbc, 0xb6, 0x28, 0xda, 0xa6, 0xe1, 0x06, 0x10, 0xbf, 0xe7, 0x09,
+  0x49, 0xbe, 0x4b, 0x9a, 0x66, 0x9a, 0xaf, 0x90, 0xe2, 0x61, 0xa9, 0xd9,
+  0xab, 0x49, 0x32, 0x99, 0x8c, 0xe9, 0xbf, 0x23, 0xee, 0xf8, 0xe3, 0x9e,
+  0x5f, 0x96, 0x99, 0xbf, 0x7e, 0x30, 0x6b, 0x36, 0x63, 0xb8, 0x2b, 0xcd,
+  0x9e, 0xa5, 0xb1, 0xd0, 0x9d, 0x47, 0x46, 0xb4, 0x3c, 0xc6, 0x46, 0x56,
+  0x38, 0x12, 0x19, 0x18, 0x63, 0x7a, 0xac, 0x1b, 0x0f, 0x1b, 0xa7, 0xf2,
+  0xcb, 0x33, 0xba, 0x20, 0x3d, 0x17, 0xc8, 0x95, 0xa1, 0x85, 0x77, 0x74,
+  0x5e, 0x16, 0x5d, 0x7e, 0x97, 0x76, 0x33, 0x73, 0xbd, 0xe8, 0xd3, 0xd3,
+  0x28, 0x50, 0x9a, 0x24, 0xc3, 0x64, 0x6c, 0x6a, 0xd3, 0x5d, 0xbd, 0x97,
+  0x34, 0x8f, 0x8c, 0xcd, 0x75, 0xe7, 0x6b, 0x63, 0x78, 0x2a, 0xbd, 0x69,
+  0xba, 0x47, 0x25, 0x6f, 0x92, 0x12, 0x99, 0xfb, 0xfb, 0xb5, 0xce, 0x64,
+  0xd3, 0x73, 0x13, 0xe3, 0xe4, 0x99, 0xe7, 0x69, 0x76, 0x29, 0x8f, 0x70,
+  0xf2, 0x6c, 0xe4, 0x6c, 0x66, 0x68, 0x52, 0x84, 0xb4, 0xcd, 0xb0, 0xea,
+  0xc4, 0x43, 0x6e, 0xc1, 0xa4, 0x81, 0x05, 0xd6, 0x5f, 0x39, 0x74, 0xc1,
+  0x9e, 0x1b, 0xf3, 0x6d, 0xeb, 0xf9, 0x72, 0xc0, 0x01, 0x95, 0x96, 0x35,
+  0x79, 0x82, 0x7c, 0x31, 0x59, 0x38, 0xc5, 0x07, 0x39, 0x26, 0x85, 0x52,
+  0x7b, 0x70, 0x33, 0xeb, 0x92, 0xee, 0x12, 0x6e, 0xa7, 0x8d, 0x14, 0xa1,
+  0x1a, 0x70, 0x73, 0x6d, 0xcc, 0x2b, 0xe6, 0xe3, 0x66, 0xd9, 0x24, 0xd3,
+  0xbc, 0xa6, 0x34, 0x9d, 0x65, 0x52, 0x57, 0x6e, 0x1a, 0xf3, 0x89, 0xd2,
+  0x12, 0x19, 0x39, 0x89, 0x69, 0xfc, 0x78, 0x3a, 0xdb, 0xad, 0x88, 0xf7,
+  0xab, 0x72, 0xbc, 0x03, 0xb3, 0xc4, 0x57, 0xdf, 0xf5, 0xa2, 0x65, 0xef,
+  0x98, 0x57, 0x30, 0xd3, 0x68, 0xa7, 0x76, 0x4a, 0xa7, 0x5b, 0xe0, 0xc2,
+  0x32, 0x3f, 0x9c, 0xb4, 0xb9, 0x1c, 0x85, 0x78, 0x6c, 0xee, 0x66, 0x2e,
+  0xfa, 0xe2, 0x1d, 0x4e, 0xe9, 0xbf, 0xcf, 0xdf, 0x40, 0x9d, 0xbf, 0x79,
+  0xba, 0x54, 0x56, 0xba, 0xc9, 0x49, 0x2f, 0xb1, 0x92, 0x80, 0xf2, 0x6b,
+  0xbc, 0xd5, 0xdd, 0xe5, 0xf1, 0xd3, 0x3a, 0x99, 0x3c, 0x30, 0x1f, 0x75,
+  0x7b, 0x58, 0x09, 0x6e, 0xbd, 0xa0, 0xe9, 0x63, 0xca, 0x45, 0xc9, 0x0e,
+  0x66, 0x0e, 0xfb, 0x6a, 0xf6, 0xba, 0xba, 0x29, 0x26, 0x8e, 0x1e, 0xd6,
+  0x78, 0x05, 0x4b, 0x52, 0x56, 0x31, 0xf5, 0x46, 0x4b, 0x7e, 0x79, 0xc9,
+  0x2f, 0xc9, 0xc2, 0x35, 0x26, 0x65, 0x34, 0x53, 0x3b, 0xdd, 0x54, 0x7c,
+  0xbf, 0x26, 0xfd, 0x8f, 0x62, 0x5a, 0x0b, 0xa1, 0x91, 0xf4, 0xb3, 0x1f,
+  0x86, 0xe3, 0x77, 0x9f, 0x7f, 0x7e, 0x90, 0x9d, 0xd7, 0xa1, 0xdf, 0x7d,
+  0x4e, 0x24, 0x3f, 0xa7, 0xcd, 0x3e, 0x5f, 0x17, 0xb7, 0xa0, 0x20, 0x9f,
+  0xef, 0x41, 0x19, 0x51, 0x47, 0xdf, 0xa7, 0x7a, 0x89, 0xca, 0x8a, 0xc5,
+  0xfb, 0xd1, 0xb3, 0xbb, 0x09, 0xd9, 0x7e, 0xba, 0xa2, 0x2c, 0x6e, 0x8b,
+  0x97, 0xab, 0xda, 0xa0, 0x43, 0x08, 0x37, 0x6c, 0xee, 0x7c, 0x4d, 0xfd,
+  0xf2, 0xc5, 0xf7, 0xcf, 0x7f, 0x7e, 0xfd, 0xdc, 0xa4, 0xd7, 0x15, 0x71,
+  0x71, 0xdd, 0xba, 0x07, 0x38, 0xb9, 0x94, 0x64, 0x54, 0x7a, 0xde, 0x2a,
+  0xb8, 0xb2, 0xc5, 0x34, 0x4b, 0x7e, 0xa7, 0xaf, 0xf5, 0x6f, 0x9c, 0x56,
+  0x05, 0x21, 0xbc, 0x31, 0x39, 0x02, 0xd8, 0xe9, 0x1a, 0x20, 0x0f, 0x59,
+  0x34, 0x4d, 0x39, 0xa9, 0x2c, 0x83, 0x12, 0xc3, 0x34, 0x6a, 0x41, 0x42,
+  0x9f, 0x66, 0x46, 0xf2, 0x6b, 0x41, 0x85, 0x25, 0xfd, 0x8d, 0x2c, 0xe9,
+  0xc3, 0x5e, 0xc0, 0xfe, 0x6f, 0xd8, 0xd5, 0x47, 0x58, 0xd9, 0x87, 0x9d,
+  0x01, 0xe3, 0x81, 0xa6, 0x92, 0xf7, 0xbb, 0xa6, 0x38, 0xfd, 0xea, 0xea,
+  0xff, 0x34, 0x21, 0xdb, 0xa0, 0xf9, 0x2f, 0xad, 0x02, 0xb4, 0x88
 };
-unsigned int LICENSE_len = 16725;
+static constexpr unsigned int LICENSE_len = 5303;
@@ -1,851 +1,304 @@
-unsigned char openssl_txt[] = {
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x70,
-  0x61, 0x63, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x32, 0x2e, 0x30, 0x2c, 0x20, 0x4a, 0x61, 0x6e, 0x75, 0x61, 0x72, 0x79,
-  0x20, 0x32, 0x30, 0x30, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a,
-  0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x61, 0x70, 0x61, 0x63, 0x68, 0x65,
-  0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x73, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x54, 0x45, 0x52, 0x4d, 0x53,
-  0x20, 0x41, 0x4e, 0x44, 0x20, 0x43, 0x4f, 0x4e, 0x44, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x53, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x55, 0x53, 0x45, 0x2c,
-  0x20, 0x52, 0x45, 0x50, 0x52, 0x4f, 0x44, 0x55, 0x43, 0x54, 0x49, 0x4f,
-  0x4e, 0x2c, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x44, 0x49, 0x53, 0x54, 0x52,
-  0x49, 0x42, 0x55, 0x54, 0x49, 0x4f, 0x4e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x31, 0x2e, 0x20, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x22, 0x20, 0x73, 0x68, 0x61,
-  0x6c, 0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f,
-  0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f, 0x64,
-  0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x53, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x31, 0x20, 0x74, 0x68, 0x72, 0x6f,
-  0x75, 0x67, 0x68, 0x20, 0x39, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x22, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20,
-  0x6d, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70,
-  0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72,
-  0x20, 0x6f, 0x72, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x61,
-  0x75, 0x74, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
-  0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x77, 0x6e,
-  0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x67,
-  0x72, 0x61, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x22, 0x4c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x45,
-  0x6e, 0x74, 0x69, 0x74, 0x79, 0x22, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c,
-  0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e,
-  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
-  0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65, 0x6e, 0x74,
-  0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65,
-  0x6e, 0x74, 0x69, 0x74, 0x79, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x22, 0x20,
-  0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x28, 0x69, 0x29, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2c, 0x20, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x61, 0x75, 0x73,
-  0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72,
-  0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x65, 0x6e, 0x74, 0x69,
-  0x74, 0x79, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20,
-  0x62, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20,
-  0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x28,
-  0x69, 0x69, 0x29, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69,
-  0x70, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x66, 0x74, 0x79, 0x20, 0x70,
-  0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x20, 0x28, 0x35, 0x30, 0x25, 0x29,
-  0x20, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75,
-  0x74, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x68,
-  0x61, 0x72, 0x65, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x69,
-  0x69, 0x29, 0x20, 0x62, 0x65, 0x6e, 0x65, 0x66, 0x69, 0x63, 0x69, 0x61,
-  0x6c, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20,
-  0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x65, 0x6e, 0x74, 0x69,
-  0x74, 0x79, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-  0x59, 0x6f, 0x75, 0x22, 0x20, 0x28, 0x6f, 0x72, 0x20, 0x22, 0x59, 0x6f,
-  0x75, 0x72, 0x22, 0x29, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6d,
-  0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76,
-  0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x4c, 0x65, 0x67,
-  0x61, 0x6c, 0x20, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x72, 0x63, 0x69, 0x73, 0x69,
-  0x6e, 0x67, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f,
-  0x6e, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-  0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-  0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65,
-  0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d,
-  0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69,
-  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69, 0x6d,
-  0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6f, 0x66, 0x74,
-  0x77, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4f, 0x62, 0x6a, 0x65, 0x63,
-  0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x68, 0x61, 0x6c,
-  0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x66,
-  0x6f, 0x72, 0x6d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e,
-  0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6d, 0x65, 0x63, 0x68, 0x61,
-  0x6e, 0x69, 0x63, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x53,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2c, 0x20,
-  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75,
-  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-  0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63,
-  0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x6f, 0x62, 0x6a, 0x65,
-  0x63, 0x74, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x67, 0x65, 0x6e,
-  0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x6f,
-  0x74, 0x68, 0x65, 0x72, 0x20, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x74,
-  0x79, 0x70, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x22, 0x57, 0x6f, 0x72, 0x6b, 0x22, 0x20, 0x73, 0x68, 0x61, 0x6c,
-  0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
-  0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f,
-  0x72, 0x73, 0x68, 0x69, 0x70, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
-  0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x62,
-  0x6a, 0x65, 0x63, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x6d,
-  0x61, 0x64, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x73, 0x20,
-  0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79,
-  0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x70,
-  0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63,
-  0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72,
-  0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x28, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x61, 0x6d,
-  0x70, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41,
-  0x70, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x78, 0x20, 0x62, 0x65, 0x6c, 0x6f,
-  0x77, 0x29, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-  0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x73, 0x22, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20,
-  0x6d, 0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69,
-  0x6e, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20,
-  0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x69, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20,
-  0x28, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x20,
-  0x66, 0x72, 0x6f, 0x6d, 0x29, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x77,
-  0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x65, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x69, 0x61, 0x6c,
-  0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20,
-  0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
-  0x20, 0x65, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
-  0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x72,
-  0x65, 0x73, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20,
-  0x77, 0x68, 0x6f, 0x6c, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x72,
-  0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20,
-  0x6f, 0x66, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x73, 0x68, 0x69,
-  0x70, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
-  0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20,
-  0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x6f, 0x72,
-  0x20, 0x6d, 0x65, 0x72, 0x65, 0x6c, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
-  0x20, 0x28, 0x6f, 0x72, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x20, 0x62, 0x79,
-  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x73,
-  0x20, 0x6f, 0x66, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6f, 0x66,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20,
-  0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x61,
-  0x75, 0x74, 0x68, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70, 0x2c, 0x20, 0x69,
-  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69,
-  0x6e, 0x61, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6d, 0x6f, 0x64, 0x69,
-  0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x72,
-  0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x72, 0x20, 0x44, 0x65, 0x72,
-  0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6f, 0x66, 0x2c, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
-  0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x65,
-  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x62,
-  0x79, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64,
-  0x75, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x4c, 0x65, 0x67, 0x61, 0x6c,
-  0x20, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x61, 0x75, 0x74, 0x68,
-  0x6f, 0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x75,
-  0x62, 0x6d, 0x69, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x68, 0x61,
-  0x6c, 0x66, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x2e, 0x20, 0x46, 0x6f, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x22, 0x73,
-  0x75, 0x62, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x6c,
-  0x65, 0x63, 0x74, 0x72, 0x6f, 0x6e, 0x69, 0x63, 0x2c, 0x20, 0x76, 0x65,
-  0x72, 0x62, 0x61, 0x6c, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x72, 0x69,
-  0x74, 0x74, 0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
-  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x74, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x6f, 0x72,
-  0x20, 0x69, 0x74, 0x73, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65,
-  0x6e, 0x74, 0x61, 0x74, 0x69, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75, 0x74, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20,
-  0x74, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6d,
-  0x6d, 0x75, 0x6e, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
-  0x6e, 0x20, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x6f, 0x6e, 0x69, 0x63,
-  0x20, 0x6d, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x69, 0x73,
-  0x74, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63,
-  0x6f, 0x64, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20,
-  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x73, 0x75, 0x65,
-  0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x79,
-  0x73, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61,
-  0x72, 0x65, 0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x68,
-  0x61, 0x6c, 0x66, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x6f, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
-  0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x69,
-  0x73, 0x63, 0x75, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x69, 0x6d, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x62, 0x75, 0x74,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75,
-  0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
-  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x69, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x70, 0x69, 0x63, 0x75, 0x6f,
-  0x75, 0x73, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x20,
-  0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67,
-  0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x72, 0x69,
-  0x74, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x77,
-  0x6e, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x22, 0x4e, 0x6f, 0x74, 0x20,
-  0x61, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69,
-  0x6f, 0x6e, 0x2e, 0x22, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72,
-  0x22, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6d, 0x65, 0x61, 0x6e,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69,
-  0x64, 0x75, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x4c, 0x65, 0x67, 0x61,
-  0x6c, 0x20, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x68, 0x61, 0x6c, 0x66,
-  0x20, 0x6f, 0x66, 0x20, 0x77, 0x68, 0x6f, 0x6d, 0x20, 0x61, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x63,
-  0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75, 0x65,
-  0x6e, 0x74, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f,
-  0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x32, 0x2e, 0x20, 0x47, 0x72, 0x61, 0x6e, 0x74, 0x20,
-  0x6f, 0x66, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x20, 0x53, 0x75,
-  0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
-  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x65, 0x61, 0x63,
-  0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f,
-  0x72, 0x20, 0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x67, 0x72, 0x61,
-  0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x61,
-  0x20, 0x70, 0x65, 0x72, 0x70, 0x65, 0x74, 0x75, 0x61, 0x6c, 0x2c, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x77,
-  0x69, 0x64, 0x65, 0x2c, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x65, 0x78, 0x63,
-  0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x6e, 0x6f, 0x2d, 0x63,
-  0x68, 0x61, 0x72, 0x67, 0x65, 0x2c, 0x20, 0x72, 0x6f, 0x79, 0x61, 0x6c,
-  0x74, 0x79, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x2c, 0x20, 0x69, 0x72, 0x72,
-  0x65, 0x76, 0x6f, 0x63, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x72, 0x65, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x2c, 0x20, 0x70,
-  0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20,
-  0x6f, 0x66, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75,
-  0x62, 0x6c, 0x69, 0x63, 0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
-  0x61, 0x79, 0x2c, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x6c, 0x79,
-  0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x73, 0x75,
-  0x62, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x75, 0x63, 0x68,
-  0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
-  0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75,
-  0x72, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x4f, 0x62, 0x6a, 0x65, 0x63,
-  0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x33, 0x2e, 0x20, 0x47, 0x72, 0x61, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20,
-  0x50, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2e, 0x20, 0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20,
-  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x68, 0x65, 0x72, 0x65,
-  0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x70, 0x65,
-  0x74, 0x75, 0x61, 0x6c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x77, 0x6f, 0x72, 0x6c, 0x64, 0x77, 0x69, 0x64, 0x65, 0x2c, 0x20, 0x6e,
-  0x6f, 0x6e, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x76, 0x65,
-  0x2c, 0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x2c,
-  0x20, 0x72, 0x6f, 0x79, 0x61, 0x6c, 0x74, 0x79, 0x2d, 0x66, 0x72, 0x65,
-  0x65, 0x2c, 0x20, 0x69, 0x72, 0x72, 0x65, 0x76, 0x6f, 0x63, 0x61, 0x62,
-  0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x65, 0x78,
-  0x63, 0x65, 0x70, 0x74, 0x20, 0x61, 0x73, 0x20, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x70, 0x61, 0x74, 0x65,
-  0x6e, 0x74, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x74,
-  0x6f, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x2c, 0x20, 0x68, 0x61, 0x76, 0x65,
-  0x20, 0x6d, 0x61, 0x64, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x75, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72, 0x20,
-  0x74, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x6c, 0x2c, 0x20, 0x73, 0x65, 0x6c,
-  0x6c, 0x2c, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
-  0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73, 0x75, 0x63, 0x68,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x61, 0x70, 0x70,
-  0x6c, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x6f,
-  0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e,
-  0x74, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x6c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73,
-  0x73, 0x61, 0x72, 0x69, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x66, 0x72, 0x69,
-  0x6e, 0x67, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x69,
-  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x29, 0x20,
-  0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20,
-  0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x43, 0x6f, 0x6e,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74, 0x6f, 0x20,
-  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x28,
-  0x73, 0x29, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x69,
-  0x74, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x59, 0x6f, 0x75,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x69,
-  0x74, 0x75, 0x74, 0x65, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20,
-  0x6c, 0x69, 0x74, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61,
-  0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x65,
-  0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x28, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-  0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x63, 0x6c, 0x61, 0x69, 0x6d,
-  0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x63,
-  0x6c, 0x61, 0x69, 0x6d, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x61,
-  0x77, 0x73, 0x75, 0x69, 0x74, 0x29, 0x20, 0x61, 0x6c, 0x6c, 0x65, 0x67,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6f, 0x72, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70,
-  0x6f, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x73, 0x20, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x79, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x69,
-  0x6e, 0x66, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2c,
-  0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x61,
-  0x74, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x61, 0x6e,
-  0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x73, 0x68, 0x61, 0x6c,
-  0x6c, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x6c, 0x69, 0x74, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x64, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x34, 0x2e, 0x20, 0x52, 0x65, 0x64, 0x69, 0x73, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x59, 0x6f,
-  0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f, 0x64,
-  0x75, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x72, 0x20, 0x44,
-  0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6f, 0x66, 0x20,
-  0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6d, 0x65, 0x64, 0x69, 0x75,
-  0x6d, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x72, 0x20, 0x77,
-  0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x53,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x4f, 0x62, 0x6a,
-  0x65, 0x63, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2c, 0x20, 0x70, 0x72,
-  0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x59, 0x6f, 0x75, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65,
-  0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f,
-  0x77, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x28, 0x61, 0x29, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74,
-  0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74,
-  0x68, 0x65, 0x72, 0x20, 0x72, 0x65, 0x63, 0x69, 0x70, 0x69, 0x65, 0x6e,
-  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69,
-  0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x61, 0x20, 0x63,
-  0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x3b, 0x20, 0x61, 0x6e, 0x64,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x29, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x63, 0x61, 0x75,
-  0x73, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66,
-  0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x6f,
-  0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69,
-  0x6e, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x74, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x3b, 0x20, 0x61,
-  0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63,
-  0x29, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x72,
-  0x65, 0x74, 0x61, 0x69, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x6d, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x44, 0x65, 0x72,
-  0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x64, 0x69, 0x73,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x2c, 0x20, 0x61, 0x6c, 0x6c,
-  0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20,
-  0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x72, 0x61, 0x64,
-  0x65, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x68, 0x6f, 0x73, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74,
-  0x20, 0x70, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x74, 0x6f, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x3b, 0x20, 0x61, 0x6e, 0x64, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x64, 0x29, 0x20, 0x49,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x69,
-  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x20, 0x61, 0x20, 0x22, 0x4e,
-  0x4f, 0x54, 0x49, 0x43, 0x45, 0x22, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
-  0x66, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74,
-  0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74,
-  0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x63,
-  0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x69, 0x6e, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x4e, 0x4f, 0x54, 0x49,
-  0x43, 0x45, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x20, 0x65, 0x78, 0x63,
-  0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x74, 0x61,
-  0x69, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x61,
-  0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x65,
-  0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65,
-  0x61, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x70,
-  0x6c, 0x61, 0x63, 0x65, 0x73, 0x3a, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69,
-  0x6e, 0x20, 0x61, 0x20, 0x4e, 0x4f, 0x54, 0x49, 0x43, 0x45, 0x20, 0x74,
-  0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x73,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x20, 0x70, 0x61,
-  0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x65,
-  0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x73, 0x3b, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f,
-  0x72, 0x6d, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x70, 0x72,
-  0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x67,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x65,
-  0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x73, 0x3b, 0x20, 0x6f, 0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e,
-  0x20, 0x61, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x67,
-  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69,
-  0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x2c, 0x20, 0x69, 0x66,
-  0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x76, 0x65, 0x72, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x2d, 0x70,
-  0x61, 0x72, 0x74, 0x79, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73,
-  0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 0x70,
-  0x70, 0x65, 0x61, 0x72, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4e, 0x4f, 0x54, 0x49, 0x43, 0x45, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20,
-  0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x66, 0x6f,
-  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x75,
-  0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20,
-  0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x64,
-  0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79,
-  0x20, 0x61, 0x64, 0x64, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x6f, 0x77,
-  0x6e, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f,
-  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x69, 0x6e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x2c, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x69,
-  0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6f, 0x72, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x64,
-  0x64, 0x65, 0x6e, 0x64, 0x75, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4e, 0x4f, 0x54, 0x49, 0x43, 0x45, 0x20, 0x74, 0x65, 0x78,
-  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65,
-  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x64,
-  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x61, 0x74, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74,
-  0x69, 0x63, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20,
-  0x62, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x65, 0x64,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
-  0x73, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x69, 0x6e, 0x67, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x59, 0x6f, 0x75, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x61, 0x64, 0x64, 0x20, 0x59, 0x6f, 0x75, 0x72,
-  0x20, 0x6f, 0x77, 0x6e, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x20, 0x74, 0x6f, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x6d, 0x6f, 0x64,
-  0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61,
-  0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x79,
-  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 0x64, 0x64,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x64,
-  0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x75, 0x73, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f, 0x64, 0x75,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
-  0x66, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66,
-  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x6f, 0x72,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x44, 0x65, 0x72, 0x69,
-  0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73,
-  0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x2c,
-  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x59, 0x6f,
-  0x75, 0x72, 0x20, 0x75, 0x73, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x74,
-  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c,
-  0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x64,
-  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x35, 0x2e,
-  0x20, 0x53, 0x75, 0x62, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x66, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x55, 0x6e, 0x6c, 0x65, 0x73, 0x73,
-  0x20, 0x59, 0x6f, 0x75, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69,
-  0x74, 0x6c, 0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x74,
-  0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x75,
-  0x62, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x6f, 0x72, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20,
-  0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65,
-  0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x64,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
-  0x74, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f,
-  0x72, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x74, 0x77,
-  0x69, 0x74, 0x68, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x6e,
-  0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x65, 0x72, 0x65, 0x69,
-  0x6e, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x65,
-  0x72, 0x73, 0x65, 0x64, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64,
-  0x69, 0x66, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20,
-  0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x61, 0x67, 0x72, 0x65,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61,
-  0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75,
-  0x74, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20,
-  0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x75,
-  0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x36, 0x2e,
-  0x20, 0x54, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x2e,
-  0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x67,
-  0x72, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x72,
-  0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x2c, 0x20, 0x73, 0x65,
-  0x72, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20,
-  0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20,
-  0x61, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6f,
-  0x6d, 0x61, 0x72, 0x79, 0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x20,
-  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x69,
-  0x67, 0x69, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x70, 0x72,
-  0x6f, 0x64, 0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4e, 0x4f, 0x54, 0x49, 0x43, 0x45, 0x20, 0x66, 0x69,
-  0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x37, 0x2e, 0x20, 0x44,
-  0x69, 0x73, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x6f, 0x66,
-  0x20, 0x57, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x2e, 0x20, 0x55,
-  0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x6c, 0x61, 0x77, 0x20, 0x6f, 0x72, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69,
-  0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x6f, 0x72,
-  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x28, 0x61, 0x6e, 0x64, 0x20,
-  0x65, 0x61, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
-  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x70,
-  0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20,
-  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x29, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x22, 0x41, 0x53,
-  0x20, 0x49, 0x53, 0x22, 0x20, 0x42, 0x41, 0x53, 0x49, 0x53, 0x2c, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55,
-  0x54, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x49, 0x45, 0x53,
-  0x20, 0x4f, 0x52, 0x20, 0x43, 0x4f, 0x4e, 0x44, 0x49, 0x54, 0x49, 0x4f,
-  0x4e, 0x53, 0x20, 0x4f, 0x46, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x4b, 0x49,
-  0x4e, 0x44, 0x2c, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65,
-  0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x2c,
-  0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x2c, 0x20,
-  0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6d, 0x69,
-  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x79, 0x20,
-  0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x69, 0x65, 0x73, 0x20, 0x6f,
-  0x72, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x49,
-  0x54, 0x4c, 0x45, 0x2c, 0x20, 0x4e, 0x4f, 0x4e, 0x2d, 0x49, 0x4e, 0x46,
-  0x52, 0x49, 0x4e, 0x47, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x2c, 0x20, 0x4d,
-  0x45, 0x52, 0x43, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49,
-  0x54, 0x59, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x46, 0x49, 0x54, 0x4e, 0x45,
-  0x53, 0x53, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x55, 0x4c, 0x41,
-  0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f, 0x53, 0x45, 0x2e, 0x20, 0x59,
-  0x6f, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6f, 0x6c, 0x65, 0x6c,
-  0x79, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c,
-  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d,
-  0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69,
-  0x61, 0x74, 0x65, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x75,
-  0x73, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x64, 0x69,
-  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x69, 0x73, 0x6b, 0x73, 0x20, 0x61,
-  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x65, 0x78, 0x65, 0x72,
-  0x63, 0x69, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x65, 0x72, 0x6d,
-  0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x38, 0x2e, 0x20, 0x4c,
-  0x69, 0x6d, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
-  0x20, 0x4c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x20,
-  0x49, 0x6e, 0x20, 0x6e, 0x6f, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6e, 0x6f,
-  0x20, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6f, 0x72,
-  0x79, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x65,
-  0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x6f, 0x72, 0x74,
-  0x20, 0x28, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x6e, 0x65, 0x67, 0x6c, 0x69, 0x67, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x2c,
-  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x63, 0x74, 0x2c, 0x20, 0x6f,
-  0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73,
-  0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x6c, 0x61, 0x77, 0x20, 0x28, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61,
-  0x73, 0x20, 0x64, 0x65, 0x6c, 0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 0x65,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x72, 0x6f, 0x73, 0x73, 0x6c, 0x79,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x67, 0x6c, 0x69,
-  0x67, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x63, 0x74, 0x73, 0x29, 0x20, 0x6f,
-  0x72, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
-  0x69, 0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x2c, 0x20,
-  0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x62, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x74, 0x6f, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x6e,
-  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
-  0x6c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x63,
-  0x69, 0x64, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6f, 0x72, 0x20,
-  0x63, 0x6f, 0x6e, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
-  0x6c, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
-  0x65, 0x72, 0x20, 0x61, 0x72, 0x69, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x61,
-  0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-  0x73, 0x75, 0x6c, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20,
-  0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75,
-  0x73, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x61, 0x62, 0x69, 0x6c,
-  0x69, 0x74, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74,
-  0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x28, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69, 0x6d,
-  0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x61, 0x6d, 0x61,
-  0x67, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x73, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x67, 0x6f, 0x6f, 0x64, 0x77, 0x69, 0x6c, 0x6c,
-  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x6b,
-  0x20, 0x73, 0x74, 0x6f, 0x70, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x63,
-  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x66, 0x61, 0x69, 0x6c,
-  0x75, 0x72, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x6c, 0x66, 0x75,
-  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61,
-  0x6e, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63,
-  0x6f, 0x6d, 0x6d, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x64, 0x61,
-  0x6d, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x73,
-  0x73, 0x65, 0x73, 0x29, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x69,
-  0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x64,
-  0x76, 0x69, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79,
-  0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x64, 0x61, 0x6d,
-  0x61, 0x67, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x39, 0x2e,
-  0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x57,
-  0x61, 0x72, 0x72, 0x61, 0x6e, 0x74, 0x79, 0x20, 0x6f, 0x72, 0x20, 0x41,
-  0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x4c, 0x69,
-  0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x20, 0x57, 0x68, 0x69,
-  0x6c, 0x65, 0x20, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x6f, 0x72, 0x20,
-  0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6f, 0x66,
-  0x2c, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x68,
-  0x6f, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x66, 0x66, 0x65,
-  0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x20, 0x61, 0x20, 0x66, 0x65,
-  0x65, 0x20, 0x66, 0x6f, 0x72, 0x2c, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70,
-  0x70, 0x6f, 0x72, 0x74, 0x2c, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e,
-  0x74, 0x79, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x6d, 0x6e, 0x69, 0x74,
-  0x79, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x20,
-  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c,
-  0x69, 0x74, 0x79, 0x20, 0x6f, 0x62, 0x6c, 0x69, 0x67, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x73,
-  0x74, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
-  0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2e, 0x20, 0x48, 0x6f, 0x77, 0x65, 0x76, 0x65,
-  0x72, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x62, 0x6c,
-  0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x59, 0x6f,
-  0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x61, 0x63, 0x74, 0x20, 0x6f, 0x6e,
-  0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x6e, 0x20,
-  0x59, 0x6f, 0x75, 0x72, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x62, 0x65, 0x68,
-  0x61, 0x6c, 0x66, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x59,
-  0x6f, 0x75, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x65, 0x20, 0x72, 0x65, 0x73,
-  0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2c,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x68, 0x61,
-  0x6c, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20,
-  0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x66, 0x20, 0x59,
-  0x6f, 0x75, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x69, 0x6e, 0x64, 0x65, 0x6d, 0x6e, 0x69, 0x66, 0x79, 0x2c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x65, 0x6e, 0x64, 0x2c,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x20, 0x65, 0x61,
-  0x63, 0x68, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x6f, 0x72, 0x20, 0x68, 0x61, 0x72, 0x6d, 0x6c, 0x65, 0x73, 0x73, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x69, 0x61, 0x62,
-  0x69, 0x6c, 0x69, 0x74, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x6e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x61,
-  0x73, 0x73, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69,
-  0x6e, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6f, 0x72, 0x20, 0x62, 0x79,
-  0x20, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x61, 0x63,
-  0x63, 0x65, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x74,
-  0x79, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
-  0x79, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x45, 0x4e, 0x44, 0x20, 0x4f,
-  0x46, 0x20, 0x54, 0x45, 0x52, 0x4d, 0x53, 0x20, 0x41, 0x4e, 0x44, 0x20,
-  0x43, 0x4f, 0x4e, 0x44, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x0a
+// NOTE compressed copy of txt/openssl.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char openssl_txt[] = {
+  0x00, 0x00, 0x27, 0xbf, 0x78, 0xda, 0xdd, 0x5a, 0x5b, 0x93, 0xdb, 0xb6,
+  0x15, 0x7e, 0xf7, 0xaf, 0xc0, 0x68, 0xa6, 0x33, 0xbb, 0x33, 0xb4, 0xec,
+  0xa4, 0x49, 0xdb, 0x24, 0x4f, 0x8a, 0x77, 0x9d, 0x28, 0x75, 0xb4, 0x1e,
+  0x69, 0xb7, 0x9e, 0x3c, 0x42, 0x24, 0x28, 0xa1, 0x26, 0x09, 0x06, 0x20,
+  0x57, 0xab, 0xfe, 0xfa, 0x9e, 0x0b, 0x6e, 0x94, 0xb4, 0x6b, 0xf7, 0xb5,
+  0x1e, 0x4f, 0x62, 0x51, 0xc4, 0xc1, 0xc1, 0xb9, 0x7c, 0xe7, 0x3b, 0x07,
+  0x7a, 0x25, 0xbe, 0xf4, 0x67, 0xd1, 0xcb, 0x72, 0xaf, 0xc4, 0x07, 0x5d,
+  0xaa, 0xce, 0xa9, 0x57, 0x2f, 0xbc, 0xf9, 0x2f, 0x65, 0x9d, 0x36, 0x9d,
+  0xf8, 0x76, 0xfe, 0xb6, 0x10, 0xbf, 0xc9, 0x6e, 0x94, 0xf6, 0x28, 0xbe,
+  0x7d, 0xfb, 0xf6, 0xbb, 0x67, 0x17, 0xed, 0x87, 0xa1, 0x77, 0x3f, 0xbe,
+  0x79, 0x73, 0x38, 0x1c, 0xe6, 0x92, 0xf6, 0x99, 0x1b, 0xbb, 0x7b, 0xd3,
+  0xf0, 0x5e, 0xee, 0xcd, 0x2b, 0x5c, 0x79, 0x7f, 0xbb, 0xfe, 0x7d, 0x23,
+  0x16, 0xab, 0x1b, 0xf1, 0xee, 0x6e, 0x75, 0xb3, 0xbc, 0x5f, 0xde, 0xad,
+  0x36, 0xe2, 0xfd, 0xdd, 0x5a, 0x3c, 0x6c, 0x6e, 0x0b, 0xb1, 0xbe, 0xfd,
+  0xb8, 0xbe, 0xbb, 0x79, 0x78, 0x87, 0x8f, 0x0b, 0x7a, 0xeb, 0x66, 0xb9,
+  0xb9, 0x5f, 0x2f, 0x7f, 0x7e, 0xc0, 0x27, 0x24, 0xe0, 0x9b, 0xb9, 0xb8,
+  0x51, 0xb5, 0xee, 0xf4, 0x00, 0xda, 0xb9, 0xf9, 0x2b, 0xaf, 0xce, 0xcc,
+  0x1f, 0x69, 0x26, 0xdc, 0x5e, 0x36, 0x8d, 0x68, 0x95, 0xec, 0xc4, 0x00,
+  0x47, 0x1d, 0x94, 0x6d, 0x9d, 0x90, 0x5d, 0x25, 0x4a, 0xd3, 0x55, 0xbc,
+  0x4a, 0xd4, 0xc6, 0x8a, 0xd1, 0xa9, 0x42, 0x58, 0xd5, 0x5b, 0x53, 0x8d,
+  0x25, 0x3e, 0x2e, 0xbc, 0x28, 0x7c, 0xb7, 0xd2, 0x6e, 0xb0, 0x7a, 0x3b,
+  0xe2, 0x73, 0x21, 0x9d, 0xa8, 0x70, 0x4b, 0x55, 0x89, 0xed, 0x51, 0x6c,
+  0x54, 0xc9, 0x42, 0xbe, 0x01, 0xf9, 0xd6, 0x8c, 0xbb, 0xbd, 0xf8, 0x41,
+  0x98, 0x1a, 0x3e, 0x68, 0x78, 0xcf, 0x94, 0x63, 0xab, 0xba, 0xe1, 0x54,
+  0x2f, 0x63, 0xcf, 0x14, 0x2b, 0x4d, 0x7f, 0xb4, 0x7a, 0xb7, 0x1f, 0x84,
+  0x39, 0x74, 0xca, 0x0a, 0x50, 0x09, 0x16, 0xea, 0xe1, 0x28, 0xe4, 0x38,
+  0xec, 0x8d, 0xd5, 0xff, 0xa1, 0xfd, 0xbc, 0x9c, 0x4b, 0x2b, 0x86, 0xbd,
+  0x1c, 0x04, 0x6c, 0xba, 0xb3, 0x12, 0x16, 0x76, 0x3b, 0x7a, 0xc9, 0xdb,
+  0x21, 0x53, 0x40, 0xed, 0x64, 0x23, 0x6e, 0x49, 0xf4, 0x99, 0x12, 0x63,
+  0x87, 0x07, 0x24, 0xed, 0x95, 0x90, 0x25, 0x49, 0x09, 0x5a, 0x80, 0x19,
+  0xe0, 0x5d, 0x2f, 0xc6, 0xc0, 0x0b, 0x5e, 0x41, 0xad, 0x1c, 0x6f, 0x0d,
+  0x06, 0x1d, 0xac, 0x69, 0x0a, 0x21, 0xad, 0x0a, 0x1f, 0x1a, 0x52, 0xba,
+  0xc0, 0xd3, 0xe0, 0xd3, 0xb1, 0xab, 0x60, 0x59, 0x69, 0xda, 0xd6, 0x74,
+  0x5e, 0x92, 0x7f, 0x51, 0x1c, 0xf4, 0xb0, 0x67, 0x39, 0xbc, 0xe1, 0x5c,
+  0xbc, 0x37, 0x96, 0xf4, 0xe8, 0x47, 0xdb, 0x1b, 0x88, 0x98, 0x64, 0xd5,
+  0xe8, 0xf0, 0xe0, 0xa3, 0x99, 0x97, 0x32, 0xa3, 0xa3, 0x38, 0x71, 0xa5,
+  0xaf, 0x79, 0xa9, 0x39, 0x28, 0x5b, 0x80, 0xfb, 0x2c, 0x78, 0x09, 0x95,
+  0xd0, 0x1d, 0xff, 0xbb, 0x10, 0x83, 0x11, 0xa5, 0x04, 0xa7, 0xe3, 0x7b,
+  0x5e, 0x0a, 0x7f, 0x45, 0x16, 0xb0, 0xa2, 0x95, 0x9d, 0xdc, 0x29, 0x74,
+  0x1e, 0xee, 0xeb, 0xc6, 0x72, 0xef, 0x15, 0x2b, 0xc4, 0x61, 0xaf, 0xe8,
+  0xf8, 0xe0, 0x7d, 0xda, 0x57, 0x92, 0xec, 0xdc, 0x32, 0x07, 0x8d, 0xd1,
+  0x04, 0x52, 0xae, 0x34, 0x68, 0x42, 0xee, 0x71, 0x7b, 0xdd, 0xa3, 0xa4,
+  0x5a, 0xd7, 0x60, 0xcd, 0x5e, 0xd9, 0x12, 0x45, 0x5f, 0x7d, 0xff, 0xf6,
+  0x2f, 0xd7, 0xb4, 0x9d, 0x01, 0xf3, 0xb0, 0xe1, 0x83, 0xa0, 0x71, 0x70,
+  0x03, 0x58, 0x1d, 0x7d, 0x00, 0x6e, 0xb2, 0xca, 0x05, 0x89, 0x20, 0x72,
+  0xab, 0x3a, 0x30, 0x42, 0xa9, 0xc1, 0x95, 0x13, 0xe9, 0x99, 0x9e, 0xc9,
+  0xe5, 0x7f, 0x98, 0x71, 0x26, 0xae, 0x60, 0x2d, 0xfe, 0xcb, 0xce, 0xae,
+  0x73, 0xaf, 0xc3, 0x5f, 0xb4, 0xc9, 0xa3, 0xae, 0x46, 0x94, 0x65, 0x45,
+  0x1e, 0x1f, 0x5e, 0x80, 0x7a, 0x02, 0x6d, 0xb5, 0x43, 0x45, 0x40, 0xef,
+  0x56, 0x3b, 0x47, 0x01, 0x4f, 0x71, 0xc6, 0x49, 0x40, 0x6e, 0x39, 0x0b,
+  0xb5, 0x0d, 0xec, 0x56, 0x42, 0x0a, 0x42, 0x7a, 0xb5, 0xa7, 0x91, 0xd6,
+  0x5b, 0x55, 0x2b, 0x6b, 0x61, 0x39, 0x7d, 0x5b, 0x93, 0xc5, 0x3f, 0xe3,
+  0x16, 0xad, 0xa9, 0x34, 0x1c, 0x4d, 0x52, 0x56, 0x05, 0x07, 0xeb, 0xae,
+  0x6c, 0x46, 0x32, 0x05, 0x24, 0xa1, 0xe8, 0xcc, 0x20, 0x1a, 0xdd, 0x6a,
+  0xdc, 0x1d, 0xfc, 0xe8, 0x4c, 0x3d, 0x1c, 0x30, 0xbc, 0x1c, 0x6d, 0x08,
+  0x4e, 0xa9, 0xc0, 0xfa, 0x21, 0xf7, 0x48, 0x90, 0x17, 0xc3, 0x2f, 0x14,
+  0x21, 0xff, 0x6b, 0xbd, 0x1b, 0x2d, 0x7d, 0x0f, 0x6e, 0x69, 0x54, 0x06,
+  0x1f, 0x77, 0xdb, 0x7f, 0x43, 0x28, 0x9c, 0xab, 0x2e, 0xbb, 0x23, 0x3f,
+  0x03, 0x77, 0x8c, 0x0d, 0xe5, 0x47, 0x6d, 0x4d, 0x0b, 0x5f, 0x96, 0x7b,
+  0xd9, 0x81, 0xd6, 0x21, 0x41, 0x20, 0x2a, 0x3a, 0x87, 0x6f, 0xca, 0x10,
+  0x50, 0xf4, 0xa4, 0xf1, 0x1f, 0x6b, 0x21, 0x05, 0x9b, 0x87, 0xc4, 0x15,
+  0xd3, 0x03, 0x7a, 0x19, 0x27, 0xc7, 0x84, 0xb4, 0xe9, 0x35, 0x26, 0x94,
+  0x21, 0xe5, 0xfc, 0x31, 0x77, 0x10, 0x09, 0x70, 0x06, 0x78, 0x3c, 0x39,
+  0x70, 0x8e, 0x5e, 0x70, 0xd2, 0x47, 0x86, 0x6f, 0x87, 0x72, 0x38, 0x77,
+  0x5b, 0x55, 0x69, 0x29, 0x86, 0x63, 0x9f, 0x1f, 0xfb, 0x93, 0xb1, 0x9f,
+  0xcf, 0x40, 0xe1, 0x00, 0x0f, 0x49, 0x63, 0xc2, 0x21, 0x8c, 0xb4, 0x94,
+  0x02, 0xba, 0x0b, 0xc7, 0x88, 0x09, 0xc0, 0xa6, 0xf3, 0xc7, 0x6a, 0x65,
+  0x05, 0x40, 0xf2, 0x28, 0x75, 0x23, 0xb7, 0x4d, 0xc8, 0xff, 0x0c, 0x97,
+  0x0a, 0x44, 0x53, 0x0c, 0xc0, 0x52, 0xfa, 0x50, 0x92, 0x11, 0x17, 0x02,
+  0xba, 0x81, 0x19, 0xe0, 0xe5, 0x08, 0x6f, 0x6c, 0x29, 0x78, 0x59, 0x93,
+  0x59, 0xe5, 0x30, 0x60, 0x6d, 0x21, 0x0b, 0x05, 0x6d, 0xbd, 0x88, 0x2b,
+  0x38, 0x80, 0x7a, 0x92, 0x6d, 0x0f, 0x3b, 0xc3, 0x42, 0x80, 0x76, 0x08,
+  0x73, 0x5e, 0x88, 0x6f, 0x2e, 0xfa, 0x5e, 0xc1, 0xce, 0x4f, 0x90, 0x4c,
+  0x8d, 0x39, 0x5c, 0x27, 0x2b, 0xdc, 0x28, 0xab, 0x1f, 0xc1, 0x8a, 0x8f,
+  0x4a, 0xa0, 0x41, 0xdc, 0xec, 0x34, 0x02, 0x70, 0x8f, 0xcb, 0x36, 0xf0,
+  0xa7, 0xf7, 0x92, 0xd8, 0x06, 0x41, 0xf1, 0xad, 0x74, 0xe8, 0xbc, 0x8e,
+  0x52, 0xb1, 0xc2, 0x3d, 0x30, 0xfa, 0x21, 0x7a, 0x18, 0xab, 0x70, 0x2b,
+  0x72, 0x17, 0xe6, 0xc2, 0x61, 0xaf, 0xcb, 0x7d, 0x06, 0x06, 0xe0, 0xac,
+  0x01, 0x6a, 0x00, 0x64, 0xa6, 0x55, 0x8f, 0x9a, 0x5c, 0x89, 0x51, 0x0c,
+  0xa6, 0xf1, 0x79, 0x22, 0x14, 0x58, 0xd8, 0xd8, 0xf0, 0x09, 0x44, 0x78,
+  0x37, 0xe7, 0xd9, 0xe4, 0x85, 0x61, 0x95, 0x53, 0x0e, 0x22, 0x85, 0xac,
+  0x2f, 0x61, 0x33, 0xd3, 0x50, 0x52, 0xc0, 0x32, 0xbd, 0xd3, 0x1d, 0xec,
+  0x72, 0xee, 0xf3, 0x73, 0x3c, 0x0e, 0x38, 0x55, 0x4f, 0xd2, 0xbf, 0x10,
+  0xa7, 0xe6, 0xf3, 0xd6, 0xc3, 0x68, 0xf6, 0xbe, 0x23, 0xf1, 0xbe, 0x6a,
+  0x58, 0xd5, 0x4a, 0x1d, 0xf3, 0x53, 0xf5, 0xd2, 0x52, 0xa4, 0xa0, 0x5d,
+  0xe8, 0x18, 0xad, 0xb2, 0xaa, 0x39, 0x42, 0x1e, 0x74, 0x9f, 0xc9, 0x70,
+  0x5b, 0x88, 0x16, 0x8c, 0x93, 0x4e, 0xb6, 0xea, 0x3a, 0x38, 0x5d, 0x03,
+  0x10, 0xd9, 0x5a, 0x96, 0x54, 0x24, 0x8a, 0xac, 0x46, 0x46, 0xa3, 0x9e,
+  0x29, 0x85, 0xd6, 0x51, 0xa6, 0x4e, 0x5e, 0x7f, 0x87, 0x50, 0xee, 0x6b,
+  0xfc, 0x45, 0x8f, 0x9f, 0xe6, 0x40, 0x4c, 0xd9, 0x6c, 0xbf, 0x68, 0x40,
+  0x9f, 0x70, 0xa1, 0x96, 0x46, 0x3d, 0x50, 0xd8, 0xc4, 0x27, 0x14, 0xc3,
+  0x95, 0x67, 0x22, 0x41, 0x92, 0x61, 0xdb, 0xd0, 0x2a, 0xf8, 0xfe, 0x39,
+  0xe5, 0x8b, 0x2c, 0x29, 0x06, 0x44, 0x7d, 0x03, 0x5b, 0x37, 0x01, 0xb6,
+  0xdd, 0xb8, 0x05, 0xec, 0xf0, 0xe0, 0x11, 0x78, 0x07, 0x45, 0x17, 0x69,
+  0x4e, 0xea, 0xf9, 0x54, 0xa0, 0x8d, 0x08, 0xc7, 0xcf, 0x68, 0x45, 0xf0,
+  0x32, 0x95, 0xbb, 0x17, 0xab, 0x45, 0x4e, 0x54, 0x10, 0x95, 0x69, 0x7b,
+  0x8c, 0xf7, 0xad, 0x02, 0x63, 0xd6, 0x60, 0x8a, 0xe7, 0xc9, 0xcb, 0xd7,
+  0x55, 0x7b, 0x31, 0x8b, 0x67, 0x9a, 0x79, 0x59, 0x5c, 0xef, 0x23, 0x2c,
+  0xc3, 0x22, 0xd5, 0x40, 0x02, 0x5a, 0x03, 0x60, 0x5c, 0xa0, 0x17, 0xb6,
+  0xb2, 0xa1, 0x38, 0x3a, 0x58, 0x5c, 0xd7, 0x11, 0xf9, 0x18, 0x3b, 0x6f,
+  0x7d, 0x81, 0x59, 0x90, 0x1b, 0x5d, 0x25, 0x43, 0xa1, 0x9d, 0x06, 0x97,
+  0x92, 0x85, 0xec, 0xef, 0x8a, 0x17, 0x4b, 0x51, 0xc4, 0xae, 0x7c, 0x0f,
+  0xf8, 0x9b, 0x74, 0x02, 0x44, 0xd4, 0x0d, 0x2e, 0x6e, 0x80, 0x52, 0x82,
+  0xb4, 0xac, 0x64, 0x45, 0x2a, 0xe4, 0x8e, 0x6e, 0x50, 0xad, 0xcb, 0x21,
+  0x1c, 0x6a, 0xee, 0xa8, 0xb0, 0x84, 0x94, 0x54, 0x23, 0xfd, 0x1b, 0xec,
+  0x7e, 0xac, 0x7c, 0xcc, 0x56, 0x22, 0xd7, 0xca, 0x8d, 0x5e, 0x64, 0x30,
+  0x32, 0x89, 0x82, 0xcc, 0xda, 0x68, 0x37, 0xe0, 0xb8, 0xe5, 0xe8, 0xa8,
+  0xca, 0xd3, 0x8e, 0x2d, 0xe1, 0xa5, 0xa7, 0x91, 0x9f, 0x08, 0xf1, 0x52,
+  0x69, 0x52, 0x4f, 0xc1, 0x08, 0xd3, 0xb3, 0x86, 0x78, 0x84, 0xa3, 0xb8,
+  0x5e, 0x97, 0xa3, 0x19, 0x1d, 0x24, 0x6f, 0x2b, 0xed, 0x67, 0x84, 0x3e,
+  0x9b, 0xd8, 0x51, 0xa0, 0x5c, 0xca, 0xe9, 0x5d, 0x47, 0xd8, 0x0f, 0xa1,
+  0x88, 0x3e, 0x22, 0xc3, 0x5e, 0x8c, 0x44, 0x04, 0xab, 0xd9, 0x0a, 0xec,
+  0x2d, 0x45, 0x9e, 0xab, 0xf3, 0xd9, 0x79, 0x0a, 0x9f, 0xf0, 0xeb, 0x78,
+  0xec, 0x90, 0x81, 0x5f, 0xa4, 0x3c, 0xb9, 0x01, 0x11, 0x1f, 0xdb, 0x93,
+  0x4d, 0xc5, 0x1e, 0x94, 0xd9, 0x2a, 0x88, 0x27, 0xa0, 0x8c, 0x8a, 0x90,
+  0x1c, 0x94, 0xce, 0xf7, 0x49, 0x49, 0xe8, 0xd4, 0x9f, 0x23, 0xc4, 0x4f,
+  0x83, 0xdb, 0x96, 0x06, 0xec, 0xcd, 0xe5, 0x1a, 0x09, 0x6f, 0x96, 0x7e,
+  0x0c, 0x44, 0xdf, 0xce, 0xc5, 0x2f, 0x48, 0xab, 0x70, 0xdb, 0x77, 0xf1,
+  0xf8, 0x81, 0x59, 0x89, 0xcd, 0xc8, 0xc5, 0xd5, 0xc7, 0xea, 0xc5, 0x66,
+  0x26, 0x4b, 0xb3, 0x1c, 0x95, 0x15, 0x54, 0x49, 0x91, 0x19, 0x48, 0x20,
+  0x84, 0x80, 0xce, 0xc4, 0xe2, 0x88, 0x17, 0x00, 0x39, 0x84, 0x53, 0x02,
+  0xc3, 0xeb, 0xd5, 0x00, 0x96, 0x09, 0xe1, 0x07, 0xd0, 0xd7, 0x54, 0x07,
+  0x8d, 0x5c, 0xa3, 0x33, 0xdd, 0x6b, 0xf2, 0xbc, 0x83, 0x13, 0xe3, 0xc7,
+  0xd7, 0xc0, 0x7a, 0xec, 0x0e, 0x1b, 0x27, 0x73, 0x94, 0xcd, 0x70, 0x7c,
+  0x5d, 0x5b, 0x05, 0x9f, 0x34, 0x10, 0xbb, 0x47, 0x53, 0x22, 0x90, 0x9f,
+  0x55, 0x73, 0xdf, 0xff, 0xe1, 0x86, 0xa1, 0xdb, 0x82, 0x15, 0x90, 0x63,
+  0x3d, 0xc6, 0xf1, 0x19, 0xd2, 0x25, 0x38, 0xef, 0xc7, 0x2d, 0xac, 0x05,
+  0x2b, 0x42, 0xa0, 0xf6, 0x8d, 0x84, 0x40, 0x8f, 0x4f, 0x40, 0x67, 0x2e,
+  0xb5, 0x8e, 0x9e, 0x78, 0x62, 0x91, 0xf7, 0x6d, 0x39, 0xcd, 0x8f, 0x58,
+  0x4c, 0x64, 0xf9, 0x6c, 0xc7, 0x0b, 0xe5, 0x9c, 0xb0, 0x85, 0x1d, 0xf4,
+  0xd7, 0xcc, 0x41, 0x1f, 0x25, 0x82, 0xee, 0xff, 0x81, 0x77, 0xae, 0x60,
+  0x99, 0xea, 0x07, 0x4c, 0x30, 0x68, 0x39, 0x86, 0x40, 0x91, 0x40, 0x41,
+  0xc7, 0x0d, 0xd1, 0xb5, 0xe8, 0xf9, 0xac, 0x99, 0xf7, 0x80, 0xae, 0x83,
+  0xb0, 0xbd, 0x7c, 0x54, 0xc4, 0xf2, 0x82, 0x42, 0xd4, 0x47, 0x9b, 0xba,
+  0x46, 0x9e, 0x07, 0x45, 0x40, 0x35, 0x00, 0xbf, 0xfc, 0x5f, 0x40, 0x14,
+  0x63, 0x07, 0x76, 0x4c, 0xc4, 0x01, 0x4f, 0x94, 0x3d, 0x2b, 0x24, 0x98,
+  0x09, 0x27, 0x43, 0x13, 0xb0, 0x8f, 0xc2, 0xae, 0xb2, 0xef, 0x1b, 0x6c,
+  0x37, 0x4d, 0x07, 0x4e, 0x27, 0x2b, 0x23, 0x76, 0x79, 0xd5, 0xca, 0x46,
+  0x6a, 0xb0, 0x37, 0xbf, 0x9b, 0x1d, 0x0e, 0xac, 0x48, 0x42, 0x72, 0xeb,
+  0x46, 0xdc, 0xec, 0x20, 0x7b, 0x9d, 0x93, 0x56, 0x53, 0x76, 0xd6, 0x16,
+  0xd0, 0x27, 0x74, 0x34, 0x4a, 0x87, 0xda, 0x97, 0x27, 0xfe, 0x95, 0xbb,
+  0x86, 0x36, 0xd8, 0x74, 0xca, 0x57, 0x44, 0x80, 0x3f, 0x60, 0x24, 0x91,
+  0xd5, 0xd3, 0xb2, 0xd3, 0x05, 0xe1, 0x40, 0xdc, 0xe1, 0xfa, 0x6a, 0x0b,
+  0xea, 0x33, 0xc9, 0x9b, 0x2a, 0xe7, 0xb7, 0x38, 0xa0, 0x2b, 0x42, 0xad,
+  0x9b, 0x8b, 0x65, 0x8d, 0xfe, 0x8f, 0xbd, 0x90, 0x03, 0xa4, 0xc2, 0x98,
+  0x8e, 0x4e, 0x19, 0xf4, 0x8e, 0x55, 0x90, 0x3b, 0x89, 0x5f, 0x13, 0xc8,
+  0xf9, 0xc6, 0xfd, 0x2a, 0x15, 0xac, 0xc8, 0xad, 0xad, 0x71, 0xee, 0x35,
+  0x19, 0x0c, 0x8f, 0x51, 0x9a, 0x11, 0xf9, 0x13, 0x7f, 0x06, 0xcf, 0x4b,
+  0xd1, 0xc8, 0x83, 0x1b, 0xf5, 0x80, 0x47, 0x6d, 0xd4, 0x8e, 0x8b, 0x00,
+  0x58, 0x2c, 0x28, 0x9f, 0x38, 0xc1, 0x09, 0x2a, 0xbe, 0x04, 0x70, 0x54,
+  0x13, 0x58, 0x71, 0xe7, 0x5b, 0xed, 0x24, 0xa7, 0x4c, 0xce, 0x39, 0x86,
+  0x63, 0x05, 0x7f, 0xb4, 0xc4, 0x54, 0x41, 0x0c, 0x53, 0xb1, 0x69, 0x24,
+  0x06, 0xca, 0x14, 0x9a, 0x51, 0x9f, 0x29, 0xa1, 0xd1, 0x48, 0x39, 0xe6,
+  0x4b, 0x5e, 0x60, 0x55, 0x5c, 0x1d, 0x30, 0x45, 0xd1, 0x7b, 0x21, 0x56,
+  0xa4, 0x0b, 0x84, 0xad, 0x82, 0x87, 0x21, 0xf8, 0xa2, 0x75, 0x41, 0x1a,
+  0xf6, 0x89, 0x15, 0x43, 0xc1, 0x77, 0x73, 0xb1, 0x56, 0xf9, 0x64, 0x68,
+  0x4e, 0x5b, 0xb7, 0xf2, 0x98, 0x90, 0xed, 0x14, 0x85, 0x00, 0x07, 0x75,
+  0xe0, 0x36, 0x13, 0x3c, 0x7a, 0x81, 0xe5, 0x91, 0x4b, 0x90, 0x36, 0xc2,
+  0x66, 0x23, 0x80, 0x1c, 0xc5, 0x11, 0x32, 0x1a, 0xf8, 0xbf, 0x89, 0x15,
+  0x79, 0xda, 0x36, 0x73, 0x09, 0x7f, 0x06, 0xc9, 0x8a, 0xd4, 0x0a, 0x91,
+  0x41, 0x52, 0x68, 0xb5, 0x4a, 0xb1, 0x97, 0x6b, 0xd3, 0x40, 0x4f, 0xc4,
+  0xf5, 0x3d, 0x60, 0xd7, 0x8f, 0xaf, 0x62, 0x5f, 0x75, 0xcd, 0x27, 0x1d,
+  0x21, 0xd2, 0x76, 0xa8, 0x2f, 0xaa, 0xc7, 0xfd, 0x06, 0xb8, 0x55, 0xc3,
+  0x11, 0x11, 0xb4, 0x72, 0xea, 0x1b, 0xbb, 0x43, 0xfc, 0x73, 0x76, 0x50,
+  0x49, 0xf5, 0xe1, 0xb4, 0x93, 0xf8, 0x89, 0xca, 0x68, 0xd8, 0x73, 0x9b,
+  0xed, 0xc9, 0x83, 0x9b, 0x44, 0xa5, 0xb1, 0x8f, 0xc2, 0xfe, 0x9d, 0x87,
+  0x3a, 0x16, 0x43, 0x08, 0xda, 0x07, 0xdd, 0x61, 0x9c, 0x70, 0xf7, 0xe8,
+  0xb2, 0xed, 0x11, 0xe2, 0x62, 0x48, 0xa3, 0x4c, 0x6c, 0xdd, 0x77, 0x64,
+  0x0c, 0xc5, 0x72, 0xa6, 0x3b, 0x97, 0xd9, 0xce, 0x56, 0x0d, 0x90, 0x60,
+  0x45, 0xe0, 0xcd, 0x59, 0x0b, 0x4f, 0xdd, 0x01, 0x68, 0x74, 0x7a, 0xb8,
+  0x6c, 0xe3, 0xb8, 0x61, 0x0a, 0x88, 0x02, 0x33, 0x2c, 0x55, 0xc7, 0xc2,
+  0x47, 0x77, 0x81, 0xb0, 0x58, 0x29, 0xe4, 0x4d, 0x45, 0x46, 0x26, 0x28,
+  0x44, 0x87, 0x94, 0x6e, 0xfe, 0x6c, 0x3c, 0x82, 0xb8, 0xa0, 0xcf, 0x29,
+  0xa4, 0x4e, 0x99, 0x1b, 0xa3, 0x67, 0x90, 0x41, 0xca, 0x55, 0x86, 0x08,
+  0x2d, 0x54, 0x19, 0x3c, 0x26, 0x9a, 0x93, 0x33, 0xce, 0x0e, 0xa9, 0x70,
+  0x05, 0x06, 0x7f, 0x7a, 0xd0, 0xa9, 0xd1, 0xaa, 0x6b, 0x04, 0xad, 0xe8,
+  0x7f, 0xdf, 0xf8, 0xa1, 0xab, 0x67, 0xab, 0xbb, 0xfb, 0xe5, 0xbb, 0xdb,
+  0x19, 0x24, 0xdf, 0xd3, 0x40, 0xf6, 0xc6, 0xb4, 0xf3, 0x7b, 0x20, 0xe5,
+  0xce, 0xf6, 0xc9, 0xb3, 0x2b, 0x83, 0x80, 0x0b, 0x99, 0x72, 0x66, 0x59,
+  0xf2, 0x57, 0x26, 0x2a, 0xb4, 0x9e, 0x12, 0x7c, 0x28, 0x2b, 0xea, 0x31,
+  0x53, 0xd0, 0xa9, 0x8b, 0x66, 0x45, 0x50, 0x92, 0x38, 0xe7, 0xcd, 0xc4,
+  0x78, 0x50, 0x23, 0x64, 0xe0, 0x83, 0xd0, 0x11, 0x8a, 0xaf, 0xb1, 0x6b,
+  0x26, 0xe6, 0xb2, 0x85, 0x2f, 0xda, 0x95, 0x82, 0x0d, 0x64, 0x34, 0x4a,
+  0x3a, 0x6c, 0xa7, 0xf2, 0x31, 0xbd, 0x5f, 0x92, 0xb2, 0x15, 0x88, 0x11,
+  0x6c, 0xfa, 0x63, 0x50, 0x53, 0x06, 0x1d, 0x93, 0xad, 0x93, 0x85, 0x26,
+  0x51, 0xe5, 0x5e, 0xd4, 0xe1, 0xa7, 0x1c, 0xcc, 0x27, 0x41, 0x96, 0xe7,
+  0xf5, 0x74, 0x00, 0x25, 0x74, 0x9d, 0x70, 0x06, 0x4b, 0xe6, 0x2e, 0x55,
+  0xc0, 0x73, 0xf9, 0xc6, 0x16, 0xe7, 0x56, 0x96, 0x81, 0xeb, 0x65, 0x53,
+  0x2e, 0xdf, 0x1b, 0x5c, 0xb0, 0x52, 0x7d, 0x92, 0x29, 0x44, 0x20, 0xa0,
+  0x03, 0x64, 0x67, 0x81, 0x40, 0x5b, 0xbd, 0xc6, 0x43, 0x1e, 0xa3, 0x6f,
+  0x3a, 0x9c, 0xcf, 0x41, 0xc3, 0x8c, 0xc4, 0x42, 0x49, 0x68, 0x42, 0xef,
+  0xf7, 0xdc, 0x85, 0x21, 0x7e, 0x9d, 0x9b, 0x39, 0xf3, 0x37, 0x91, 0x07,
+  0x6e, 0xa5, 0xe3, 0x90, 0x0f, 0x7a, 0x88, 0xd4, 0xbc, 0x22, 0x43, 0x99,
+  0xaa, 0xe3, 0x73, 0x8b, 0x10, 0xeb, 0x38, 0x99, 0xcd, 0xc7, 0xb2, 0x21,
+  0xab, 0x0a, 0xff, 0x6d, 0xb1, 0xdf, 0xc9, 0x23, 0x32, 0x93, 0x12, 0x54,
+  0xf7, 0x16, 0xfa, 0x9a, 0x4c, 0x28, 0xd8, 0xfa, 0x0e, 0x1c, 0x91, 0x9f,
+  0x89, 0xfa, 0x29, 0x1c, 0x6f, 0x54, 0x95, 0xea, 0xaa, 0xb1, 0x0d, 0xb4,
+  0x75, 0x12, 0x31, 0x01, 0x58, 0xb8, 0xff, 0x0b, 0xee, 0x3c, 0xc5, 0x34,
+  0x32, 0x70, 0x18, 0x62, 0x80, 0x19, 0x2e, 0x26, 0x13, 0x4d, 0xab, 0xa0,
+  0x67, 0x62, 0x1e, 0x60, 0xc7, 0xd3, 0xf8, 0x63, 0xc3, 0x3c, 0x77, 0x6f,
+  0x71, 0xd1, 0x44, 0xa9, 0xab, 0x20, 0xda, 0x4a, 0xc3, 0x7a, 0x26, 0x00,
+  0x27, 0x83, 0xaf, 0xcc, 0x15, 0x28, 0xc4, 0x9f, 0x23, 0x57, 0x19, 0x47,
+  0x72, 0x1a, 0x59, 0xeb, 0x84, 0xe5, 0x5e, 0x60, 0xf0, 0x69, 0xb4, 0x77,
+  0xe1, 0xca, 0x88, 0xc5, 0x64, 0x77, 0x45, 0xa6, 0xbe, 0xa0, 0x4d, 0x91,
+  0xd2, 0xa6, 0xa6, 0x66, 0xf1, 0xf8, 0x4c, 0x2b, 0x92, 0x4f, 0xe7, 0x62,
+  0x2a, 0x91, 0x3c, 0xdc, 0x3a, 0x9b, 0xe6, 0x25, 0x05, 0xce, 0x6e, 0xab,
+  0x26, 0x55, 0x38, 0xb2, 0x6e, 0x9c, 0x25, 0x13, 0x95, 0xc6, 0x38, 0x9a,
+  0x8c, 0x65, 0x62, 0xa7, 0x72, 0xd2, 0x09, 0x4c, 0x1c, 0xf2, 0x3d, 0x35,
+  0x3b, 0xfe, 0x26, 0x80, 0x7b, 0xd5, 0xc4, 0x02, 0xdd, 0x5c, 0x3c, 0x74,
+  0x50, 0x45, 0x1d, 0x39, 0x4d, 0x3d, 0xc1, 0x46, 0xa5, 0xc6, 0xf6, 0x97,
+  0x24, 0x66, 0x17, 0x24, 0x71, 0xbe, 0x71, 0x3c, 0x65, 0x91, 0xd9, 0x30,
+  0x2b, 0x1b, 0x63, 0x3d, 0x3b, 0xba, 0x4a, 0x4c, 0x1f, 0x77, 0x3c, 0x1d,
+  0xe4, 0x30, 0xd5, 0xdb, 0xe6, 0xd3, 0xe7, 0xff, 0xa5, 0x35, 0xf3, 0x34,
+  0x8b, 0xd4, 0xcc, 0x02, 0x86, 0x45, 0x30, 0x75, 0xad, 0xc2, 0xed, 0x23,
+  0xaf, 0x5f, 0x99, 0x01, 0x17, 0xc5, 0xdb, 0x1b, 0xaa, 0x2f, 0x5b, 0xc3,
+  0x4d, 0x19, 0xa6, 0xed, 0x8e, 0xda, 0x3b, 0x2c, 0x23, 0xa4, 0x9a, 0x1b,
+  0xa1, 0x1c, 0x38, 0x55, 0x29, 0xbe, 0x08, 0xc2, 0x34, 0xc8, 0x5c, 0xe2,
+  0x37, 0x62, 0x76, 0xc1, 0x03, 0x52, 0xb0, 0x62, 0x6c, 0x89, 0x76, 0xd0,
+  0xd3, 0x51, 0xe0, 0x1f, 0x7d, 0x86, 0x50, 0x47, 0xa6, 0x9e, 0x54, 0x99,
+  0x41, 0x3c, 0x01, 0x6f, 0x34, 0x88, 0x55, 0x3b, 0x69, 0xf9, 0x5e, 0xe9,
+  0xb4, 0xf7, 0xf0, 0x77, 0x01, 0x7f, 0x03, 0x28, 0x0c, 0x04, 0xc4, 0x21,
+  0x2c, 0x66, 0x3c, 0xba, 0x32, 0x84, 0x9c, 0x03, 0x53, 0xee, 0xec, 0x46,
+  0x08, 0x0d, 0xef, 0x2f, 0xd4, 0x98, 0xbe, 0x84, 0x6b, 0x0c, 0xd9, 0xe2,
+  0xdc, 0x2c, 0x32, 0x1a, 0x9c, 0x7a, 0x29, 0xfb, 0x88, 0x33, 0x7d, 0xff,
+  0x11, 0x74, 0xf2, 0x31, 0xcc, 0x2f, 0x87, 0xa0, 0x0d, 0x1a, 0x17, 0x69,
+  0xea, 0xe4, 0xdb, 0x54, 0xab, 0xfe, 0x1c, 0xb5, 0xbf, 0x3d, 0xc2, 0x82,
+  0xee, 0xc0, 0x27, 0x58, 0xd2, 0xc9, 0xa5, 0x50, 0xf8, 0x4d, 0x8b, 0xf7,
+  0xd3, 0xa8, 0x0d, 0x58, 0x19, 0x78, 0x47, 0x09, 0x07, 0xf4, 0xae, 0x88,
+  0x4d, 0x07, 0x4e, 0x6a, 0xcf, 0xe6, 0xb3, 0x21, 0x9b, 0x82, 0xdf, 0x7c,
+  0x35, 0xb8, 0x50, 0x02, 0xd8, 0x52, 0x7f, 0x9f, 0x8b, 0x1b, 0xed, 0xa8,
+  0x75, 0xc2, 0x4b, 0xdb, 0x5a, 0x7c, 0x02, 0xfe, 0x09, 0x76, 0x39, 0xc6,
+  0x24, 0x88, 0xaa, 0x6e, 0x8f, 0xdc, 0xc0, 0x52, 0xe7, 0x8d, 0x2d, 0x56,
+  0x82, 0x01, 0xf2, 0x22, 0x35, 0x2f, 0x69, 0x0a, 0x56, 0x24, 0x87, 0xf9,
+  0xdc, 0x77, 0x49, 0xd5, 0x2b, 0xd4, 0x15, 0x87, 0x06, 0xa7, 0x2d, 0x6a,
+  0xfe, 0x36, 0x8e, 0x2f, 0x27, 0xce, 0xbd, 0xc6, 0xb9, 0x16, 0x40, 0xfe,
+  0x6c, 0xb1, 0x11, 0xcb, 0xcd, 0x4c, 0xfc, 0xbc, 0xd8, 0x2c, 0x37, 0xc1,
+  0xb8, 0x9f, 0x96, 0xf7, 0xbf, 0xde, 0x3d, 0xdc, 0x8b, 0x4f, 0x8b, 0xf5,
+  0x7a, 0xb1, 0xba, 0x5f, 0xde, 0x6e, 0xc4, 0xdd, 0x3a, 0xbf, 0x96, 0xbf,
+  0x7b, 0x2f, 0x16, 0xab, 0x3f, 0xc4, 0x3f, 0x97, 0xab, 0x1b, 0xa0, 0x3b,
+  0x9a, 0x6f, 0x80, 0x9f, 0x70, 0x3a, 0xea, 0xd2, 0x49, 0x34, 0xe1, 0x4a,
+  0x95, 0x8d, 0x49, 0x53, 0x06, 0xd1, 0x9c, 0x54, 0x06, 0x9c, 0x3a, 0x42,
+  0x93, 0x4b, 0xa6, 0xa2, 0x86, 0xc8, 0x9e, 0x43, 0x2c, 0x18, 0xf3, 0x7e,
+  0x79, 0xff, 0xe1, 0xb6, 0x00, 0xab, 0xaf, 0x5e, 0x2f, 0x57, 0xef, 0xd7,
+  0xcb, 0xd5, 0x2f, 0xb7, 0xbf, 0xdf, 0xae, 0xee, 0x0b, 0xf1, 0xfb, 0xed,
+  0xfa, 0xdd, 0xaf, 0xa0, 0xe5, 0xe2, 0xe7, 0xe5, 0x87, 0xe5, 0xfd, 0x1f,
+  0x14, 0x42, 0xef, 0x97, 0xf7, 0xab, 0xdb, 0x0d, 0xff, 0x7c, 0x60, 0xe1,
+  0x65, 0x7c, 0x5c, 0xac, 0xc1, 0x61, 0x0f, 0x1f, 0x16, 0x6b, 0xf1, 0xf1,
+  0x61, 0xfd, 0xf1, 0x6e, 0x73, 0xcb, 0xd5, 0x96, 0x6f, 0x0b, 0x1b, 0xbc,
+  0x59, 0x00, 0xfd, 0x7b, 0xd8, 0x54, 0xd3, 0xad, 0x03, 0xdd, 0xcc, 0x70,
+  0x57, 0x38, 0x0d, 0x17, 0xf0, 0x9c, 0x35, 0xbd, 0xd5, 0x48, 0xcf, 0xe9,
+  0xc0, 0x35, 0x44, 0x17, 0xbe, 0x42, 0xf1, 0x97, 0x10, 0x37, 0x9b, 0x97,
+  0xf2, 0xb4, 0xd1, 0x39, 0xe0, 0x44, 0x78, 0xdc, 0x00, 0xd7, 0xda, 0x11,
+  0xb2, 0x3b, 0x53, 0xea, 0xd8, 0x26, 0x33, 0xa8, 0xfb, 0x7b, 0x56, 0x9a,
+  0xc6, 0xe6, 0x17, 0xad, 0xe7, 0xcd, 0x2c, 0xc7, 0xde, 0x3f, 0xe6, 0xf0,
+  0x39, 0x98, 0x14, 0x17, 0x7d, 0xd0, 0x72, 0xab, 0x1b, 0xba, 0x3c, 0x5f,
+  0x62, 0xe5, 0x15, 0x40, 0x7f, 0xba, 0x81, 0xf4, 0x60, 0x19, 0xf0, 0xa8,
+  0xa1, 0x61, 0x27, 0xe8, 0x08, 0x9d, 0x76, 0x36, 0x6a, 0x09, 0x37, 0x59,
+  0x10, 0x40, 0x43, 0x3e, 0x32, 0xe8, 0xd4, 0xae, 0xd1, 0xc0, 0xbe, 0x4a,
+  0x75, 0x5d, 0xc4, 0xdb, 0xee, 0x62, 0x32, 0xca, 0x8d, 0x93, 0x9f, 0x2f,
+  0xc6, 0xfb, 0x15, 0x13, 0x05, 0x9c, 0xe9, 0x37, 0x7a, 0x4b, 0x84, 0x8e,
+  0x94, 0xdb, 0xe1, 0x3c, 0x22, 0xde, 0x5b, 0x84, 0x2d, 0x07, 0xfc, 0x05,
+  0x82, 0xa3, 0xdb, 0xf1, 0xcb, 0xf9, 0xc1, 0xe8, 0x39, 0x29, 0x1f, 0x38,
+  0x94, 0x09, 0x2e, 0x6b, 0x34, 0x6d, 0xec, 0x27, 0x02, 0xe4, 0x5a, 0xd9,
+  0xca, 0xdd, 0x74, 0x86, 0x8f, 0xab, 0xc3, 0x4f, 0x02, 0xd2, 0x8f, 0x03,
+  0x5c, 0xaf, 0xf0, 0x6e, 0x3d, 0xbb, 0x7d, 0x86, 0x84, 0x02, 0x62, 0xcb,
+  0x57, 0x09, 0x48, 0x60, 0x78, 0xa6, 0x8b, 0x17, 0x72, 0x5e, 0x68, 0x40,
+  0x68, 0x9c, 0xb9, 0x81, 0xde, 0x38, 0xae, 0xb6, 0x7c, 0x67, 0x8e, 0x55,
+  0x3c, 0xd6, 0x6a, 0xbc, 0x35, 0x3e, 0x6d, 0x74, 0xc9, 0x9a, 0x63, 0xc4,
+  0x98, 0x91, 0x9f, 0xe8, 0xce, 0x3b, 0x33, 0xc3, 0xd5, 0x7c, 0x62, 0x70,
+  0xf5, 0xe2, 0x9d, 0x78, 0xd0, 0x0a, 0x8f, 0xdd, 0x18, 0x0e, 0xd8, 0x9d,
+  0x31, 0xd5, 0x41, 0x37, 0xf9, 0xec, 0xf0, 0x33, 0x14, 0x65, 0xd3, 0xf7,
+  0x12, 0xa7, 0x84, 0xc8, 0x09, 0x46, 0x54, 0xbc, 0x96, 0xba, 0x19, 0x2d,
+  0x57, 0x23, 0xd9, 0xd4, 0x63, 0x97, 0xc8, 0x0d, 0x15, 0xc1, 0x0b, 0xbf,
+  0x04, 0xc1, 0x5b, 0x00, 0x0c, 0xde, 0xdc, 0x1e, 0xbc, 0xb1, 0x72, 0x10,
+  0x38, 0x18, 0x87, 0x48, 0xd0, 0x4f, 0x07, 0x71, 0x5e, 0x46, 0x1c, 0xa6,
+  0xcb, 0xea, 0x51, 0xd3, 0x25, 0x69, 0xed, 0x7f, 0xbe, 0x01, 0x19, 0xe0,
+  0x8d, 0x10, 0x7e, 0xdc, 0xe0, 0xc5, 0x73, 0x06, 0xfc, 0x30, 0x17, 0x8b,
+  0x12, 0x6b, 0x02, 0x5a, 0x21, 0x20, 0x2f, 0xee, 0xbc, 0x48, 0x85, 0x3a,
+  0x4b, 0x8a, 0x4f, 0x7b, 0xa4, 0xee, 0xd3, 0x74, 0x3d, 0xbd, 0x2c, 0x7c,
+  0xf1, 0xba, 0x2d, 0xb0, 0xd0, 0x72, 0x6f, 0x0c, 0x4f, 0x41, 0x69, 0xd2,
+  0x39, 0xb9, 0x6c, 0xa7, 0x99, 0x2b, 0xf0, 0xb6, 0x5a, 0x11, 0x9e, 0x00,
+  0xd4, 0x91, 0x86, 0xb2, 0x2b, 0x15, 0x1f, 0xa2, 0xe7, 0x31, 0xa8, 0x47,
+  0xbf, 0x23, 0xc5, 0x9d, 0x6a, 0x3b, 0xfc, 0x69, 0x49, 0x1a, 0x88, 0xb1,
+  0x59, 0x9b, 0xa0, 0xbb, 0x30, 0xdb, 0xc6, 0x4f, 0xa1, 0x88, 0xb7, 0xbc,
+  0x41, 0xd8, 0x41, 0xe6, 0xcb, 0x57, 0x2d, 0x70, 0x1e, 0xcc, 0x17, 0xdf,
+  0x5f, 0x69, 0x37, 0xb9, 0xee, 0x81, 0x06, 0xe3, 0x57, 0x73, 0xc0, 0x4e,
+  0x88, 0x5b, 0xc9, 0x68, 0x30, 0xb2, 0x67, 0x26, 0x38, 0x9d, 0x8f, 0x7e,
+  0xd1, 0xd2, 0x35, 0xd9, 0x6d, 0x48, 0xe4, 0xdc, 0xfe, 0x5a, 0x84, 0x86,
+  0xb8, 0xfe, 0x31, 0x02, 0x69, 0x82, 0x51, 0xd2, 0x97, 0x98, 0x4e, 0xba,
+  0x45, 0x49, 0x88, 0x9e, 0x26, 0x45, 0x59, 0x18, 0xf8, 0x99, 0x30, 0xf6,
+  0x4c, 0xba, 0x66, 0x7c, 0xc6, 0x84, 0xe7, 0x7c, 0x27, 0xdb, 0xd4, 0xd1,
+  0x36, 0x95, 0xaa, 0xa1, 0x5d, 0xe1, 0x15, 0xc0, 0x8c, 0xab, 0x0b, 0xa3,
+  0x73, 0x69, 0x5b, 0x42, 0xa2, 0x40, 0xae, 0xa3, 0x15, 0x53, 0x3a, 0x8f,
+  0xd6, 0xa6, 0xdb, 0x32, 0x3f, 0x39, 0x06, 0x4c, 0x86, 0xae, 0x1c, 0x9b,
+  0x55, 0x1e, 0xa2, 0x16, 0xe7, 0x73, 0xe3, 0xed, 0xd1, 0x93, 0x8d, 0x74,
+  0xa0, 0x23, 0x5a, 0x20, 0xd9, 0x34, 0x92, 0xf9, 0x43, 0x16, 0x8d, 0x19,
+  0x6d, 0x8c, 0xba, 0x70, 0x00, 0xdf, 0xae, 0x6e, 0xb0, 0xae, 0x5e, 0xfa,
+  0x19, 0xdc, 0xab, 0xff, 0x02, 0xc0, 0x62, 0x5f, 0xbf
 };
-unsigned int openssl_txt_len = 10175;
+static constexpr unsigned int openssl_txt_len = 3573;
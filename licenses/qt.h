@@ -1,641 +1,225 @@
-unsigned char qt_txt[] = {
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c,
-  0x45, 0x53, 0x53, 0x45, 0x52, 0x20, 0x47, 0x45, 0x4e, 0x45, 0x52, 0x41,
-  0x4c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x4c, 0x49, 0x43,
-  0x45, 0x4e, 0x53, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x33, 0x2c, 0x20, 0x32, 0x39, 0x20, 0x4a, 0x75, 0x6e, 0x65, 0x20, 0x32,
-  0x30, 0x30, 0x37, 0x0a, 0x0a, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x30, 0x37,
-  0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x3c, 0x68, 0x74, 0x74,
-  0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x73, 0x66, 0x2e, 0x6f, 0x72, 0x67,
-  0x2f, 0x3e, 0x0a, 0x20, 0x45, 0x76, 0x65, 0x72, 0x79, 0x6f, 0x6e, 0x65,
-  0x20, 0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74, 0x74, 0x65,
-  0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x20, 0x76, 0x65, 0x72, 0x62, 0x61, 0x74, 0x69, 0x6d, 0x20, 0x63, 0x6f,
-  0x70, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f,
-  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20,
-  0x63, 0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x20,
-  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73,
-  0x65, 0x72, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50,
-  0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74,
-  0x65, 0x73, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x47, 0x4e, 0x55, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20,
-  0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70,
-  0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6c,
-  0x69, 0x73, 0x74, 0x65, 0x64, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x20, 0x41, 0x64, 0x64, 0x69, 0x74,
-  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x73,
-  0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x69, 0x6e,
-  0x2c, 0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20,
-  0x74, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20,
-  0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72,
-  0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x22, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x22,
-  0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x0a, 0x47, 0x65, 0x6e, 0x65,
-  0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x22,
-  0x54, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x22,
-  0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61,
-  0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2c, 0x0a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
-  0x61, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x43,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x6e,
-  0x20, 0x22, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x22, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x77, 0x6f,
-  0x72, 0x6b, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6d, 0x61, 0x6b, 0x65,
-  0x73, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20,
-  0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x70, 0x72,
-  0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x0a, 0x62, 0x79, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x62,
-  0x75, 0x74, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
-  0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a,
-  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x73,
-  0x75, 0x62, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61,
-  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x65,
-  0x6d, 0x65, 0x64, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a, 0x6f,
-  0x66, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x20, 0x69,
-  0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6f,
-  0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a, 0x20,
-  0x20, 0x41, 0x20, 0x22, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x22, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
-  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x69,
-  0x6e, 0x67, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e,
-  0x67, 0x20, 0x61, 0x6e, 0x0a, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x20,
-  0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c,
-  0x61, 0x72, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72,
-  0x79, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6d,
-  0x61, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20,
-  0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22,
-  0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x0a, 0x56, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x22, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20,
-  0x22, 0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x72,
-  0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61,
-  0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
-  0x0a, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69,
-  0x6e, 0x67, 0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e,
-  0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x65, 0x78, 0x63,
-  0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x73,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x66,
-  0x6f, 0x72, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69,
-  0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65,
-  0x64, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x62, 0x61, 0x73, 0x65,
-  0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x70,
-  0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20,
-  0x22, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69,
-  0x6e, 0x67, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x61, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74,
-  0x68, 0x65, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f,
-  0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x73, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-  0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x61, 0x74,
-  0x61, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69, 0x74,
-  0x79, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x6e,
-  0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x65,
-  0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65,
-  0x0a, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x79, 0x73, 0x74,
-  0x65, 0x6d, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x31, 0x2e, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47,
-  0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x59,
-  0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65,
-  0x79, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20,
-  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x73,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x33, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x34, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x77, 0x69, 0x74, 0x68,
-  0x6f, 0x75, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x32, 0x2e, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x69, 0x6e, 0x67,
-  0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x49,
-  0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79,
-  0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20,
-  0x61, 0x6e, 0x64, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x79, 0x6f, 0x75, 0x72,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2c, 0x20, 0x61, 0x0a, 0x66, 0x61, 0x63, 0x69, 0x6c, 0x69,
-  0x74, 0x79, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f,
-  0x20, 0x61, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x6f, 0x20, 0x62,
-  0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x74, 0x68, 0x61, 0x74, 0x20, 0x75, 0x73,
-  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c,
-  0x69, 0x74, 0x79, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74,
-  0x68, 0x61, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
-  0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66,
-  0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x69,
-  0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x64, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65,
-  0x6e, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f,
-  0x6e, 0x76, 0x65, 0x79, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66,
-  0x69, 0x65, 0x64, 0x0a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x29, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61,
-  0x6b, 0x65, 0x20, 0x61, 0x20, 0x67, 0x6f, 0x6f, 0x64, 0x20, 0x66, 0x61,
-  0x69, 0x74, 0x68, 0x20, 0x65, 0x66, 0x66, 0x6f, 0x72, 0x74, 0x20, 0x74,
-  0x6f, 0x0a, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70,
-  0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x6f,
-  0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c,
-  0x79, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x61, 0x74,
-  0x61, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c,
-  0x69, 0x74, 0x79, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x6f, 0x70,
-  0x65, 0x72, 0x61, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x0a, 0x20, 0x20, 0x20,
-  0x77, 0x68, 0x61, 0x74, 0x65, 0x76, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x75, 0x72,
-  0x70, 0x6f, 0x73, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73,
-  0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x66, 0x75, 0x6c, 0x2c,
-  0x20, 0x6f, 0x72, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x75,
-  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x50, 0x4c, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6e,
-  0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
-  0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x65,
-  0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66,
-  0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x33, 0x2e, 0x20,
-  0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x20,
-  0x49, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6e,
-  0x67, 0x20, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x66,
-  0x72, 0x6f, 0x6d, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
-  0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a,
-  0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x6d, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x70, 0x70, 0x6c,
-  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x79, 0x20,
-  0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x20,
-  0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x66, 0x72, 0x6f,
-  0x6d, 0x0a, 0x61, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66,
-  0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
-  0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x20, 0x20, 0x59, 0x6f,
-  0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79,
-  0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
-  0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-  0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75,
-  0x72, 0x20, 0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x2c, 0x20, 0x70, 0x72,
-  0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2c,
-  0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x63, 0x6f,
-  0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x6d, 0x61, 0x74,
-  0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74,
-  0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
-  0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x61,
-  0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x64, 0x61,
-  0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
-  0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x73, 0x2c, 0x20,
-  0x6f, 0x72, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6d, 0x61, 0x63,
-  0x72, 0x6f, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x0a,
-  0x28, 0x74, 0x65, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x65, 0x77, 0x65,
-  0x72, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x6c,
-  0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20,
-  0x64, 0x6f, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67,
-  0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x29, 0x20, 0x47, 0x69, 0x76,
-  0x65, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x20,
-  0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-  0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68,
-  0x65, 0x0a, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
-  0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
-  0x69, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20,
-  0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x62, 0x29, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x47, 0x4e, 0x55, 0x20, 0x47, 0x50, 0x4c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x34, 0x2e, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x0a,
-  0x0a, 0x20, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x63,
-  0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x61, 0x20, 0x43, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66,
-  0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x68, 0x6f, 0x69, 0x63, 0x65,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x2c, 0x0a, 0x74, 0x61, 0x6b, 0x65, 0x6e,
-  0x20, 0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2c, 0x20, 0x65,
-  0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x20, 0x64,
-  0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69,
-  0x63, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x70,
-  0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65,
-  0x76, 0x65, 0x72, 0x73, 0x65, 0x0a, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65,
-  0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65,
-  0x62, 0x75, 0x67, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x75, 0x63, 0x68,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x61,
-  0x6c, 0x73, 0x6f, 0x20, 0x64, 0x6f, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
-  0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f,
-  0x77, 0x69, 0x6e, 0x67, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x29,
-  0x20, 0x47, 0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69, 0x6e,
-  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x77,
-  0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70,
-  0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d,
-  0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73,
-  0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74,
-  0x73, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x41, 0x63, 0x63,
-  0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79,
-  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20,
-  0x47, 0x50, 0x4c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x63, 0x29, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x43,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
-  0x79, 0x73, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x73, 0x20, 0x64, 0x75, 0x72,
-  0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75,
-  0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
-  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x79, 0x20, 0x61, 0x6d, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20,
-  0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65,
-  0x73, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x61,
-  0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63,
-  0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20,
-  0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x50, 0x4c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f,
-  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x64, 0x29, 0x20, 0x44, 0x6f, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69,
-  0x6e, 0x67, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x30, 0x29, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43, 0x6f,
-  0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65,
-  0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x41, 0x70, 0x70,
-  0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x64,
-  0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x69, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74,
-  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74,
-  0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65,
-  0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x70,
-  0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
-  0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65,
-  0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
-  0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20,
-  0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79,
-  0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x50,
-  0x4c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79,
-  0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
-  0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x29, 0x20, 0x55, 0x73, 0x65, 0x20,
-  0x61, 0x20, 0x73, 0x75, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73,
-  0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72,
-  0x79, 0x20, 0x6d, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e,
-  0x20, 0x20, 0x41, 0x20, 0x73, 0x75, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x6d, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x20, 0x69,
-  0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x28,
-  0x61, 0x29, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x72,
-  0x75, 0x6e, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
-  0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x70, 0x72, 0x65,
-  0x73, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x75, 0x73, 0x65, 0x72, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75,
-  0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x79, 0x73, 0x74, 0x65, 0x6d, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28,
-  0x62, 0x29, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72,
-  0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x6c, 0x79,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69,
-  0x66, 0x69, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72,
-  0x66, 0x61, 0x63, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69,
-  0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x65, 0x29, 0x20, 0x50, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6f, 0x6e, 0x6c,
-  0x79, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x77, 0x6f, 0x75,
-  0x6c, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
-  0x72, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x66, 0x6f,
-  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x47, 0x4e,
-  0x55, 0x20, 0x47, 0x50, 0x4c, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f,
-  0x6e, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
-  0x78, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73,
-  0x75, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x6e, 0x65,
-  0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x69,
-  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65,
-  0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64,
-  0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x69, 0x6e,
-  0x67, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x6c, 0x69, 0x6e, 0x6b, 0x69,
-  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x41, 0x70,
-  0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69,
-  0x74, 0x68, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65,
-  0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20,
-  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x28, 0x49, 0x66,
-  0x0a, 0x20, 0x20, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 0x20,
-  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x64, 0x30, 0x2c, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x61, 0x63,
-  0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x43,
-  0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e,
-  0x67, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x49,
-  0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x64, 0x31, 0x2c, 0x20, 0x79, 0x6f,
-  0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69,
-  0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x49,
-  0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72,
-  0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x36, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47,
-  0x50, 0x4c, 0x0a, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f,
-  0x6e, 0x76, 0x65, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x6f, 0x72, 0x72,
-  0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x2e, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x35, 0x2e,
-  0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4c, 0x69,
-  0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
-  0x59, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x70, 0x6c, 0x61, 0x63,
-  0x65, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x66, 0x61,
-  0x63, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x6b,
-  0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x0a, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x73, 0x69,
-  0x64, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x69,
-  0x6e, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x6c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x67, 0x65, 0x74,
-  0x68, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0a, 0x66,
-  0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x41,
-  0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-  0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x0a, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x79, 0x20,
-  0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69,
-  0x6e, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
-  0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x0a, 0x63, 0x68, 0x6f, 0x69,
-  0x63, 0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x64,
-  0x6f, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x3a,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x29, 0x20, 0x41, 0x63, 0x63, 0x6f,
-  0x6d, 0x70, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
-  0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61,
-  0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x6f,
-  0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
-  0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x61, 0x73, 0x65,
-  0x64, 0x0a, 0x20, 0x20, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x75, 0x6e, 0x63,
-  0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x66, 0x61, 0x63, 0x69, 0x6c,
-  0x69, 0x74, 0x69, 0x65, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x76, 0x65, 0x79, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-  0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x29, 0x20, 0x47,
-  0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e,
-  0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e,
-  0x65, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20,
-  0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x77,
-  0x6f, 0x72, 0x6b, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
-  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x61, 0x69,
-  0x6e, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74,
-  0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x69,
-  0x6e, 0x67, 0x20, 0x75, 0x6e, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x36, 0x2e, 0x20, 0x52, 0x65, 0x76, 0x69, 0x73,
-  0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c,
-  0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61,
-  0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65,
-  0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73,
-  0x68, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6e,
-  0x64, 0x2f, 0x6f, 0x72, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20,
-  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c,
-  0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x66,
-  0x72, 0x6f, 0x6d, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x74, 0x69, 0x6d, 0x65, 0x2e, 0x20, 0x53, 0x75, 0x63, 0x68, 0x20, 0x6e,
-  0x65, 0x77, 0x0a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x73, 0x69, 0x6d, 0x69,
-  0x6c, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x70, 0x69, 0x72, 0x69,
-  0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65,
-  0x73, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x0a, 0x64, 0x69,
-  0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x65, 0x74, 0x61,
-  0x69, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
-  0x73, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x6c, 0x65,
-  0x6d, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x65, 0x72,
-  0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x67,
-  0x69, 0x76, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x64, 0x69, 0x73, 0x74, 0x69,
-  0x6e, 0x67, 0x75, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-  0x2e, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69, 0x62,
-  0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75, 0x20,
-  0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20,
-  0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68,
-  0x61, 0x74, 0x20, 0x61, 0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e,
-  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x65, 0x64, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20,
-  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c,
-  0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x22,
-  0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x61, 0x70,
-  0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x2c,
-  0x20, 0x79, 0x6f, 0x75, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
-  0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a,
-  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x65,
-  0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x6f,
-  0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x70, 0x75, 0x62, 0x6c,
-  0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
-  0x72, 0x65, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
-  0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75,
-  0x0a, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74,
-  0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x70,
-  0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65,
-  0x73, 0x73, 0x65, 0x72, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
-  0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61, 0x79,
-  0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65,
-  0x72, 0x0a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75,
-  0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-  0x20, 0x65, 0x76, 0x65, 0x72, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73,
-  0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46,
-  0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
-  0x0a, 0x0a, 0x20, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f,
-  0x75, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69,
-  0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x78, 0x79,
-  0x20, 0x63, 0x61, 0x6e, 0x20, 0x64, 0x65, 0x63, 0x69, 0x64, 0x65, 0x0a,
-  0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x75, 0x74, 0x75,
-  0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c,
-  0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61,
-  0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x0a, 0x61,
-  0x70, 0x70, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70,
-  0x72, 0x6f, 0x78, 0x79, 0x27, 0x73, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69,
-  0x63, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x6f, 0x66, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x0a, 0x70, 0x65, 0x72, 0x6d,
-  0x61, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72,
-  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x79, 0x6f, 0x75, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73,
-  0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c,
-  0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a
+// NOTE compressed copy of txt/qt.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char qt_txt[] = {
+  0x00, 0x00, 0x1d, 0xe4, 0x78, 0xda, 0xbd, 0x59, 0x6d, 0x6f, 0xdc, 0xb8,
+  0x11, 0xfe, 0xae, 0x5f, 0x41, 0xf8, 0xcb, 0xd9, 0xc0, 0xde, 0xe6, 0xb5,
+  0x57, 0xf4, 0x50, 0x14, 0x70, 0x7d, 0x4e, 0x9a, 0xc2, 0x97, 0x33, 0xe2,
+  0x4b, 0x8b, 0x7e, 0xe4, 0x4a, 0xdc, 0x5d, 0x36, 0x92, 0xb8, 0x25, 0x25,
+  0x6f, 0xb6, 0xbf, 0xbe, 0xcf, 0xcc, 0x90, 0x12, 0xa5, 0xdd, 0x75, 0x7c,
+  0x38, 0xa0, 0x06, 0x82, 0xd8, 0x12, 0x39, 0x9c, 0xd7, 0x67, 0x9e, 0xa1,
+  0x94, 0x3a, 0xfa, 0x79, 0xff, 0xf1, 0xb3, 0xba, 0xbb, 0x7d, 0x78, 0xb8,
+  0xfd, 0xa4, 0xde, 0xdf, 0x7e, 0xbc, 0xfd, 0x74, 0x7d, 0xa7, 0xee, 0x3f,
+  0xff, 0xf5, 0xee, 0xc3, 0x8d, 0xc2, 0xbf, 0xdb, 0x8f, 0x0f, 0xb7, 0x85,
+  0x3a, 0xfd, 0xf3, 0x0f, 0xe3, 0x83, 0x75, 0xad, 0x7a, 0xb3, 0x50, 0xaf,
+  0xff, 0xa4, 0xfe, 0xde, 0xb7, 0x46, 0xbd, 0x7e, 0xf9, 0xf2, 0x8f, 0x45,
+  0xa1, 0x6e, 0xdc, 0xee, 0xe0, 0xed, 0x66, 0xdb, 0xa9, 0xcb, 0x9b, 0x2b,
+  0x7e, 0xa8, 0xde, 0x79, 0x63, 0xd4, 0x83, 0x5b, 0x77, 0x7b, 0xed, 0x8d,
+  0x7a, 0xe7, 0xfa, 0xb6, 0xd2, 0x1d, 0x76, 0x2f, 0xd4, 0x87, 0xb6, 0x5c,
+  0xaa, 0x3f, 0x6f, 0xbb, 0x6e, 0x17, 0x7e, 0x7c, 0xf1, 0x62, 0x1d, 0xd6,
+  0x4b, 0xe7, 0x37, 0x2f, 0xfe, 0x52, 0xa8, 0xdb, 0x47, 0xe3, 0x0f, 0x0e,
+  0x52, 0x6d, 0x50, 0x3b, 0xe3, 0x1b, 0xdb, 0x75, 0xa6, 0x52, 0x9d, 0x53,
+  0x25, 0xc4, 0x2b, 0xdd, 0x56, 0xaa, 0xb2, 0xa1, 0xf3, 0x76, 0xd5, 0x77,
+  0x46, 0x61, 0xed, 0x0a, 0x02, 0x1b, 0x7a, 0x69, 0x4d, 0x28, 0x94, 0x5b,
+  0xab, 0x6e, 0x8b, 0x9d, 0xb5, 0x2d, 0x4d, 0x1b, 0x8c, 0xaa, 0x5c, 0xd9,
+  0x37, 0xa6, 0xed, 0x16, 0x0a, 0xeb, 0x55, 0xb9, 0xd5, 0xed, 0xc6, 0xb6,
+  0x1b, 0x65, 0x3b, 0x12, 0xdf, 0xba, 0x4e, 0xe9, 0xba, 0x76, 0x7b, 0x53,
+  0x2d, 0x0b, 0x18, 0xa0, 0x7e, 0xa5, 0xad, 0x8f, 0xd1, 0x40, 0x16, 0x65,
+  0xc4, 0x51, 0x26, 0x04, 0xe3, 0xd5, 0x7b, 0xd3, 0x1a, 0xaf, 0x6b, 0x75,
+  0xdf, 0xaf, 0x20, 0x5f, 0xdd, 0xc5, 0x33, 0x6c, 0x5b, 0x3a, 0xbf, 0x73,
+  0x5e, 0x77, 0xd0, 0x80, 0xb6, 0x74, 0x50, 0x3b, 0xb0, 0xaa, 0xa5, 0x6b,
+  0x2b, 0x4b, 0x06, 0x07, 0x12, 0x97, 0x24, 0xbf, 0xc9, 0x65, 0x4f, 0x85,
+  0x16, 0x51, 0xe8, 0x42, 0x85, 0x7e, 0xb7, 0xab, 0x0d, 0xe9, 0x0e, 0xf3,
+  0x57, 0x07, 0x5e, 0xaf, 0x2b, 0x91, 0x86, 0xe5, 0xec, 0x9a, 0x10, 0x58,
+  0x74, 0x0d, 0x87, 0xd0, 0x22, 0x03, 0x53, 0x96, 0x64, 0xc7, 0xcb, 0xa5,
+  0xba, 0x1e, 0x97, 0xfe, 0x64, 0xd6, 0xb6, 0x15, 0x2d, 0xf8, 0xed, 0x75,
+  0x50, 0x7d, 0xc0, 0xfa, 0xad, 0xf1, 0xc6, 0x22, 0x14, 0x17, 0xec, 0xb1,
+  0x78, 0xf0, 0x85, 0xf2, 0x66, 0x0d, 0x3d, 0xc9, 0xe3, 0x27, 0xf5, 0x15,
+  0x5f, 0x14, 0xa7, 0x7d, 0xb1, 0x60, 0xab, 0x69, 0xe9, 0x05, 0xdb, 0x76,
+  0x7f, 0xf7, 0x2d, 0x79, 0x67, 0x04, 0xb1, 0xa2, 0x17, 0xbf, 0x62, 0xcd,
+  0x9d, 0x5d, 0x79, 0xed, 0x0f, 0xb9, 0x1c, 0x0d, 0xbf, 0x42, 0x16, 0x4c,
+  0xd8, 0x3b, 0xff, 0x45, 0x6d, 0xe8, 0x8f, 0x36, 0x79, 0x69, 0x34, 0x65,
+  0x51, 0x38, 0x1c, 0xe2, 0xf1, 0x4c, 0xb7, 0xd0, 0x4b, 0x5d, 0xc3, 0xa1,
+  0xb6, 0xe4, 0xfc, 0x53, 0xce, 0x43, 0xca, 0x8d, 0x6b, 0x56, 0x96, 0x36,
+  0xfe, 0x93, 0xc4, 0xe8, 0xa0, 0x2a, 0xf2, 0xd4, 0xc4, 0x93, 0xd7, 0xad,
+  0xba, 0xc8, 0xf6, 0x5d, 0x50, 0xda, 0xe8, 0xf6, 0x20, 0x07, 0x43, 0x70,
+  0xa7, 0x1a, 0xfd, 0xc5, 0xb0, 0x43, 0xc9, 0x28, 0x9c, 0x62, 0x11, 0x30,
+  0xbf, 0xd6, 0xa5, 0x51, 0x3b, 0xef, 0x1e, 0x6d, 0x65, 0xaa, 0x22, 0x46,
+  0x2f, 0x5a, 0x22, 0xa9, 0xb8, 0xdf, 0xda, 0x72, 0x9b, 0x92, 0x90, 0xf5,
+  0xdc, 0x5b, 0xc8, 0x58, 0x69, 0x8a, 0x0c, 0x14, 0xcc, 0x36, 0x2c, 0x0b,
+  0x89, 0x20, 0xf2, 0x56, 0x23, 0x2d, 0x56, 0x65, 0xad, 0x03, 0xe7, 0x13,
+  0xfc, 0xc0, 0xbf, 0x0e, 0x6a, 0x4f, 0xce, 0x21, 0xe1, 0x95, 0x41, 0x06,
+  0x55, 0x58, 0xd8, 0xb8, 0xca, 0x14, 0xd8, 0xd2, 0x07, 0x16, 0x73, 0x4a,
+  0xcd, 0xd9, 0x76, 0x31, 0x5f, 0x5d, 0x4c, 0x9c, 0x24, 0xf6, 0x8b, 0xf5,
+  0xd8, 0x57, 0xf5, 0xa5, 0xec, 0x2b, 0x79, 0x11, 0x89, 0x86, 0x63, 0x6b,
+  0xdb, 0x7e, 0x91, 0x53, 0x8a, 0xdc, 0xe5, 0x7b, 0xdb, 0x6d, 0x27, 0x07,
+  0x50, 0xbd, 0xe1, 0x78, 0xed, 0x3b, 0x5b, 0xf6, 0xb5, 0xf6, 0xf3, 0xca,
+  0x8b, 0xeb, 0x0a, 0xde, 0x28, 0xfe, 0xa2, 0xc7, 0xd3, 0xa8, 0xed, 0x11,
+  0xb6, 0x46, 0x57, 0x0c, 0x17, 0xba, 0x0e, 0x80, 0x09, 0x54, 0xb4, 0x89,
+  0x39, 0x78, 0x07, 0x4d, 0xe0, 0xff, 0x08, 0x59, 0x17, 0x4b, 0xa9, 0x71,
+  0xbc, 0xf8, 0x19, 0xca, 0x36, 0x48, 0xba, 0x1b, 0xe7, 0xbd, 0x09, 0x3b,
+  0xaa, 0x52, 0x28, 0xfc, 0xe0, 0x7a, 0x5f, 0xa2, 0x02, 0xd6, 0x27, 0xb2,
+  0xa3, 0x31, 0x1a, 0x95, 0x06, 0xa9, 0xc5, 0xa9, 0x3d, 0xbc, 0xe5, 0x48,
+  0xb9, 0x85, 0x32, 0x5f, 0xcb, 0xba, 0xaf, 0xc4, 0x19, 0x07, 0x15, 0x64,
+  0x6d, 0x49, 0xb1, 0xa0, 0x0d, 0xc0, 0x8c, 0x01, 0x1b, 0x8e, 0x2d, 0xa3,
+  0xec, 0x5a, 0x10, 0x82, 0x04, 0x44, 0x87, 0x92, 0xdd, 0x22, 0x6a, 0xc1,
+  0xd5, 0x11, 0x40, 0x01, 0xa8, 0xc5, 0x24, 0x5b, 0x32, 0x5f, 0x4b, 0x19,
+  0x72, 0x66, 0xa5, 0x4c, 0x22, 0x47, 0x24, 0xec, 0x1e, 0xfd, 0x30, 0xb5,
+  0x25, 0x8f, 0xd6, 0x0d, 0x94, 0xfc, 0x96, 0x27, 0xdc, 0xea, 0xdf, 0xa6,
+  0xec, 0xd8, 0x1e, 0x3a, 0xf0, 0x05, 0x16, 0x67, 0x26, 0x0e, 0x3e, 0x99,
+  0x28, 0x06, 0xb0, 0xcc, 0x3c, 0x82, 0x6e, 0xa0, 0x0b, 0xd2, 0xb5, 0xef,
+  0x6c, 0x6d, 0xbb, 0x03, 0x25, 0xd5, 0xc6, 0x6b, 0xa0, 0x67, 0x6b, 0x0c,
+  0xe5, 0x24, 0xc9, 0xf0, 0x46, 0x52, 0x8d, 0x36, 0x1d, 0xbb, 0x69, 0xed,
+  0x5d, 0xc3, 0xda, 0x4c, 0x8e, 0xa1, 0x12, 0x1b, 0x9d, 0x4f, 0xbb, 0x1e,
+  0x0e, 0x00, 0xc9, 0x26, 0x26, 0x15, 0x7a, 0xc5, 0x49, 0xa7, 0xb3, 0x67,
+  0x5e, 0x2d, 0xd5, 0xed, 0xd7, 0xd2, 0xec, 0xd8, 0x0f, 0x80, 0x9b, 0x07,
+  0x18, 0x79, 0x0c, 0xdb, 0xf7, 0x77, 0xbc, 0xf8, 0x5f, 0xae, 0x47, 0xfe,
+  0x51, 0x05, 0xb4, 0x8f, 0xe6, 0x30, 0x87, 0x26, 0xf4, 0x3b, 0x00, 0x50,
+  0x10, 0x01, 0x01, 0x12, 0xc8, 0xd6, 0xb7, 0x43, 0x97, 0x8a, 0x40, 0xc5,
+  0x19, 0xee, 0xa0, 0xf1, 0xca, 0x90, 0xb6, 0x2b, 0x6a, 0x93, 0x54, 0x55,
+  0xe1, 0xa9, 0x83, 0x5f, 0x2f, 0xa1, 0x3a, 0x9d, 0x49, 0x5b, 0x7e, 0x76,
+  0x95, 0x5d, 0xdb, 0x31, 0xc2, 0x02, 0xf4, 0x1f, 0xd6, 0xea, 0x40, 0xea,
+  0xd1, 0x4b, 0x51, 0x0d, 0x1d, 0x74, 0x5a, 0x5c, 0x9c, 0x29, 0x14, 0x15,
+  0x5a, 0xe9, 0x65, 0x69, 0x74, 0x62, 0xc0, 0xbb, 0x02, 0x08, 0x21, 0x81,
+  0xc9, 0xd1, 0x77, 0xdd, 0xb7, 0x65, 0x42, 0x51, 0x8a, 0x20, 0x3d, 0x5d,
+  0x19, 0xe9, 0x58, 0x56, 0x00, 0x61, 0x0a, 0xb7, 0x05, 0x23, 0x25, 0x30,
+  0x92, 0xf3, 0x46, 0x0d, 0x42, 0x2f, 0x73, 0x80, 0x26, 0x60, 0x45, 0x56,
+  0x6f, 0xb8, 0x5f, 0x03, 0x16, 0x02, 0xe5, 0xf6, 0x7e, 0x6b, 0x38, 0x83,
+  0x47, 0x45, 0xe0, 0x36, 0xdb, 0x3e, 0x3a, 0xa4, 0xf3, 0xd5, 0x82, 0xde,
+  0xb4, 0x62, 0xe3, 0x34, 0x04, 0xa3, 0x9d, 0x4d, 0xf4, 0x4c, 0x11, 0xc1,
+  0xe5, 0x47, 0x72, 0x8c, 0xd2, 0x57, 0x31, 0x34, 0x93, 0x7e, 0x31, 0x42,
+  0x21, 0xeb, 0x2b, 0x72, 0xbf, 0x20, 0xb7, 0xd1, 0x62, 0x1c, 0x72, 0x51,
+  0x13, 0x10, 0x99, 0x35, 0x72, 0xb2, 0x83, 0xc9, 0x24, 0x07, 0xdb, 0x7a,
+  0x10, 0x1b, 0x29, 0x55, 0x2b, 0xb5, 0x66, 0x1e, 0x49, 0xff, 0x59, 0xbf,
+  0xa9, 0x9c, 0x11, 0xa8, 0x67, 0x27, 0x31, 0xd0, 0xd2, 0xfe, 0xb9, 0x27,
+  0x17, 0x53, 0xff, 0x04, 0x54, 0x45, 0xad, 0x1c, 0x7a, 0x3d, 0x71, 0x0b,
+  0xa9, 0x6a, 0xfc, 0x01, 0x05, 0x9a, 0x40, 0xdb, 0xf7, 0x38, 0x17, 0xc7,
+  0x79, 0x06, 0x51, 0xb2, 0xd8, 0x76, 0x20, 0x4d, 0x3d, 0xc8, 0x08, 0x5a,
+  0x89, 0x37, 0x8d, 0xb6, 0x48, 0x3a, 0xaa, 0x57, 0xe4, 0xc8, 0xba, 0xaf,
+  0x17, 0x38, 0x86, 0xcd, 0x5f, 0x8d, 0xe6, 0x0f, 0x49, 0xb5, 0x10, 0x80,
+  0x6e, 0x89, 0x7a, 0x45, 0xdf, 0x9d, 0xa1, 0x1b, 0x6e, 0x4d, 0x32, 0x72,
+  0xcf, 0x29, 0x2d, 0xa6, 0xae, 0x6a, 0x43, 0xb9, 0xc0, 0xde, 0xa3, 0x20,
+  0x70, 0x16, 0xbe, 0x59, 0xaa, 0x5f, 0x04, 0x28, 0x08, 0x53, 0x88, 0xf8,
+  0x45, 0xb6, 0xc4, 0x89, 0x0b, 0x03, 0xbc, 0xc5, 0x01, 0x5c, 0xc6, 0xa9,
+  0x73, 0xfd, 0xcd, 0x68, 0xd2, 0xee, 0x9d, 0xad, 0x4d, 0x18, 0xc0, 0x2a,
+  0x47, 0x1b, 0xf2, 0x40, 0xec, 0xb7, 0xb9, 0x97, 0x29, 0x0b, 0x32, 0x36,
+  0x86, 0xbf, 0x33, 0xe9, 0x85, 0x06, 0xe3, 0x61, 0xb9, 0x6b, 0x5b, 0x4b,
+  0xcc, 0x98, 0x63, 0x46, 0xd7, 0x4d, 0x3b, 0xd3, 0xac, 0xac, 0x43, 0x8f,
+  0xe6, 0x23, 0x0a, 0x14, 0xac, 0x40, 0x74, 0x1f, 0x13, 0x3d, 0xb7, 0x96,
+  0xe2, 0x29, 0xb7, 0x0e, 0xee, 0x98, 0x65, 0x11, 0xd2, 0x42, 0x64, 0x67,
+  0x7a, 0x55, 0xc5, 0xa0, 0x58, 0x24, 0x00, 0xb5, 0x05, 0xcf, 0x15, 0x9a,
+  0xdb, 0x22, 0xff, 0x3d, 0x0c, 0xaa, 0x49, 0x33, 0xdd, 0x18, 0x2c, 0x44,
+  0xe4, 0xb9, 0xcc, 0x40, 0x7b, 0xfb, 0xb2, 0x43, 0xc2, 0x15, 0xb5, 0xc6,
+  0x89, 0x9d, 0x70, 0x4c, 0x5d, 0x96, 0xa0, 0x64, 0x8e, 0x56, 0x11, 0x00,
+  0xa3, 0xad, 0xd5, 0x50, 0xbd, 0xf4, 0x2e, 0x50, 0x4a, 0xa2, 0x19, 0x9b,
+  0x21, 0xcd, 0x64, 0x03, 0x60, 0x70, 0x57, 0x33, 0x59, 0xbd, 0xec, 0x0c,
+  0xa7, 0xde, 0xda, 0xec, 0x0d, 0xf7, 0x6d, 0x43, 0xc5, 0xa5, 0x6a, 0xd3,
+  0x6e, 0xba, 0x2d, 0xca, 0x8b, 0x2a, 0xa0, 0x42, 0x6d, 0xa3, 0x4c, 0x93,
+  0x8b, 0xd6, 0x8e, 0x08, 0x33, 0x42, 0x37, 0x14, 0xd2, 0x7b, 0xfb, 0xc8,
+  0x24, 0xa2, 0xc1, 0x76, 0x24, 0x3e, 0xcc, 0x81, 0x17, 0x24, 0x99, 0x8c,
+  0x86, 0xdb, 0xf2, 0x6a, 0xcc, 0x63, 0xc8, 0x01, 0x88, 0x75, 0x90, 0x51,
+  0x16, 0xa6, 0xa6, 0xd4, 0xea, 0xba, 0xc8, 0x25, 0x65, 0xd5, 0xb0, 0x84,
+  0x1e, 0x52, 0x9a, 0x13, 0xe3, 0xa2, 0x1e, 0x88, 0xdd, 0x09, 0x72, 0x67,
+  0xfc, 0x6f, 0x99, 0x72, 0xfd, 0xba, 0x04, 0x3f, 0xd9, 0x51, 0xbf, 0x99,
+  0xeb, 0xc0, 0x5a, 0x4e, 0x01, 0x23, 0x96, 0x43, 0x3c, 0x7c, 0x1c, 0x25,
+  0x48, 0x56, 0x9a, 0x26, 0x58, 0xf2, 0xdb, 0xe5, 0xb4, 0x77, 0x84, 0xd3,
+  0xfd, 0x60, 0xda, 0xad, 0xce, 0xe7, 0x8d, 0x64, 0x4b, 0xd1, 0x01, 0x70,
+  0xa8, 0xeb, 0x6c, 0x0c, 0x41, 0xe3, 0x82, 0xe0, 0x86, 0xba, 0xc0, 0xa3,
+  0x01, 0x68, 0x20, 0x14, 0x94, 0x2c, 0xe8, 0xd8, 0x98, 0x7f, 0x60, 0x42,
+  0x8e, 0xd6, 0x51, 0xfd, 0x62, 0xce, 0x29, 0x92, 0xdb, 0xa0, 0x4f, 0xa7,
+  0x59, 0x8f, 0x08, 0x53, 0x33, 0xf2, 0x0b, 0x6b, 0x3d, 0x41, 0x09, 0x0c,
+  0x35, 0x34, 0x23, 0x19, 0x24, 0x21, 0xea, 0x93, 0xfa, 0x6f, 0x65, 0x56,
+  0xfd, 0x86, 0xc7, 0x26, 0x2e, 0x83, 0x59, 0x8f, 0xb0, 0xd2, 0x64, 0x98,
+  0x7b, 0x41, 0x41, 0x0e, 0x39, 0x10, 0xe2, 0xf7, 0xe7, 0xca, 0x31, 0x1b,
+  0x12, 0xd8, 0x31, 0xff, 0xd7, 0x6c, 0x99, 0xb1, 0xcd, 0xdf, 0x91, 0x2f,
+  0xaa, 0xbc, 0xc2, 0x04, 0x7c, 0xcc, 0xa7, 0x58, 0x67, 0xcc, 0xb4, 0xa8,
+  0xc9, 0x43, 0x60, 0xd1, 0x32, 0x44, 0x8b, 0x73, 0xc0, 0xe1, 0x7b, 0x8a,
+  0x04, 0x77, 0x9b, 0xaf, 0xa6, 0xec, 0x73, 0x1a, 0x65, 0x58, 0x83, 0xf9,
+  0x96, 0x81, 0x78, 0x0d, 0x4e, 0x68, 0x9c, 0x08, 0xc0, 0x43, 0xf8, 0x21,
+  0x0a, 0x5e, 0x50, 0xcb, 0xdd, 0x1b, 0xa0, 0x05, 0xb5, 0x5e, 0x69, 0xf0,
+  0xa6, 0xc5, 0xf6, 0xca, 0x7a, 0x4a, 0xb9, 0xc8, 0x9b, 0x7a, 0x9a, 0x7c,
+  0x19, 0xd4, 0xa3, 0xf7, 0x76, 0x19, 0x79, 0x3a, 0x67, 0xfc, 0xcc, 0xf2,
+  0xea, 0x4a, 0xfd, 0xe4, 0x54, 0xd6, 0x59, 0x66, 0x99, 0x41, 0x3f, 0x2f,
+  0xaf, 0x22, 0x9f, 0xe1, 0x05, 0x4f, 0x11, 0xf4, 0xac, 0x77, 0x0d, 0x85,
+  0x44, 0x87, 0x27, 0x49, 0x47, 0xb3, 0xe8, 0xd3, 0x2c, 0x97, 0xd2, 0x47,
+  0x73, 0x47, 0x49, 0x02, 0x42, 0x6f, 0x3b, 0xee, 0x65, 0x78, 0x28, 0x52,
+  0xf2, 0xb2, 0xe5, 0x78, 0xc9, 0xcd, 0xc4, 0x22, 0xf7, 0x50, 0xda, 0x0d,
+  0xe7, 0x49, 0x7c, 0x15, 0x73, 0x57, 0x9a, 0x86, 0xe6, 0x34, 0x38, 0xe5,
+  0x51, 0x22, 0x27, 0xd9, 0xe4, 0x93, 0xa4, 0x1c, 0xb3, 0x76, 0x0a, 0x42,
+  0x9c, 0xb9, 0xf2, 0xad, 0xb3, 0x89, 0x43, 0xaa, 0x3b, 0x49, 0x69, 0x74,
+  0xdb, 0x12, 0x01, 0xdd, 0x99, 0x52, 0x56, 0x67, 0xac, 0xf2, 0x87, 0x79,
+  0x10, 0x29, 0x6d, 0xca, 0x44, 0x29, 0x93, 0x84, 0x53, 0x01, 0x58, 0x0e,
+  0x41, 0x7b, 0x75, 0xa5, 0x3e, 0x53, 0x65, 0x8d, 0x2e, 0x0b, 0x5b, 0x4d,
+  0xc5, 0x55, 0xc7, 0xd4, 0x6b, 0x0c, 0xdd, 0xb9, 0xd8, 0xd0, 0xb0, 0xf4,
+  0x34, 0x19, 0xa6, 0x51, 0x70, 0x8c, 0x58, 0xea, 0xbb, 0xd7, 0xa3, 0xa4,
+  0x71, 0x2b, 0xf2, 0x8a, 0x72, 0x87, 0x1d, 0x7f, 0x49, 0xd4, 0x8d, 0x88,
+  0x24, 0x7e, 0xf7, 0x3d, 0x8c, 0xb5, 0xcd, 0x20, 0xe6, 0x24, 0xc3, 0x05,
+  0x32, 0x79, 0xb4, 0x7d, 0x1a, 0x2d, 0x90, 0xfc, 0xed, 0x30, 0x12, 0x51,
+  0xd4, 0xbe, 0xa3, 0x7a, 0x6b, 0x76, 0x3d, 0x02, 0x3b, 0xc4, 0x9e, 0xc7,
+  0x04, 0x89, 0xfa, 0x25, 0xd0, 0x60, 0x9f, 0x31, 0x30, 0x72, 0x3f, 0x7e,
+  0x03, 0x12, 0x9f, 0x89, 0x5f, 0x12, 0x32, 0xd3, 0x20, 0x51, 0x8d, 0x61,
+  0xe6, 0xfe, 0x9e, 0x11, 0xa6, 0xb3, 0x64, 0x66, 0x36, 0x16, 0xf3, 0xb0,
+  0x3a, 0xbd, 0x66, 0x13, 0x57, 0x9b, 0x2b, 0x75, 0x2f, 0xa4, 0x02, 0xf4,
+  0x29, 0x74, 0xe8, 0xf0, 0x92, 0x46, 0x1f, 0x5a, 0x4a, 0xdb, 0x6c, 0xe4,
+  0x71, 0x2d, 0x94, 0x8b, 0x88, 0xbc, 0x77, 0x7d, 0x5d, 0x8d, 0x57, 0x0b,
+  0x8c, 0x6e, 0xc4, 0x0a, 0xff, 0xd3, 0x5b, 0x2f, 0x54, 0x23, 0x12, 0x15,
+  0x81, 0x75, 0x3b, 0xca, 0x9a, 0x8e, 0x2d, 0x43, 0xa2, 0x14, 0xf1, 0xda,
+  0x90, 0xc9, 0x22, 0xf9, 0x87, 0x4f, 0x13, 0x68, 0x00, 0x36, 0x75, 0xe4,
+  0x5c, 0x36, 0xf5, 0x48, 0x9e, 0xd4, 0x66, 0x6b, 0x88, 0xa8, 0xb0, 0x43,
+  0x1c, 0x5e, 0xb3, 0x1d, 0x2c, 0x47, 0x70, 0xcd, 0x9c, 0x2e, 0x88, 0x74,
+  0xf2, 0x14, 0x34, 0xf3, 0xcb, 0x87, 0x54, 0x70, 0xf1, 0xfa, 0x41, 0x4a,
+  0x2e, 0xc2, 0x17, 0xed, 0x7c, 0x5e, 0xe1, 0x9d, 0x9a, 0x93, 0xd5, 0xe5,
+  0x07, 0x2e, 0x48, 0x72, 0x27, 0xdf, 0xf0, 0xc8, 0x4c, 0xf8, 0xb6, 0x7a,
+  0x29, 0x95, 0x7f, 0x2e, 0x18, 0xaa, 0xe9, 0x43, 0x47, 0xc4, 0x4c, 0x1a,
+  0x49, 0xea, 0x5b, 0x4f, 0x82, 0x1a, 0x39, 0xe2, 0x2c, 0x50, 0x89, 0x03,
+  0x2a, 0xb3, 0x4c, 0x33, 0xdd, 0x44, 0x9b, 0x57, 0xc2, 0xd4, 0xf8, 0xd0,
+  0x14, 0xd3, 0xb9, 0x7a, 0x24, 0x21, 0xd7, 0x30, 0xb2, 0x80, 0xdf, 0x02,
+  0x10, 0x3c, 0xb0, 0xe4, 0x18, 0x71, 0x1a, 0x1c, 0xae, 0x28, 0x65, 0xff,
+  0x90, 0x91, 0xa3, 0x61, 0xe4, 0x9e, 0x10, 0x24, 0xb4, 0x3b, 0x58, 0x9d,
+  0x70, 0x22, 0x8e, 0x3c, 0xd6, 0x44, 0x7c, 0xa5, 0xeb, 0xe2, 0x78, 0xcf,
+  0x94, 0x5f, 0x72, 0x14, 0xa9, 0xa4, 0xe8, 0x4e, 0x84, 0x75, 0xb5, 0x09,
+  0xc0, 0xe9, 0x62, 0xab, 0x1e, 0x05, 0x26, 0x06, 0x25, 0x11, 0x97, 0x39,
+  0x33, 0xbe, 0x2b, 0x4e, 0x1d, 0x46, 0xc4, 0x2a, 0x73, 0x78, 0xa4, 0xd6,
+  0xf1, 0xc5, 0x8c, 0x32, 0x14, 0x93, 0x0e, 0x93, 0x8f, 0x08, 0x3a, 0xde,
+  0x84, 0x65, 0x08, 0x78, 0x82, 0xf1, 0x15, 0x69, 0x52, 0x88, 0x95, 0xfa,
+  0x4d, 0x8a, 0x3d, 0xa5, 0x24, 0x47, 0x47, 0x9c, 0x60, 0x25, 0x01, 0x93,
+  0x43, 0xe6, 0x3e, 0x92, 0x33, 0xbd, 0x54, 0x5c, 0x40, 0xb1, 0x41, 0x90,
+  0x08, 0x80, 0xf8, 0x89, 0x9f, 0xb2, 0xa0, 0x2c, 0xa4, 0xf5, 0x93, 0xa1,
+  0xa6, 0x3a, 0xd7, 0x7f, 0x8f, 0x98, 0xd4, 0x13, 0x6c, 0xef, 0xa4, 0x1d,
+  0xd2, 0x59, 0x87, 0x51, 0x96, 0xa4, 0x8c, 0xd7, 0x8d, 0xa7, 0x6e, 0x46,
+  0x17, 0x11, 0x3e, 0x90, 0x4b, 0x52, 0xfe, 0x7b, 0xba, 0xd3, 0x26, 0x78,
+  0x59, 0x5b, 0xe9, 0xfd, 0xec, 0xc0, 0xe4, 0x3d, 0x5a, 0x91, 0x59, 0x9d,
+  0x86, 0xc8, 0x89, 0xbf, 0x58, 0xf9, 0x1f, 0x96, 0xea, 0x93, 0x79, 0xb4,
+  0x21, 0xbb, 0x50, 0x79, 0xf6, 0xe7, 0x80, 0x61, 0x5e, 0x3d, 0xf7, 0xed,
+  0x43, 0xb2, 0x9f, 0xf6, 0x84, 0x2d, 0x71, 0x6e, 0x3e, 0x26, 0x5e, 0x9f,
+  0xb5, 0x66, 0x9f, 0x20, 0x29, 0x14, 0xcf, 0xfe, 0x00, 0x21, 0x57, 0x60,
+  0x68, 0x84, 0x0c, 0xc6, 0xf8, 0x7f, 0xa9, 0x1e, 0x28, 0x1b, 0x21, 0x2d,
+  0x5d, 0x7b, 0x04, 0x69, 0x64, 0x74, 0x4b, 0x83, 0x51, 0x93, 0x2e, 0x5b,
+  0x51, 0x34, 0x61, 0x67, 0xbd, 0xed, 0x12, 0x82, 0xa7, 0xfe, 0x18, 0x77,
+  0x48, 0x43, 0x81, 0xae, 0x05, 0xa0, 0x12, 0xd4, 0x90, 0x36, 0x54, 0x06,
+  0x33, 0x44, 0xcd, 0x97, 0x40, 0x55, 0x85, 0xe5, 0x81, 0x15, 0x46, 0x84,
+  0xd1, 0xc8, 0x28, 0x0f, 0x18, 0x1b, 0x4a, 0xe3, 0xe3, 0xfd, 0xd3, 0x2d,
+  0x51, 0xfa, 0x84, 0xb0, 0x88, 0xe4, 0x06, 0xf9, 0x40, 0xa5, 0x4a, 0x1f,
+  0x70, 0x10, 0x8b, 0x1e, 0x0e, 0xa0, 0x90, 0xa4, 0x15, 0x98, 0x7c, 0x57,
+  0xc6, 0x33, 0xc4, 0xe5, 0xa5, 0x0e, 0x76, 0x4a, 0x45, 0x02, 0x94, 0x37,
+  0xd8, 0x4f, 0x74, 0x7e, 0x80, 0xab, 0x54, 0xbf, 0x0a, 0x67, 0xd2, 0x74,
+  0x13, 0x45, 0x64, 0x0d, 0xf9, 0xd9, 0x3e, 0xbc, 0x20, 0x66, 0x8e, 0x0a,
+  0xa0, 0xc1, 0x78, 0xb8, 0x89, 0xbe, 0x28, 0xf8, 0x62, 0xc3, 0xf0, 0xbd,
+  0x17, 0xd1, 0x3d, 0x52, 0x64, 0xab, 0x1f, 0x05, 0x5e, 0x23, 0xfe, 0xe2,
+  0x88, 0xa1, 0x62, 0xd5, 0xe4, 0xf3, 0x4f, 0x91, 0x7d, 0xfe, 0x31, 0x96,
+  0x4b, 0x8b, 0xf5, 0xa1, 0x2c, 0x97, 0xf8, 0xe7, 0x1d, 0xc8, 0xcb, 0x85,
+  0xc6, 0x4c, 0x85, 0x62, 0x5c, 0x19, 0xef, 0xe7, 0xcf, 0xe5, 0x55, 0x72,
+  0x9c, 0x9a, 0x3a, 0xae, 0xc8, 0x1d, 0x37, 0x5e, 0x43, 0xb1, 0x07, 0x69,
+  0x3e, 0x9d, 0x7a, 0xff, 0x37, 0x7c, 0xe9, 0x19, 0xae, 0xdd, 0xb6, 0x8e,
+  0xae, 0x9b, 0x48, 0xf3, 0xb3, 0x9f, 0xce, 0xce, 0x08, 0x51, 0x72, 0x79,
+  0xf5, 0x6c, 0x0b, 0xe3, 0xa5, 0xe6, 0xb1, 0x91, 0x4f, 0x67, 0x07, 0x12,
+  0xf4, 0x2b, 0xf4, 0xd4, 0x94, 0xc0, 0x25, 0x1a, 0x46, 0x01, 0x98, 0xe0,
+  0x68, 0xac, 0x7b, 0xba, 0x4d, 0x19, 0x2a, 0xee, 0xf9, 0x9f, 0xfc, 0xc0,
+  0x72, 0xeb, 0x9a, 0x93, 0xe3, 0xb0, 0x88, 0x01, 0xa5, 0x33, 0xbe, 0x0b,
+  0x62, 0x4c, 0xa9, 0xd0, 0x78, 0x3b, 0xfe, 0x78, 0xc7, 0x41, 0x2d, 0xe9,
+  0x36, 0x59, 0xd3, 0x6c, 0x15, 0x43, 0x3c, 0x16, 0x45, 0x41, 0x93, 0x84,
+  0x66, 0x7c, 0xd4, 0x7d, 0xb7, 0x75, 0xde, 0xfe, 0x57, 0x50, 0x82, 0x3a,
+  0x2d, 0x59, 0x46, 0x5f, 0x3e, 0xc5, 0xc3, 0x7c, 0x4e, 0xda, 0x19, 0x67,
+  0xbc, 0x62, 0xf8, 0x5a, 0xf3, 0x3f, 0xa4, 0xa1, 0x58, 0xbb
 };
-unsigned int qt_txt_len = 7652;
+static constexpr unsigned int qt_txt_len = 2626;
@@ -1,72 +1,49 @@
-unsigned char sodium_txt[] = {
-  0x2f, 0x2a, 0x0a, 0x20, 0x2a, 0x20, 0x49, 0x53, 0x43, 0x20, 0x4c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x20, 0x2a, 0x0a, 0x20, 0x2a, 0x20,
-  0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63,
-  0x29, 0x20, 0x32, 0x30, 0x31, 0x33, 0x2d, 0x32, 0x30, 0x32, 0x30, 0x0a,
-  0x20, 0x2a, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x6b, 0x20, 0x44, 0x65, 0x6e,
-  0x69, 0x73, 0x20, 0x3c, 0x6a, 0x20, 0x61, 0x74, 0x20, 0x70, 0x75, 0x72,
-  0x65, 0x66, 0x74, 0x70, 0x64, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x6f, 0x72,
-  0x67, 0x3e, 0x0a, 0x20, 0x2a, 0x0a, 0x20, 0x2a, 0x20, 0x50, 0x65, 0x72,
-  0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x75,
-  0x73, 0x65, 0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x2c, 0x20, 0x6d, 0x6f,
-  0x64, 0x69, 0x66, 0x79, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72,
-  0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x20, 0x2a,
-  0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74,
-  0x20, 0x66, 0x65, 0x65, 0x20, 0x69, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65,
-  0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x2c, 0x20,
-  0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61,
-  0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x0a,
-  0x20, 0x2a, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x61,
-  0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c,
-  0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x2a, 0x0a,
-  0x20, 0x2a, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57,
-  0x41, 0x52, 0x45, 0x20, 0x49, 0x53, 0x20, 0x50, 0x52, 0x4f, 0x56, 0x49,
-  0x44, 0x45, 0x44, 0x20, 0x22, 0x41, 0x53, 0x20, 0x49, 0x53, 0x22, 0x20,
-  0x41, 0x4e, 0x44, 0x20, 0x54, 0x48, 0x45, 0x20, 0x41, 0x55, 0x54, 0x48,
-  0x4f, 0x52, 0x20, 0x44, 0x49, 0x53, 0x43, 0x4c, 0x41, 0x49, 0x4d, 0x53,
-  0x20, 0x41, 0x4c, 0x4c, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e, 0x54,
-  0x49, 0x45, 0x53, 0x0a, 0x20, 0x2a, 0x20, 0x57, 0x49, 0x54, 0x48, 0x20,
-  0x52, 0x45, 0x47, 0x41, 0x52, 0x44, 0x20, 0x54, 0x4f, 0x20, 0x54, 0x48,
-  0x49, 0x53, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20,
-  0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20, 0x41, 0x4c,
-  0x4c, 0x20, 0x49, 0x4d, 0x50, 0x4c, 0x49, 0x45, 0x44, 0x20, 0x57, 0x41,
-  0x52, 0x52, 0x41, 0x4e, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4f, 0x46, 0x0a,
-  0x20, 0x2a, 0x20, 0x4d, 0x45, 0x52, 0x43, 0x48, 0x41, 0x4e, 0x54, 0x41,
-  0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x46,
-  0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x2e, 0x20, 0x49, 0x4e, 0x20, 0x4e,
-  0x4f, 0x20, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x20, 0x53, 0x48, 0x41, 0x4c,
-  0x4c, 0x20, 0x54, 0x48, 0x45, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4f, 0x52,
-  0x20, 0x42, 0x45, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x46,
-  0x4f, 0x52, 0x0a, 0x20, 0x2a, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x53, 0x50,
-  0x45, 0x43, 0x49, 0x41, 0x4c, 0x2c, 0x20, 0x44, 0x49, 0x52, 0x45, 0x43,
-  0x54, 0x2c, 0x20, 0x49, 0x4e, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x2c,
-  0x20, 0x4f, 0x52, 0x20, 0x43, 0x4f, 0x4e, 0x53, 0x45, 0x51, 0x55, 0x45,
-  0x4e, 0x54, 0x49, 0x41, 0x4c, 0x20, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45,
-  0x53, 0x20, 0x4f, 0x52, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x44, 0x41, 0x4d,
-  0x41, 0x47, 0x45, 0x53, 0x0a, 0x20, 0x2a, 0x20, 0x57, 0x48, 0x41, 0x54,
-  0x53, 0x4f, 0x45, 0x56, 0x45, 0x52, 0x20, 0x52, 0x45, 0x53, 0x55, 0x4c,
-  0x54, 0x49, 0x4e, 0x47, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x4c, 0x4f,
-  0x53, 0x53, 0x20, 0x4f, 0x46, 0x20, 0x55, 0x53, 0x45, 0x2c, 0x20, 0x44,
-  0x41, 0x54, 0x41, 0x20, 0x4f, 0x52, 0x20, 0x50, 0x52, 0x4f, 0x46, 0x49,
-  0x54, 0x53, 0x2c, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 0x52, 0x20,
-  0x49, 0x4e, 0x20, 0x41, 0x4e, 0x0a, 0x20, 0x2a, 0x20, 0x41, 0x43, 0x54,
-  0x49, 0x4f, 0x4e, 0x20, 0x4f, 0x46, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x52,
-  0x41, 0x43, 0x54, 0x2c, 0x20, 0x4e, 0x45, 0x47, 0x4c, 0x49, 0x47, 0x45,
-  0x4e, 0x43, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52,
-  0x20, 0x54, 0x4f, 0x52, 0x54, 0x49, 0x4f, 0x55, 0x53, 0x20, 0x41, 0x43,
-  0x54, 0x49, 0x4f, 0x4e, 0x2c, 0x20, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4e,
-  0x47, 0x20, 0x4f, 0x55, 0x54, 0x20, 0x4f, 0x46, 0x0a, 0x20, 0x2a, 0x20,
-  0x4f, 0x52, 0x20, 0x49, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43,
-  0x54, 0x49, 0x4f, 0x4e, 0x20, 0x57, 0x49, 0x54, 0x48, 0x20, 0x54, 0x48,
-  0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x50, 0x45, 0x52,
-  0x46, 0x4f, 0x52, 0x4d, 0x41, 0x4e, 0x43, 0x45, 0x20, 0x4f, 0x46, 0x20,
-  0x54, 0x48, 0x49, 0x53, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52,
-  0x45, 0x2e, 0x0a, 0x20, 0x2a, 0x2f, 0x0a
+// NOTE compressed copy of txt/sodium.txt in the format read by qUncompress:
+// the uncompressed size as a 32 bit big endian integer followed by a zlib
+// stream
+static constexpr unsigned char sodium_txt[] = {
+  0x00, 0x00, 0x03, 0x37, 0x78, 0xda, 0x55, 0x91, 0x5f, 0x6f, 0xdb, 0x20,
+  0x14, 0xc5, 0xdf, 0xfb, 0x29, 0xae, 0xfa, 0xb4, 0x56, 0x5e, 0x93, 0x65,
+  0xaf, 0x53, 0x25, 0x62, 0xe3, 0x18, 0x09, 0x43, 0x06, 0xb8, 0x55, 0x1f,
+  0x9d, 0x98, 0x24, 0x74, 0xad, 0xb1, 0x6c, 0xd2, 0x2a, 0xdf, 0x7e, 0x17,
+  0x92, 0x2a, 0xdb, 0x13, 0xe6, 0xcf, 0xf9, 0x9d, 0x73, 0x8f, 0x67, 0xf7,
+  0x37, 0x70, 0x0f, 0x4c, 0xe7, 0xc0, 0xdd, 0xd6, 0xf6, 0x93, 0xc5, 0x6d,
+  0x3c, 0xc9, 0xfd, 0x70, 0x1a, 0xdd, 0xfe, 0x10, 0xe0, 0xdb, 0xf6, 0x0e,
+  0x16, 0xf3, 0x1f, 0x3f, 0xbf, 0x2f, 0xe6, 0x8b, 0x79, 0xbc, 0x2a, 0xc7,
+  0xb6, 0xff, 0x03, 0x85, 0xed, 0xdd, 0x04, 0xbf, 0x5e, 0xa1, 0x0d, 0x30,
+  0x1c, 0x47, 0xbb, 0x0b, 0x43, 0x07, 0x9d, 0x0f, 0xe0, 0xc7, 0xfd, 0xe3,
+  0x05, 0xb2, 0xb6, 0xe3, 0xbb, 0x9b, 0x26, 0xe7, 0x7b, 0x08, 0x1e, 0x8e,
+  0x93, 0xcd, 0x60, 0x8b, 0xdc, 0x0c, 0xde, 0x7d, 0xe7, 0x76, 0xb8, 0xb6,
+  0x7d, 0x37, 0xf3, 0x23, 0x74, 0x6e, 0x0a, 0xa3, 0xdb, 0x1c, 0x83, 0x85,
+  0x70, 0x40, 0xea, 0xe4, 0x77, 0xe1, 0xb3, 0x1d, 0x2d, 0xec, 0xf0, 0xb2,
+  0xed, 0x4f, 0x91, 0x85, 0x1e, 0x83, 0x9f, 0x2c, 0x7c, 0xba, 0x70, 0x40,
+  0x8f, 0xb4, 0xfa, 0x63, 0x80, 0x9d, 0xb5, 0x80, 0x92, 0x83, 0x1d, 0xed,
+  0xe6, 0x04, 0x7b, 0xcc, 0x16, 0x6c, 0x97, 0xc1, 0x30, 0xfa, 0x0f, 0xd7,
+  0xd9, 0x0e, 0x81, 0x18, 0x30, 0x1c, 0x2c, 0xb4, 0x1b, 0xff, 0x11, 0xa7,
+  0x4b, 0x11, 0xce, 0xa3, 0xf5, 0x3e, 0xe0, 0xd0, 0x31, 0xc5, 0xd9, 0x77,
+  0xb8, 0xe6, 0xfd, 0xba, 0x1a, 0x06, 0xdb, 0x8e, 0xe0, 0x7a, 0x68, 0xdf,
+  0xde, 0xa2, 0xd2, 0xd9, 0xe9, 0xe1, 0x32, 0x9d, 0xa9, 0x28, 0x68, 0x59,
+  0x9a, 0x67, 0xa2, 0x28, 0x36, 0x08, 0x6b, 0x25, 0x9f, 0x58, 0x41, 0x0b,
+  0xb8, 0x25, 0x1a, 0xf7, 0xb7, 0x40, 0x44, 0x91, 0x1e, 0x91, 0xc6, 0x54,
+  0x52, 0x41, 0x81, 0x2d, 0x73, 0xc2, 0x6a, 0x0d, 0x84, 0x73, 0x40, 0x95,
+  0x22, 0xc2, 0x30, 0xaa, 0x23, 0xeb, 0x99, 0x99, 0x0a, 0x14, 0x5d, 0x11,
+  0x85, 0x12, 0x89, 0x2a, 0xe4, 0x5d, 0xd9, 0x22, 0xe7, 0x4d, 0xc1, 0xc4,
+  0x2a, 0x09, 0x59, 0xbd, 0xe6, 0x0c, 0x5d, 0xae, 0x00, 0x90, 0x65, 0x64,
+  0xd4, 0x54, 0xe5, 0x15, 0x9e, 0x90, 0x25, 0xe3, 0xcc, 0xbc, 0x24, 0xfb,
+  0x92, 0x19, 0x41, 0xb5, 0x7e, 0x40, 0x06, 0x08, 0x09, 0xf4, 0x89, 0x0a,
+  0x03, 0xba, 0x8a, 0x9c, 0x7f, 0x92, 0x2d, 0x29, 0x70, 0x46, 0x96, 0x9c,
+  0x42, 0x29, 0x55, 0x44, 0x11, 0xf1, 0x02, 0x7a, 0x4d, 0x73, 0x46, 0x78,
+  0x86, 0xb9, 0x15, 0xcd, 0x4d, 0x86, 0x88, 0xaf, 0x2f, 0x94, 0xe4, 0x52,
+  0x68, 0xfa, 0xbb, 0x41, 0x1c, 0xbe, 0x81, 0x82, 0xd4, 0x64, 0x15, 0x83,
+  0xa8, 0x24, 0xbd, 0x6c, 0xd3, 0x60, 0x15, 0x31, 0x5a, 0xa2, 0xaf, 0xc2,
+  0xf1, 0x74, 0xc3, 0x4d, 0x1c, 0xa3, 0x54, 0xb2, 0x06, 0x2e, 0x75, 0x4c,
+  0x0e, 0x8d, 0xa6, 0xe8, 0x41, 0x0c, 0x89, 0x6a, 0xec, 0x10, 0x23, 0xeb,
+  0x0c, 0x75, 0x14, 0x03, 0xaa, 0x98, 0x9b, 0x88, 0x14, 0x29, 0x37, 0x4c,
+  0x8a, 0x28, 0x40, 0x6b, 0xa3, 0x48, 0xcc, 0x21, 0xe8, 0x8a, 0xb3, 0x15,
+  0x15, 0x39, 0x8d, 0x5a, 0x99, 0x04, 0x46, 0x2a, 0x7c, 0xd8, 0xe8, 0x8b,
+  0x20, 0x03, 0xa2, 0x98, 0x8e, 0xa6, 0xb2, 0x31, 0x97, 0xa2, 0x64, 0xc2,
+  0x22, 0x46, 0xd0, 0x33, 0x34, 0xb5, 0x1f, 0xfb, 0xc0, 0x2c, 0x29, 0x05,
+  0x55, 0x58, 0x44, 0x4d, 0x12, 0xb8, 0xfc, 0xff, 0x6f, 0xc4, 0xbf, 0x3f,
+  0xbb, 0xf9, 0x0b, 0x5b, 0xa2, 0xeb, 0x83
 };
-unsigned int sodium_txt_len = 823;
+static constexpr unsigned int sodium_txt_len = 511;
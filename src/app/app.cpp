@@ -6,11 +6,14 @@
 #include "app.hpp"  // IWYU pragma: associated
 
 #include <otwrap.hpp>
+#include <QCoreApplication>
+#include <QMetaObject>
 #include <QThread>
 #include <iostream>
 #include <mutex>
 
 #include "app/imp.hpp"
+#include "util/profiler.hpp"
 
 namespace metier
 {
@@ -21,7 +24,7 @@ App::App(int& argc, char** argv) noexcept
     , imp_(*imp_p_)
 {
     connect(this, &App::passwordPrompt, this, &App::displayPasswordPrompt);
-    imp_.init(argc, argv);
+    util::Profiler::Measure("App::Imp::init", [&] { imp_.init(argc, argv); });
     auto* ot = imp_.otwrap();
     connect(ot, &OTWrap::needSeed, this, &App::displayFirstRun);
     connect(ot, &OTWrap::needProfileName, this, &App::displayNamePrompt);
@@ -44,7 +47,13 @@ auto App::displayMainWindow() -> void
 {
     imp_.displayMainWindow();
     imp_.init_ = true;
-    imp_.init_promise_.set_value();
+    util::Profiler::Finish();
+
+    if (imp_.exit_after_startup_) {
+        // NOTE queued because this may run before the event loop has started
+        QMetaObject::invokeMethod(
+            this, [] { QCoreApplication::exit(0); }, Qt::QueuedConnection);
+    }
 }
 
 auto App::displayNamePrompt() -> void { imp_.displayNamePrompt(); }
@@ -73,7 +82,8 @@ auto App::needPasswordPrompt(QString prompt, bool once) -> void
             imp_.displayPasswordPrompt(prompt, once);
         }
     } else {
-        imp_.init_future_.get();
+        // NOTE queued to the Qt thread. The calling thread waits for its own
+        // request without holding any lock the Qt thread might need.
         emit passwordPrompt(prompt, once);
     }
 }
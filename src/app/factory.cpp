@@ -6,6 +6,7 @@
 #include <boost/program_options.hpp>
 
 #include "app/imp.hpp"
+#include "util/profiler.hpp"
 
 namespace po = boost::program_options;
 
@@ -15,14 +16,28 @@ auto App::Imp::factory(App& parent, int& argc, char** argv) noexcept
     -> std::unique_ptr<Imp>
 {
     static constexpr auto advanced{"advanced"};
+    static constexpr auto exit_after_startup{"exit-after-startup"};
+    static constexpr auto headless{"headless"};
+    static constexpr auto profile_startup{"profile-startup"};
     [[maybe_unused]] auto use_advanced{false};
+    auto use_headless{false};
+    auto exit_after{false};
     const auto options = [] {
         const auto text = std::string{METIER_APP_NAME} + " options";
         auto out = po::options_description{text};
         out.add_options()(
             advanced,
             po::value<bool>()->implicit_value(true),
-            "Use advanced gui");
+            "Use advanced gui")(
+            headless,
+            po::value<bool>()->implicit_value(true),
+            "Run without any gui. Startup is driven by configuration options")(
+            profile_startup,
+            po::value<std::string>(),
+            "Write a Chrome trace of startup to the specified file")(
+            exit_after_startup,
+            po::value<bool>()->implicit_value(true),
+            "Exit as soon as startup is complete");
 
         return out;
     }();
@@ -44,19 +59,41 @@ auto App::Imp::factory(App& parent, int& argc, char** argv) noexcept
                 use_advanced = value.as<bool>();
             } catch (...) {
             }
+        } else if (name == headless) {
+            try {
+                use_headless = value.as<bool>();
+            } catch (...) {
+            }
+        } else if (name == profile_startup) {
+            try {
+                util::Profiler::Start(value.as<std::string>());
+            } catch (...) {
+            }
+        } else if (name == exit_after_startup) {
+            try {
+                exit_after = value.as<bool>();
+            } catch (...) {
+            }
         }
     }
 
+    auto output = util::Profiler::Measure("App::Imp::factory", [&] {
+        if (use_headless) { return factory_headless(parent, argc, argv); }
+
 #if METIER_QML_INTERFACE
-    if (use_advanced) {
+        if (use_advanced) {
 
-        return factory_widgets(parent, argc, argv);
-    } else {
+            return factory_widgets(parent, argc, argv);
+        } else {
 
-        return factory_qml(parent, argc, argv);
-    }
+            return factory_qml(parent, argc, argv);
+        }
 #else
-    return factory_widgets(parent, argc, argv);
+        return factory_widgets(parent, argc, argv);
 #endif
+    });
+    output->exit_after_startup_ = exit_after;
+
+    return output;
 }
 }  // namespace metier
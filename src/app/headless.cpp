@@ -0,0 +1,288 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "imp.hpp"  // IWYU pragma: associated
+
+#include <boost/program_options.hpp>
+#include <opentxs/opentxs.hpp>
+#include <otwrap.hpp>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QString>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "util/convertblockchain.hpp"
+#include "util/profiler.hpp"
+
+namespace ot = opentxs;
+namespace po = boost::program_options;
+
+namespace metier
+{
+// NOTE the headless app never constructs a widget, a qml engine, or a
+// QGuiApplication. Every decision the gui would ask the user to make is
+// answered from the command line instead.
+struct HeadlessApp final : public App::Imp, public QCoreApplication {
+    struct Config {
+        QString seed_words_{};
+        QString seed_passphrase_{};
+        int seed_type_{static_cast<int>(ot::crypto::SeedStyle::BIP39)};
+        int seed_lang_{static_cast<int>(ot::crypto::Language::en)};
+        QString password_{};
+        QString profile_name_{METIER_APP_NAME};
+        std::vector<std::string> blockchains_{};
+    };
+
+    App& parent_;
+    Config config_;
+    std::atomic_bool waiting_for_chains_;
+    std::unique_ptr<OTWrap> ot_;
+
+    static auto read_line(const std::string& path) noexcept -> QString
+    {
+        auto file = std::ifstream{path};
+        auto out = std::string{};
+
+        if (false == file.good()) {
+            qFatal("Unable to read %s", path.c_str());
+        }
+
+        std::getline(file, out);
+
+        return QString::fromStdString(out);
+    }
+    static auto read_words(const std::string& path) noexcept -> QString
+    {
+        auto file = QFile{QString::fromStdString(path)};
+
+        if (false == file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qFatal("Unable to read %s", path.c_str());
+        }
+
+        return QString::fromUtf8(file.readAll()).simplified();
+    }
+
+    auto displayBlockchainChooser() -> void final
+    {
+        auto enabled{0};
+
+        for (const auto& name : config_.blockchains_) {
+            const auto chain = find_blockchain(name);
+
+            if (0 == chain) {
+                qWarning() << "Unknown blockchain:" << name.c_str();
+
+                continue;
+            }
+
+            if (ot_->enableBlockchain(chain)) { ++enabled; }
+        }
+
+        if (0 == enabled) {
+            qFatal("No blockchain configured. Use --blockchain=<name>");
+        }
+
+        // NOTE startup resumes once the blockchain selection model reports
+        // the newly enabled chains
+        waiting_for_chains_ = true;
+    }
+
+    auto displayFirstRun() -> void final
+    {
+        if (config_.seed_words_.isEmpty()) {
+            qFatal("No wallet seed exists. Use --seed-file=<path>");
+        }
+
+        ot_->importSeed(
+            config_.seed_type_,
+            config_.seed_lang_,
+            config_.seed_words_,
+            config_.seed_passphrase_);
+    }
+
+    auto displayMainWindow() -> void final
+    {
+        qInfo() << METIER_APP_NAME << "is ready";
+    }
+
+    auto displayNamePrompt() -> void final
+    {
+        ot_->createNym(config_.profile_name_);
+    }
+
+    auto displayPasswordPrompt(QString, bool) -> void final {}
+
+    auto confirmPassword(QString, QString) -> QString final
+    {
+        return config_.password_;
+    }
+
+    auto getPassword(QString, QString) -> QString final
+    {
+        return config_.password_;
+    }
+
+    auto init(int& argc, char** argv) noexcept -> void final
+    {
+        // NOTE the password callback may be invoked while OTWrap is being
+        // constructed so the configuration must be complete before then
+        config_ = parse(argc, argv);
+        ot_ = util::Profiler::Measure("OTWrap", [&] {
+            return std::make_unique<OTWrap>(*this, parent_, argc, argv);
+        });
+        connect(ot_.get(), &OTWrap::chainsChanged, this, [this](int count) {
+            if ((0 < count) && waiting_for_chains_.exchange(false)) {
+                emit parent_.startup();
+            }
+        });
+        // NOTE OTWrap asks for the seed or profile name again when creating
+        // it fails, and the configuration would only fail the same way again.
+        // The connection is direct so the process stops on the jobs worker
+        // before a repeated job can start.
+        connect(
+            ot_.get(),
+            &OTWrap::jobFinished,
+            this,
+            [](int job, bool success) {
+                if (success) { return; }
+
+                switch (static_cast<OTWrap::Job>(job)) {
+                    case OTWrap::Job::importSeed: {
+                        qFatal("Unable to import the wallet seed. Check "
+                               "--seed-file, --seed-type and --seed-lang");
+                    }
+                    case OTWrap::Job::createNym: {
+                        qFatal("Unable to create an identity. Check "
+                               "--profile-name");
+                    }
+                    default: {
+                    }
+                }
+            },
+            Qt::DirectConnection);
+    }
+
+    auto run() -> int final { return exec(); }
+
+    auto otwrap() noexcept -> OTWrap* final { return ot_.get(); }
+
+    HeadlessApp(App& parent, int& argc, char** argv) noexcept
+        : QCoreApplication(argc, argv)
+        , parent_(parent)
+        , config_()
+        , waiting_for_chains_(false)
+        , ot_()
+    {
+    }
+
+    ~HeadlessApp() final = default;
+
+private:
+    static auto parse(int& argc, char** argv) noexcept -> Config
+    {
+        static constexpr auto blockchain{"blockchain"};
+        static constexpr auto password_file{"password-file"};
+        static constexpr auto profile_name{"profile-name"};
+        static constexpr auto seed_file{"seed-file"};
+        static constexpr auto seed_lang{"seed-lang"};
+        static constexpr auto seed_passphrase_file{"seed-passphrase-file"};
+        static constexpr auto seed_type{"seed-type"};
+        const auto options = [] {
+            auto out = po::options_description{
+                std::string{METIER_APP_NAME} + " headless options"};
+            out.add_options()(
+                blockchain,
+                po::value<std::vector<std::string>>()->composing(),
+                "Blockchain to enable if none are enabled. May be repeated")(
+                password_file,
+                po::value<std::string>(),
+                "File containing the wallet password on its first line")(
+                profile_name,
+                po::value<std::string>(),
+                "Profile name used when creating the first identity")(
+                seed_file,
+                po::value<std::string>(),
+                "File containing the recovery words of the wallet seed")(
+                seed_lang,
+                po::value<int>(),
+                "Language of the recovery words")(
+                seed_passphrase_file,
+                po::value<std::string>(),
+                "File containing the seed passphrase on its first line")(
+                seed_type, po::value<int>(), "Type of the wallet seed");
+
+            return out;
+        }();
+        auto variables = po::variables_map{};
+        auto out = Config{};
+
+        try {
+            auto parsed = po::command_line_parser(argc, argv)
+                              .options(options)
+                              .allow_unregistered()
+                              .run();
+            po::store(parsed, variables);
+            po::notify(variables);
+        } catch (po::error& e) {
+            qFatal("%s", e.what());
+        }
+
+        try {
+            for (const auto& [name, value] : variables) {
+                if (name == blockchain) {
+                    out.blockchains_ = value.as<std::vector<std::string>>();
+                } else if (name == password_file) {
+                    out.password_ = read_line(value.as<std::string>());
+                } else if (name == profile_name) {
+                    out.profile_name_ =
+                        QString::fromStdString(value.as<std::string>());
+                } else if (name == seed_file) {
+                    out.seed_words_ = read_words(value.as<std::string>());
+                } else if (name == seed_lang) {
+                    out.seed_lang_ = value.as<int>();
+                } else if (name == seed_passphrase_file) {
+                    out.seed_passphrase_ = read_line(value.as<std::string>());
+                } else if (name == seed_type) {
+                    out.seed_type_ = value.as<int>();
+                }
+            }
+        } catch (...) {
+            qFatal("Invalid headless configuration");
+        }
+
+        return out;
+    }
+
+    // NOTE accepts either the display name of a chain, compared without
+    // regard to case, or its numeric identifier
+    auto find_blockchain(const std::string& name) const noexcept -> int
+    {
+        const auto wanted = QString::fromStdString(name);
+
+        for (const auto chain : ot_->validBlockchains()) {
+            const auto display = QString::fromStdString(
+                ot::blockchain::DisplayString(util::convert(chain)));
+
+            if ((0 == display.compare(wanted, Qt::CaseInsensitive)) ||
+                (QString::number(chain) == wanted)) {
+
+                return chain;
+            }
+        }
+
+        return 0;
+    }
+};
+
+auto App::Imp::factory_headless(App& parent, int& argc, char** argv) noexcept
+    -> std::unique_ptr<Imp>
+{
+    return std::make_unique<HeadlessApp>(parent, argc, argv);
+}
+}  // namespace metier
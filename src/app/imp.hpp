@@ -20,11 +20,12 @@ struct App::Imp {
     static std::unique_ptr<App> singleton_;
 
     std::atomic_bool init_{false};
-    std::promise<void> init_promise_{};
-    std::future<void> init_future_{init_promise_.get_future()};
+    bool exit_after_startup_{false};
 
     static auto factory(App& parent, int& argc, char** argv) noexcept
         -> std::unique_ptr<Imp>;
+    static auto factory_headless(App& parent, int& argc, char** argv) noexcept
+        -> std::unique_ptr<Imp>;
     static auto factory_qml(App& parent, int& argc, char** argv) noexcept
         -> std::unique_ptr<Imp>;
     static auto factory_widgets(App& parent, int& argc, char** argv) noexcept
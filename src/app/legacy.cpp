@@ -10,8 +10,13 @@
 #include <QEventLoop>
 #include <QIcon>
 #include <QPushButton>
+#include <QThread>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 #include "util/focuser.hpp"
+#include "util/profiler.hpp"
 #include "util/scopeguard.hpp"
 #include "widgets/blockchainchooser.hpp"
 #include "widgets/enterpassphrase.hpp"
@@ -26,10 +31,14 @@ namespace metier
 struct LegacyApp final : public App::Imp, public QApplication {
     static std::unique_ptr<App> singleton_;
 
+    // NOTE every request has its own promise so a thread waiting for a
+    // password never holds a lock. Requests are displayed in the order they
+    // were queued.
     struct PasswordData {
+        using Request = std::shared_ptr<std::promise<QString>>;
+
         std::mutex lock_{};
-        std::promise<QString> promise_{};
-        std::future<QString> future_{};
+        std::deque<Request> queue_{};
     };
 
     App& parent_;
@@ -46,91 +55,76 @@ struct LegacyApp final : public App::Imp, public QApplication {
 
     auto displayBlockchainChooser() -> void final
     {
-        util::Focuser(blockchains_.get()).show();
+        util::Focuser(&blockchains()).show();
     }
 
     auto displayFirstRun() -> void final
     {
-        util::Focuser(first_run_.get()).show();
+        util::Focuser(&first_run()).show();
     }
 
     auto displayMainWindow() -> void final
     {
-        util::Focuser(main_window_.get()).show();
+        util::Focuser(&main_window()).show();
     }
 
     auto displayNamePrompt() -> void final
     {
-        util::Focuser(profile_alias_.get()).show();
+        util::Focuser(&profile_alias()).show();
     }
 
-    auto displayNewSeed() -> void { util::Focuser(new_seed_.get()).show(); }
+    auto displayNewSeed() -> void { util::Focuser(&new_seed()).show(); }
 
     auto displayRecovery() -> void
     {
-        util::Focuser(recover_wallet_.get()).show();
+        util::Focuser(&recover_wallet()).show();
     }
 
     auto confirmPassword(QString prompt, [[maybe_unused]] QString key)
         -> QString final
     {
-        auto lock = std::lock_guard<std::mutex>{password_.lock_};
-        password_.promise_ = {};
-        password_.future_ = password_.promise_.get_future();
-        parent_.needPasswordPrompt(prompt, false);
-
-        return password_.future_.get();
+        return password(prompt, false);
     }
 
+    // NOTE called on the Qt thread once for every queued request
     auto displayPasswordPrompt(QString prompt, bool once) -> void final
     {
-        using Widget = metier::widget::EnterPassphrase;
-        auto dialog = std::make_unique<Widget>(
-            prompt, once ? Widget::Mode::Once : Widget::Mode::Twice);
-        auto postcondition = metier::ScopeGuard{[&dialog]() {
-            dialog->deleteLater();
-            dialog.release();
-        }};
-        dialog->exec();
-        password_.promise_.set_value(dialog->secret());
+        const auto request = [&] {
+            auto lock = std::lock_guard<std::mutex>{password_.lock_};
+            auto& queue = password_.queue_;
+
+            if (queue.empty()) { return PasswordData::Request{}; }
+
+            auto out = queue.front();
+            queue.pop_front();
+
+            return out;
+        }();
+
+        if (request) { request->set_value(prompt_user(prompt, once)); }
     }
 
     auto getPassword(QString prompt, [[maybe_unused]] QString key)
         -> QString final
     {
-        auto lock = std::lock_guard<std::mutex>{password_.lock_};
-        password_.promise_ = {};
-        password_.future_ = password_.promise_.get_future();
-        parent_.needPasswordPrompt(prompt, true);
-
-        return password_.future_.get();
+        return password(prompt, true);
     }
 
     auto init(int& argc, char** argv) noexcept -> void final
     {
-        ot_ = std::make_unique<OTWrap>(*this, parent_, argc, argv);
-        first_run_ = std::make_unique<widget::FirstRun>(this);
-        new_seed_ = std::make_unique<widget::NewSeed>(this, *ot_);
-        recover_wallet_ = std::make_unique<widget::RecoverWallet>(this, *ot_);
-        profile_alias_ = std::make_unique<widget::ProfileAlias>(this);
-        blockchains_ = std::make_unique<widget::BlockchainChooser>(this, *ot_);
-        main_window_ = std::make_unique<widget::MainWindow>(this, *ot_);
-        auto* ot = ot_.get();
-        auto* first = first_run_.get();
-        auto* alias = profile_alias_.get();
-        auto* ok = blockchains_->Ok();
-        connect(
-            first,
-            &widget::FirstRun::wantNew,
-            this,
-            &LegacyApp::displayNewSeed);
-        connect(
-            first,
-            &widget::FirstRun::wantOld,
-            this,
-            &LegacyApp::displayRecovery);
-        connect(alias, &widget::ProfileAlias::gotAlias, ot, &OTWrap::createNym);
-        connect(ok, &QPushButton::clicked, &parent_, &App::startup);
+        ot_ = util::Profiler::Measure("OTWrap", [&] {
+            return std::make_unique<OTWrap>(*this, parent_, argc, argv);
+        });
+        // NOTE the main window is needed as soon as an identity exists
+        // because it loads its models in response to nymReady. Every other
+        // window is only created if startup asks for it.
+        connect(ot_.get(), &OTWrap::nymReady, this, [this] {
+            if (main_window_) { return; }
+
+            // NOTE connections made by the main window during this emission
+            // of nymReady are not invoked until the next one
+            main_window().initModels();
+        });
     }
 
     auto run() -> int final
@@ -142,6 +136,119 @@ struct LegacyApp final : public App::Imp, public QApplication {
 
     auto otwrap() noexcept -> OTWrap* final { return ot_.get(); }
 
+    auto blockchains() noexcept -> widget::BlockchainChooser&
+    {
+        if (!blockchains_) {
+            const auto span = util::Profiler::Span{"BlockchainChooser"};
+            blockchains_ =
+                std::make_unique<widget::BlockchainChooser>(this, *ot_);
+            connect(
+                blockchains_->Ok(),
+                &QPushButton::clicked,
+                &parent_,
+                &App::startup);
+        }
+
+        return *blockchains_;
+    }
+    auto first_run() noexcept -> widget::FirstRun&
+    {
+        if (!first_run_) {
+            const auto span = util::Profiler::Span{"FirstRun"};
+            first_run_ = std::make_unique<widget::FirstRun>(this);
+            auto* first = first_run_.get();
+            connect(
+                first,
+                &widget::FirstRun::wantNew,
+                this,
+                &LegacyApp::displayNewSeed);
+            connect(
+                first,
+                &widget::FirstRun::wantOld,
+                this,
+                &LegacyApp::displayRecovery);
+        }
+
+        return *first_run_;
+    }
+    // NOTE the Qt thread displays its own prompts immediately and never
+    // touches the request queue, so it can not wait behind a worker thread
+    auto password(const QString& prompt, const bool once) -> QString
+    {
+        if (QThread::currentThread() == thread()) {
+
+            return prompt_user(prompt, once);
+        }
+
+        auto request = std::make_shared<std::promise<QString>>();
+        auto future = request->get_future();
+
+        {
+            // NOTE queuing the request and the prompt under the same lock
+            // keeps the queue in the same order as the prompts
+            auto lock = std::lock_guard<std::mutex>{password_.lock_};
+            password_.queue_.emplace_back(std::move(request));
+            parent_.needPasswordPrompt(prompt, once);
+        }
+
+        return future.get();
+    }
+    auto prompt_user(const QString& prompt, const bool once) -> QString
+    {
+        using Widget = metier::widget::EnterPassphrase;
+        auto dialog = std::make_unique<Widget>(
+            prompt, once ? Widget::Mode::Once : Widget::Mode::Twice);
+        auto postcondition = metier::ScopeGuard{[&dialog]() {
+            dialog->deleteLater();
+            dialog.release();
+        }};
+        dialog->exec();
+
+        return dialog->secret();
+    }
+    auto main_window() noexcept -> widget::MainWindow&
+    {
+        if (!main_window_) {
+            const auto span = util::Profiler::Span{"MainWindow"};
+            main_window_ = std::make_unique<widget::MainWindow>(this, *ot_);
+        }
+
+        return *main_window_;
+    }
+    auto new_seed() noexcept -> widget::NewSeed&
+    {
+        if (!new_seed_) {
+            const auto span = util::Profiler::Span{"NewSeed"};
+            new_seed_ = std::make_unique<widget::NewSeed>(this, *ot_);
+        }
+
+        return *new_seed_;
+    }
+    auto profile_alias() noexcept -> widget::ProfileAlias&
+    {
+        if (!profile_alias_) {
+            const auto span = util::Profiler::Span{"ProfileAlias"};
+            profile_alias_ = std::make_unique<widget::ProfileAlias>(this);
+            connect(
+                profile_alias_.get(),
+                &widget::ProfileAlias::gotAlias,
+                ot_.get(),
+                &OTWrap::createNym);
+        }
+
+        return *profile_alias_;
+    }
+    auto recover_wallet() noexcept -> widget::RecoverWallet&
+    {
+        if (!recover_wallet_) {
+            const auto span = util::Profiler::Span{"RecoverWallet"};
+            recover_wallet_ =
+                std::make_unique<widget::RecoverWallet>(this, *ot_);
+        }
+
+        return *recover_wallet_;
+    }
+
     LegacyApp(App& parent, int& argc, char** argv) noexcept
         : QApplication(argc, argv)
         , parent_(parent)
@@ -24,6 +24,7 @@
 #include "otwrap.hpp"
 #include "qml.hpp"
 #include "util/claim.hpp"
+#include "util/profiler.hpp"
 
 namespace metier
 {
@@ -105,7 +106,9 @@ public:
 
     auto init(int& argc, char** argv) noexcept -> void final
     {
-        ot_ = std::make_unique<OTWrap>(*this, parent_, argc, argv);
+        ot_ = util::Profiler::Measure("OTWrap", [&] {
+            return std::make_unique<OTWrap>(*this, parent_, argc, argv);
+        });
 
         {
             auto* ot = ot_.get();
@@ -116,7 +119,9 @@ public:
 
         qml_.connect(
             qml_.engine(), &QQmlEngine::quit, this, &QCoreApplication::quit);
-        qml_.setSource(QUrl("qrc:/main.qml"));
+        util::Profiler::Measure("QQuickView::setSource", [&] {
+            qml_.setSource(QUrl("qrc:/main.qml"));
+        });
 
         if (qml_.status() == QQuickView::Error) { abort(); }
 
@@ -3,11 +3,58 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <boost/program_options/parsers.hpp>
+#include <exception>
 #include <iostream>
+#include <string>
 
 #include "cli/parser.hpp"
 #include "cli/processor.hpp"
 
+namespace po = boost::program_options;
+
+auto batch(
+    const metier::cli::Parser& parser,
+    metier::cli::Processor& processor) noexcept -> int;
+auto batch(
+    const metier::cli::Parser& parser,
+    metier::cli::Processor& processor) noexcept -> int
+{
+    using Command = metier::cli::Command;
+    using Format = metier::cli::Format;
+    auto line = std::string{};
+
+    while (std::getline(std::cin, line)) {
+        auto options = metier::cli::Options{};
+
+        // NOTE split_unix throws on an unknown escape or unbalanced quotes.
+        // Such a line is reported like any other syntax error and the batch
+        // continues with the next one.
+        try {
+            const auto args = po::split_unix(line);
+
+            if (args.empty()) { continue; }
+
+            options = parser.parse(args);
+        } catch (const std::exception& e) {
+            std::cerr << "Syntax error: " << e.what() << "\n\n";
+            options.show_help_ = true;
+        }
+
+        // NOTE watch never returns so it can not be part of a batch
+        if (options.show_help_ || options.batch_ ||
+            (Command::watch == options.command_)) {
+            options.command_ = Command::error;
+        }
+
+        options.format_ = Format::compact;
+        processor.process(options, std::cout);
+        std::cout.flush();
+    }
+
+    return processor.value();
+}
+
 auto main(int argc, char* argv[]) -> int
 {
     const auto parser = metier::cli::Parser{};
@@ -20,7 +67,10 @@ auto main(int argc, char* argv[]) -> int
     }
 
     auto processor = metier::cli::Processor{};
-    std::cout << processor.process(options) << '\n';
+
+    if (options.batch_) { return batch(parser, processor); }
+
+    processor.process(options, std::cout);
 
     return processor.value();
 }
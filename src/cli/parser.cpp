@@ -7,28 +7,54 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <iostream>
+#include <optional>
 #include <sstream>
 
+#include "rpc/protocol.hpp"
+
 namespace po = boost::program_options;
 
 namespace metier::cli
 {
 constexpr auto account_id_{"account"};
 constexpr auto amount_{"amount"};
+constexpr auto batch_{"batch"};
 constexpr auto cmd_list_accounts_{"list_accounts"};
 constexpr auto cmd_list_nyms_{"list_nyms"};
+constexpr auto cmd_send_batch_{"send_batch"};
 constexpr auto cmd_send_payment_{"send_payment"};
 constexpr auto cmd_show_account_{"get_transactions"};
+constexpr auto cmd_watch_{"watch"};
 constexpr auto command_{"command"};
+constexpr auto concurrency_{"concurrency"};
+constexpr auto cursor_{"cursor"};
+constexpr auto event_{"event"};
+constexpr auto file_{"file"};
+constexpr auto format_{"format"};
+constexpr auto format_compact_{"json"};
+constexpr auto format_ndjson_{"ndjson"};
+constexpr auto format_pretty_{"pretty"};
 constexpr auto from_{"from"};
 constexpr auto help_{"help"};
+constexpr auto limit_{"limit"};
+constexpr auto since_{"since"};
 constexpr auto to_{"to"};
 const auto usage_ =
     std::string{"Allowed commands:\n    "} + cmd_list_accounts_ + "\n    " +
     cmd_list_nyms_ + "\n    " + cmd_show_account_ + " --" + account_id_ +
-    "=<account to query>\n    " + cmd_send_payment_ + " --" + from_ + "=<id> " +
-    " --" + to_ + "=<address> " + " --" + amount_ + "=<value>";
+    "=<account to query> [--" + account_id_ + "=<account to query> ...]" +
+    " [--" + limit_ + "=<count>] [--" + since_ + "=<unix time>] [--" +
+    cursor_ + "=<cursor>] [--" + concurrency_ + "=<count>]" +
+    "\n    " + cmd_send_payment_ + " --" + from_ + "=<id> " + " --" + to_ +
+    "=<address> " + " --" + amount_ + "=<value>" + "\n    " +
+    cmd_send_batch_ + " --" + file_ + "=<csv or json file> [--" +
+    concurrency_ + "=<count>]" + "\n    " + cmd_watch_ +
+    " [--" + event_ + "=<event name> ...]";
+const auto format_usage_ = std::string{"Output format: "} + format_compact_ +
+                           " (default), " + format_ndjson_ +
+                           " (one record per line) or " + format_pretty_;
 using Map = boost::container::flat_map<Command, std::string>;
 using ReverseMap = boost::container::flat_map<std::string, Command>;
 auto command_map() noexcept -> const Map&;
@@ -37,29 +63,102 @@ auto command_map() noexcept -> const Map&
     static const auto map = Map{
         {Command::list_accounts, cmd_list_accounts_},
         {Command::list_nyms, cmd_list_nyms_},
+        {Command::send_batch, cmd_send_batch_},
         {Command::send_payment, cmd_send_payment_},
         {Command::show_account, cmd_show_account_},
+        {Command::watch, cmd_watch_},
     };
 
     return map;
 }
 
+auto translate_format(const std::string& in) noexcept
+    -> std::optional<Format>;
+auto translate_format(const std::string& in) noexcept -> std::optional<Format>
+{
+    static const auto map = boost::container::flat_map<std::string, Format>{
+        {format_compact_, Format::compact},
+        {format_ndjson_, Format::ndjson},
+        {format_pretty_, Format::pretty},
+    };
+
+    if (const auto it = map.find(in); map.end() != it) { return it->second; }
+
+    return std::nullopt;
+}
+
+// NOTE subscriptions match by prefix so a name which is not exactly one of
+// the published events would silently receive nothing, or the wrong events
+auto valid_event(const std::string& in) noexcept -> bool;
+auto valid_event(const std::string& in) noexcept -> bool
+{
+    static const auto events = {
+        std::string{rpc::event_activity_},
+        std::string{rpc::event_balance_},
+        std::string{rpc::event_send_},
+        std::string{rpc::event_sync_},
+    };
+
+    return events.end() != std::find(events.begin(), events.end(), in);
+}
+
 struct Parser::Imp {
     static const po::options_description desc_;
     static const po::positional_options_description pos_;
+
+    static auto parse(po::command_line_parser&& parser) noexcept -> Options;
 };
 
 const po::options_description Parser::Imp::desc_{[] {
     auto out = po::options_description{256};
     out.add_options()(help_, "Display this message");
+    out.add_options()(
+        batch_,
+        "Read newline-delimited commands from stdin and write one result per "
+        "line, reusing a single rpc connection");
     out.add_options()(command_, po::value<std::string>(), usage_.c_str());
     out.add_options()(
-        account_id_, po::value<std::string>(), "target account id");
+        format_,
+        po::value<std::string>(),
+        format_usage_.c_str());
+    out.add_options()(
+        account_id_,
+        po::value<std::vector<std::string>>()->composing(),
+        "target account id (may be repeated)");
+    out.add_options()(
+        limit_,
+        po::value<std::size_t>(),
+        "maximum number of transactions to return, oldest first");
+    out.add_options()(
+        since_,
+        po::value<std::int64_t>(),
+        "only return transactions at or after this unix timestamp");
+    out.add_options()(
+        cursor_,
+        po::value<std::string>(),
+        "only return transactions after the position returned by a previous "
+        "query of the same account");
+    out.add_options()(
+        event_,
+        po::value<std::vector<std::string>>()->composing(),
+        "event to watch: activity, balance, send or sync (may be repeated, "
+        "default all)");
     out.add_options()(
         amount_, po::value<std::int64_t>(), "value to send as an integer");
     out.add_options()(from_, po::value<std::string>(), "source account id");
     out.add_options()(
         to_, po::value<std::string>(), "recipient address or payment code");
+    out.add_options()(
+        file_,
+        po::value<std::string>(),
+        "payment list: csv lines of from,to,amount or a json array of "
+        "objects with from, to and amount members");
+    out.add_options()(
+        concurrency_,
+        po::value<std::size_t>(),
+        "maximum number of payments or accounts in flight at the same "
+        "time (default 1 payment or 8 accounts). The server runs at most "
+        "--rpc-write-limit payments at a time and queues the rest");
 
     return out;
 }()};
@@ -84,33 +183,64 @@ auto Parser::help() const noexcept -> std::string
     return out.str();
 }
 
-auto Parser::parse(int argc, char* argv[]) const noexcept -> Options
+auto Parser::Imp::parse(po::command_line_parser&& parser) noexcept -> Options
 {
     auto vars = po::variables_map{};
     auto out = Options{};
 
     try {
-        po::store(
-            po::command_line_parser(argc, argv)
-                .options(Imp::desc_)
-                .positional(Imp::pos_)
-                .run(),
-            vars);
+        po::store(parser.options(desc_).positional(pos_).run(), vars);
         po::notify(vars);
 
         for (const auto& [name, value] : vars) {
             if (name == help_) {
                 out.show_help_ = true;
+            } else if (name == batch_) {
+                out.batch_ = true;
             } else if (name == command_) {
                 out.command_ = translate(value.as<std::string>());
+            } else if (name == format_) {
+                const auto format = translate_format(value.as<std::string>());
+
+                if (false == format.has_value()) {
+                    std::cerr << "Unknown output format: "
+                              << value.as<std::string>() << "\n\n";
+                    out.show_help_ = true;
+
+                    return out;
+                }
+
+                out.format_ = format.value();
             } else if (name == account_id_) {
-                out.account_id_ = value.as<std::string>();
+                out.accounts_ = value.as<std::vector<std::string>>();
+            } else if (name == event_) {
+                out.events_ = value.as<std::vector<std::string>>();
+
+                for (const auto& event : out.events_) {
+                    if (false == valid_event(event)) {
+                        std::cerr << "Unknown event: " << event << "\n\n";
+                        out.show_help_ = true;
+
+                        return out;
+                    }
+                }
+            } else if (name == limit_) {
+                out.limit_ = value.as<std::size_t>();
+            } else if (name == since_) {
+                out.since_ = value.as<std::int64_t>();
+            } else if (name == cursor_) {
+                out.cursor_ = value.as<std::string>();
             } else if (name == amount_) {
                 out.amount_ = value.as<std::int64_t>();
             } else if (name == from_) {
                 out.from_ = value.as<std::string>();
             } else if (name == to_) {
                 out.to_ = value.as<std::string>();
+            } else if (name == file_) {
+                out.file_ = value.as<std::string>();
+            } else if (name == concurrency_) {
+                out.concurrency_ =
+                    std::max<std::size_t>(value.as<std::size_t>(), 1u);
             }
         }
     } catch (po::error& e) {
@@ -120,7 +250,7 @@ auto Parser::parse(int argc, char* argv[]) const noexcept -> Options
         return out;
     }
 
-    if ((out.command_ == Command::show_account) && out.account_id_.empty()) {
+    if ((out.command_ == Command::show_account) && out.accounts_.empty()) {
         std::cerr << "Required argument --" << account_id_
                   << " not provided\n\n";
         out.show_help_ = true;
@@ -128,11 +258,39 @@ auto Parser::parse(int argc, char* argv[]) const noexcept -> Options
         return out;
     }
 
+    if ((out.command_ == Command::send_batch) && out.file_.empty()) {
+        std::cerr << "Required argument --" << file_ << " not provided\n\n";
+        out.show_help_ = true;
+
+        return out;
+    }
+
+    if ((false == out.cursor_.empty()) && (1u < out.accounts_.size())) {
+        std::cerr << "--" << cursor_ << " requires a single --" << account_id_
+                  << "\n\n";
+        out.show_help_ = true;
+
+        return out;
+    }
+
+    if (out.batch_) { return out; }
+
     if (out.command_ == Command::error) { out.show_help_ = true; }
 
     return out;
 }
 
+auto Parser::parse(int argc, char* argv[]) const noexcept -> Options
+{
+    return Imp::parse(po::command_line_parser(argc, argv));
+}
+
+auto Parser::parse(const std::vector<std::string>& args) const noexcept
+    -> Options
+{
+    return Imp::parse(po::command_line_parser(args));
+}
+
 auto translate(Command in) noexcept -> std::string
 {
     try {
@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace metier::cli
 {
@@ -15,17 +18,33 @@ enum class Command {
     error,
     list_accounts,
     list_nyms,
+    send_batch,
     send_payment,
     show_account,
+    watch,
+};
+
+enum class Format {
+    pretty,
+    compact,
+    ndjson,
 };
 
 struct Options {
     Command command_{Command::error};
     bool show_help_{false};
-    std::string account_id_{};
+    bool batch_{false};
+    Format format_{Format::compact};
+    std::vector<std::string> accounts_{};
+    std::vector<std::string> events_{};
     std::string from_{};
     std::string to_{};
     std::int64_t amount_{};
+    std::string file_{};
+    std::optional<std::size_t> concurrency_{};
+    std::size_t limit_{};
+    std::optional<std::int64_t> since_{};
+    std::string cursor_{};
 };
 
 class Parser
@@ -33,6 +52,8 @@ class Parser
 public:
     auto help() const noexcept -> std::string;
     auto parse(int argc, char* argv[]) const noexcept -> Options;
+    auto parse(const std::vector<std::string>& args) const noexcept
+        -> Options;
 
     Parser() noexcept;
     ~Parser();
@@ -0,0 +1,148 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "cli/payments.hpp"  // IWYU pragma: associated
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/json.hpp>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace json = boost::json;
+
+namespace metier::cli
+{
+auto parse_amount(const std::string& in) noexcept
+    -> std::optional<std::int64_t>;
+auto parse_amount(const std::string& in) noexcept
+    -> std::optional<std::int64_t>
+{
+    try {
+        auto used = std::size_t{0};
+        const auto out = std::stoll(in, &used);
+
+        if (used != in.size()) { return std::nullopt; }
+
+        return out;
+    } catch (...) {
+
+        return std::nullopt;
+    }
+}
+
+auto parse_csv(const std::string& text, PaymentList& out) noexcept -> void;
+auto parse_csv(const std::string& text, PaymentList& out) noexcept -> void
+{
+    auto stream = std::istringstream{text};
+    auto line = std::string{};
+    auto number = std::size_t{0};
+    auto first{true};
+
+    while (std::getline(stream, line)) {
+        ++number;
+        boost::algorithm::trim(line);
+
+        if (line.empty() || ('#' == line.front())) { continue; }
+
+        auto fields = std::vector<std::string>{};
+        auto field = std::string{};
+        auto input = std::istringstream{line};
+
+        while (std::getline(input, field, ',')) {
+            boost::algorithm::trim(field);
+            fields.emplace_back(std::move(field));
+        }
+
+        const auto header = first;
+        first = false;
+
+        if (3u != fields.size()) {
+            out.error_ = "line " + std::to_string(number) +
+                         ": expected from,to,amount";
+
+            return;
+        }
+
+        const auto amount = parse_amount(fields.at(2));
+
+        if (false == amount.has_value()) {
+            if (header) { continue; }
+
+            out.error_ =
+                "line " + std::to_string(number) + ": invalid amount";
+
+            return;
+        }
+
+        out.payments_.push_back(
+            {std::move(fields.at(0)), std::move(fields.at(1)), amount.value()});
+    }
+}
+
+auto parse_json(const std::string& text, PaymentList& out) noexcept -> void;
+auto parse_json(const std::string& text, PaymentList& out) noexcept -> void
+{
+    auto index = std::size_t{0};
+
+    try {
+        for (const auto& value : json::parse(text).as_array()) {
+            const auto& item = value.as_object();
+            const auto& amount = item.at("amount");
+            auto payment = client::Payment{};
+            payment.from_ = std::string{item.at("from").as_string()};
+            payment.to_ = std::string{item.at("to").as_string()};
+
+            if (amount.is_string()) {
+                const auto parsed =
+                    parse_amount(std::string{amount.get_string()});
+
+                if (false == parsed.has_value()) {
+                    throw std::runtime_error{"invalid amount"};
+                }
+
+                payment.amount_ = parsed.value();
+            } else {
+                payment.amount_ = amount.to_number<std::int64_t>();
+            }
+
+            out.payments_.emplace_back(std::move(payment));
+            ++index;
+        }
+    } catch (...) {
+        out.payments_.clear();
+        out.error_ = "invalid payment at index " + std::to_string(index);
+    }
+}
+
+auto load_payments(const std::string& path) noexcept -> PaymentList
+{
+    auto out = PaymentList{};
+    auto file = std::ifstream{path, std::ios::binary};
+
+    if (false == file.good()) {
+        out.error_ = "unable to open " + path;
+
+        return out;
+    }
+
+    const auto text = std::string{
+        std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    const auto start = text.find_first_not_of(" \t\r\n");
+    const auto isJson = (std::string::npos != start) && ('[' == text[start]);
+
+    if (isJson) {
+        parse_json(text, out);
+    } else {
+        parse_csv(text, out);
+    }
+
+    return out;
+}
+}  // namespace metier::cli
@@ -0,0 +1,24 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "client/client.hpp"
+
+namespace metier::cli
+{
+struct PaymentList {
+    std::vector<client::Payment> payments_{};
+    std::string error_{};
+};
+
+// NOTE accepts either a json array of objects with from, to and amount
+// members or csv lines of from,to,amount. A csv header line, blank lines and
+// lines beginning with # are ignored.
+auto load_payments(const std::string& path) noexcept -> PaymentList;
+}  // namespace metier::cli
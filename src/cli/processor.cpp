@@ -5,492 +5,396 @@
 
 #include "cli/processor.hpp"  // IWYU pragma: associated
 
-#include <boost/container/flat_map.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/json/src.hpp>
-#include <opentxs/opentxs.hpp>
-#include <zmq.h>
-#include <chrono>
+#include <boost/json.hpp>
+#include <ctime>
+#include <deque>
+#include <future>
+#include <locale>
+#include <ostream>
 #include <sstream>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "cli/parser.hpp"
-#include "rpc/rpc.hpp"
+#include "cli/payments.hpp"
+#include "cli/writer.hpp"
+#include "client/client.hpp"
 
-namespace ot = opentxs;
 namespace json = boost::json;
 namespace ptime = boost::posix_time;
 
 namespace metier::cli
 {
-auto translate(Result code) noexcept -> std::string
-{
-    static const auto map = boost::container::flat_map<Result, std::string>{
-        {Result::success, "success"},
-        {Result::socket_not_ready, "rpc socket error"},
-        {Result::send_error, "rpc send error"},
-        {Result::receive_timeout, "rpc server timeout"},
-        {Result::receive_error, "rpc receive error"},
-    };
-
-    try {
-
-        return map.at(code);
-    } catch (...) {
-
-        return "unknown error";
-    }
-}
-
 struct Processor::Imp {
-    const std::string endpoint_;
-    const int linger_;
-
-    auto get_account_activity(const Options& data) noexcept -> std::string
+    // NOTE at most concurrency_ accounts are in flight at any time. Each
+    // account is written as soon as it arrives and accounts are written in the
+    // order they were given. Unless the caller asked for a specific page the
+    // complete history of an account is fetched with a single request, which
+    // the server sorts once.
+    auto get_account_activity(const Options& data, Writer& out) noexcept
+        -> void
     {
-        const auto request =
-            ot::rpc::request::GetAccountActivity{session_, {data.account_id_}};
-        auto base = std::unique_ptr<ot::rpc::response::Base>{};
-        auto out = json::object{};
-        out["command"] = translate(data.command_);
-        const auto result = send(request, base);
-
-        if (Result::success == result) {
-            const auto& reply = base->asGetAccountActivity();
-            auto events = json::array{};
-
-            if (0u < reply.Activity().size()) {
-                out["account"] = reply.Activity().front().AccountID();
+        const auto paged = (0u < data.limit_) || data.since_.has_value() ||
+                           (false == data.cursor_.empty());
+        const auto ndjson = (Format::ndjson == out.format());
+        const auto single = (1u == data.accounts_.size());
+        const auto limit = data.concurrency_.value_or(account_window_);
+        auto window = std::deque<std::future<client::ActivityPage>>{};
+        auto next = data.accounts_.begin();
+        const auto fill = [&] {
+            for (; (window.size() < limit) &&
+                   (data.accounts_.end() != next);
+                 ++next) {
+                window.emplace_back(client_.activity(
+                    {*next, data.limit_, data.since_, data.cursor_}));
             }
+        };
 
-            for (const auto& event : reply.Activity()) {
-                auto tx = json::object{};
-                tx["id"] = event.UUID();
-                tx["time"] = [&] {
-                    auto time = ot::Clock::to_time_t(event.Timestamp());
-                    auto ptime = ptime::from_time_t(time);
-                    auto facet = std::make_unique<ptime::time_facet>(
-                        "%a %b %d %l:%M:%S %p %Y");
-                    auto text = std::stringstream{};
-                    text.imbue(std::locale(text.getloc(), facet.release()));
-                    text << ptime;
-                    auto str = text.str();
-
-                    return str;
-                }();
-                tx["amount"] = event.ConfirmedAmount_str();
-                events.emplace_back(std::move(tx));
-            }
+        if (false == ndjson) {
+            out.begin_object();
+            out.key("command").string(translate(data.command_));
 
-            out.emplace("transactions", std::move(events));
-        } else {
-            out["error"] = translate(result);
+            if (false == single) { out.key("accounts").begin_array(); }
         }
 
-        return serialize(out);
-    }
-    auto list_accounts(const Options& data) noexcept -> std::string
-    {
-        auto out = json::object{};
-        auto balances = json::array{};
-        out["command"] = translate(data.command_);
-        auto error = std::string{};
-
-        try {
-            auto ids = [&] {
-                auto val = json::array{};
-                const auto request = ot::rpc::request::ListAccounts{session_};
-                auto base = std::unique_ptr<ot::rpc::response::Base>{};
-                const auto result = send(request, base);
-
-                if (Result::success == result) {
-                    const auto& reply = base->asListAccounts();
-
-                    for (const auto& id : reply.AccountIDs()) {
-                        val.emplace_back(id);
-                    }
-                } else {
-                    error = translate(result);
+        fill();
 
-                    throw std::runtime_error{""};
-                }
+        while (false == window.empty()) {
+            auto page = window.front().get();
+            window.pop_front();
+            fill();
 
-                return val;
-            }();
-
-            auto accounts = [&] {
-                auto arg = ot::rpc::request::Base::Identifiers{};
-                std::transform(
-                    ids.begin(),
-                    ids.end(),
-                    std::back_inserter(arg),
-                    [](const auto& val) { return val.as_string().c_str(); });
-
-                return arg;
-            }();
-            const auto request = ot::rpc::request::GetAccountBalance{
-                session_, std::move(accounts)};
-            auto base = std::unique_ptr<ot::rpc::response::Base>{};
-            const auto result = send(request, base);
-
-            if (Result::success == result) {
-                const auto& reply = base->asGetAccountBalance();
-
-                for (const auto& balance : reply.Balances()) {
-                    auto account = json::object{};
-                    account["id"] = balance.ID();
-                    account["style"] = ot::print(balance.Type());
-                    account["name"] = balance.Name();
-                    account["owner"] = balance.Owner();
-                    account["issuer"] = balance.Issuer();
-                    account["contract"] = balance.Unit();
-                    account["confirmed"] = balance.ConfirmedBalance_str();
-                    account["pending"] = balance.PendingBalance_str();
-                    // TODO account type
-                    balances.emplace_back(std::move(account));
-                }
+            if (ndjson) {
+                page_records(page, paged, out);
+            } else if (single) {
+                account_activity(page, paged, out);
             } else {
-                error = translate(result);
-
-                throw std::runtime_error{""};
+                out.begin_object();
+                account_activity(page, paged, out);
+                out.end_object();
             }
-        } catch (...) {
-            out["error"] = std::move(error);
         }
 
-        out.emplace("accounts", std::move(balances));
+        if (false == ndjson) {
+            if (false == single) { out.end_array(); }
 
-        return serialize(out);
+            out.end_object();
+            out.finish();
+        }
     }
-    auto list_nyms(const Options& data) noexcept -> std::string
+    auto invalid(Writer& out) const noexcept -> void
     {
-        const auto request = ot::rpc::request::ListNyms{session_};
-        auto base = std::unique_ptr<ot::rpc::response::Base>{};
+        auto error = json::object{};
+        error["error"] = "invalid command";
+        emit(error, {}, out);
+    }
+    auto list_accounts(const Options& data, Writer& writer) noexcept -> void
+    {
+        const auto reply = client_.accounts().get();
         auto out = json::object{};
         out["command"] = translate(data.command_);
-        const auto result = send(request, base);
 
-        if (Result::success == result) {
-            const auto& reply = base->asListNyms();
-            auto nyms = json::array{};
-
-            for (const auto& id : reply.NymIDs()) { nyms.emplace_back(id); }
-
-            out.emplace("nyms", std::move(nyms));
-        } else {
-            out["error"] = translate(result);
+        if (false == reply.ok()) { out["error"] = reply.error_; }
+
+        auto accounts = json::array{};
+
+        for (const auto& account : reply.accounts_) {
+            auto item = json::object{};
+            item["id"] = account.id_;
+            item["style"] = account.style_;
+            item["name"] = account.name_;
+            item["owner"] = account.owner_;
+            item["issuer"] = account.issuer_;
+            item["contract"] = account.contract_;
+            item["confirmed"] = account.confirmed_;
+            item["pending"] = account.pending_;
+            accounts.emplace_back(std::move(item));
         }
 
-        return serialize(out);
+        out.emplace("accounts", std::move(accounts));
+        emit(out, "accounts", writer);
     }
-    auto send_payment(const Options& data) noexcept -> std::string
+    auto list_nyms(const Options& data, Writer& writer) noexcept -> void
     {
-        const auto request = ot::rpc::request::SendPayment{
-            session_, data.from_, data.to_, data.amount_};
-        auto base = std::unique_ptr<ot::rpc::response::Base>{};
+        const auto reply = client_.nyms().get();
         auto out = json::object{};
         out["command"] = translate(data.command_);
-        out["from"] = data.from_;
-        out["to"] = data.to_;
-        out["amount"] = data.amount_;
-        const auto result = send(request, base);
-
-        if (Result::success == result) {
-            const auto& reply = base->asSendPayment();
-            const auto& codes = reply.ResponseCodes();
-
-            if (0 < codes.size()) {
-                const auto& code = codes.front().second;
-                using Code = ot::rpc::ResponseCode;
-
-                switch (code) {
-                    case Code::txid: {
-                        out["txid"] = reply.Pending().front().second;
-                    } break;
-                    case Code::invalid:
-                    case Code::success:
-                    case Code::bad_session:
-                    case Code::none:
-                    case Code::queued:
-                    case Code::unnecessary:
-                    case Code::retry:
-                    case Code::no_path_to_recipient:
-                    case Code::bad_server_argument:
-                    case Code::cheque_not_found:
-                    case Code::payment_not_found:
-                    case Code::start_task_failed:
-                    case Code::nym_not_found:
-                    case Code::add_claim_failed:
-                    case Code::add_contact_failed:
-                    case Code::register_account_failed:
-                    case Code::bad_server_response:
-                    case Code::workflow_not_found:
-                    case Code::unit_definition_not_found:
-                    case Code::session_not_found:
-                    case Code::create_nym_failed:
-                    case Code::create_unit_definition_failed:
-                    case Code::delete_claim_failed:
-                    case Code::account_not_found:
-                    case Code::move_funds_failed:
-                    case Code::register_nym_failed:
-                    case Code::contact_not_found:
-                    case Code::account_owner_not_found:
-                    case Code::send_payment_failed:
-                    case Code::transaction_failed:
-                    case Code::unimplemented:
-                    case Code::error:
-                    default: {
-                        out["error"] = ot::print(code).c_str();
-                    }
-                }
-            } else {
-                out["error"] = "Invalid rpc response";
-            }
+
+        if (reply.ok()) {
+            auto nyms = json::array{};
+
+            for (const auto& id : reply.nyms_) { nyms.emplace_back(id); }
+
+            out.emplace("nyms", std::move(nyms));
         } else {
-            out["error"] = translate(result);
+            out["error"] = reply.error_;
         }
 
-        return serialize(out);
+        emit(out, "nyms", writer);
     }
-
-    Imp() noexcept
-        : endpoint_(metier::rpc_endpoint())
-        , linger_(0)
-        , zmq_(::zmq_ctx_new(), &::zmq_ctx_shutdown)
-        , socket_(::zmq_socket(zmq_.get(), ZMQ_REQ), &::zmq_close)
-        , ready_(0 == ::zmq_connect(socket_.get(), endpoint_.c_str()))
+    // NOTE at most concurrency_ payments are in flight at any time. Results
+    // are reported in file order as soon as each payment completes. A payment
+    // whose reply timed out is reported as unknown since the server may still
+    // execute it, so it must not be retried as if it had failed.
+    auto send_batch(const Options& data, Writer& out) noexcept -> void
     {
-        ::zmq_setsockopt(socket_.get(), ZMQ_LINGER, &linger_, sizeof(linger_));
-    }
-
-    ~Imp()
-    {
-        if (socket_) { ::zmq_disconnect(socket_.get(), endpoint_.c_str()); }
-    }
+        const auto list = load_payments(data.file_);
 
-private:
-    struct Frame {
-        operator ::zmq_msg_t*() noexcept { return &zmq_; }
+        if (false == list.error_.empty()) {
+            auto error = json::object{};
+            error["command"] = translate(data.command_);
+            error["file"] = data.file_;
+            error["error"] = list.error_;
+            emit(error, {}, out);
 
-        Frame() noexcept
-            : zmq_()
-        {
-        }
-        Frame(const Frame& rhs) noexcept
-            : zmq_()
-        {
-            const auto size = ::zmq_msg_size(&rhs.zmq_);
-            ::zmq_msg_init_size(&zmq_, size);
-            std::memcpy(
-                ::zmq_msg_data(&zmq_),
-                ::zmq_msg_data(const_cast<::zmq_msg_t*>(&rhs.zmq_)),
-                size);
+            return;
         }
 
-        ~Frame() { ::zmq_msg_close(*this); }
+        const auto ndjson = (Format::ndjson == out.format());
+        const auto& payments = list.payments_;
+        auto window = std::deque<std::future<client::PaymentReply>>{};
+        auto reported = std::size_t{0};
+        const auto limit = data.concurrency_.value_or(payment_window_);
+        auto sent = std::size_t{0};
+        auto failed = std::size_t{0};
+        auto unknown = std::size_t{0};
+        const auto report = [&] {
+            const auto& payment = payments.at(reported++);
+            const auto reply = window.front().get();
+            window.pop_front();
+            auto record = json::object{};
+            record["from"] = payment.from_;
+            record["to"] = payment.to_;
+            record["amount"] = payment.amount_;
+            record["status"] = status(reply);
+
+            if (reply.ok()) {
+                record["txid"] = reply.txid_;
+                ++sent;
+            } else if (client::Result::receive_timeout == reply.result_) {
+                ++unknown;
+            } else {
+                record["error"] = reply.error_;
+                ++failed;
+            }
 
-    private:
-        ::zmq_msg_t zmq_;
-    };
+            if (ndjson) {
+                out.line(record);
+            } else {
+                out.value(record);
+            }
+        };
 
-    using Context = std::unique_ptr<void, decltype(&::zmq_ctx_shutdown)>;
-    using Message = std::vector<Frame>;
-    using Socket = std::unique_ptr<void, decltype(&::zmq_close)>;
+        if (false == ndjson) {
+            out.begin_object();
+            out.key("command").string(translate(data.command_));
+            out.key("file").string(data.file_);
+            out.key("payments").begin_array();
+        }
 
-    static constexpr auto session_{0};
+        for (const auto& payment : payments) {
+            if (window.size() >= limit) { report(); }
 
-    Context zmq_;
-    Socket socket_;
-    bool ready_;
+            window.emplace_back(client_.send_payment(payment));
+        }
 
-    static auto add_frame(Message& message, std::size_t bytes = 0u) noexcept
-        -> Frame&
-    {
-        auto& out = message.emplace_back();
+        while (false == window.empty()) { report(); }
 
-        if (0u == bytes) {
-            ::zmq_msg_init(out);
+        if (ndjson) {
+            auto summary = json::object{};
+            summary["command"] = translate(data.command_);
+            summary["sent"] = sent;
+            summary["failed"] = failed;
+            summary["unknown"] = unknown;
+            out.line(summary);
         } else {
-            ::zmq_msg_init_size(out, bytes);
+            out.end_array();
+            out.key("sent").value(sent);
+            out.key("failed").value(failed);
+            out.key("unknown").value(unknown);
+            out.end_object();
+            out.finish();
         }
-
-        return out;
     }
-    static auto pretty_print(
-        const json::value& json,
-        std::ostream& out,
-        std::string* indent = nullptr) noexcept -> void
+    auto send_payment(const Options& data, Writer& writer) noexcept -> void
     {
-        auto indent_ = std::string{};
-
-        if (nullptr == indent) { indent = &indent_; }
-
-        switch (json.kind()) {
-            case json::kind::object: {
-                out << "{\n";
-                indent->append(4, ' ');
-                const auto& obj = json.get_object();
-
-                if (!obj.empty()) {
-                    auto it = obj.begin();
-
-                    for (;;) {
-                        out << *indent << json::serialize(it->key()) << " : ";
-                        pretty_print(it->value(), out, indent);
-
-                        if (++it == obj.end()) { break; }
-
-                        out << ",\n";
-                    }
-                }
-
-                out << "\n";
-                indent->resize(indent->size() - 4);
-                out << *indent << "}";
-
-            } break;
-            case json::kind::array: {
-                out << "[\n";
-                indent->append(4, ' ');
-                auto const& arr = json.get_array();
-
-                if (!arr.empty()) {
-                    auto it = arr.begin();
+        const auto reply =
+            client_.send_payment({data.from_, data.to_, data.amount_}).get();
+        auto out = json::object{};
+        out["command"] = translate(data.command_);
+        out["from"] = data.from_;
+        out["to"] = data.to_;
+        out["amount"] = data.amount_;
+        out["status"] = status(reply);
 
-                    for (;;) {
-                        out << *indent;
-                        pretty_print(*it, out, indent);
+        if (reply.ok()) {
+            out["txid"] = reply.txid_;
+        } else if (client::Result::receive_timeout != reply.result_) {
+            out["error"] = reply.error_;
+        }
 
-                        if (++it == arr.end()) { break; }
+        emit(out, {}, writer);
+    }
+    // NOTE runs until the process is interrupted or the event socket fails
+    auto watch(const Options& data, Writer& out) noexcept -> void
+    {
+        const auto result =
+            client_.watch(data.events_, [&](const client::Event& event) {
+                auto record = json::object{};
+                record["event"] = event.name_;
 
-                        out << ",\n";
-                    }
+                for (const auto& item : event.data_) {
+                    record.emplace(item.key(), item.value());
                 }
 
-                out << "\n";
-                indent->resize(indent->size() - 4);
-                out << *indent << "]";
-            } break;
-            case json::kind::string: {
-                out << json::serialize(json.get_string());
-
-            } break;
-
-            case json::kind::uint64: {
-                out << json.get_uint64();
-            } break;
-            case json::kind::int64: {
-                out << json.get_int64();
-            } break;
-            case json::kind::double_: {
-                out << json.get_double();
-            } break;
-            case json::kind::bool_: {
-                if (json.get_bool()) {
-                    out << "true";
+                if (Format::pretty == out.format()) {
+                    out.value(record);
+                    out.finish();
                 } else {
-                    out << "false";
+                    out.line(record);
                 }
-            } break;
-            case json::kind::null: {
-                out << "null";
-            } break;
-            default: {
-            }
-        }
-
-        if (indent->empty()) { out << "\n"; }
-    }
 
-    auto serialize(const json::value& json) const noexcept -> std::string
-    {
-        auto out = std::stringstream{};
-        pretty_print(json, out);
+                out.flush();
 
-        return out.str();
+                return true;
+            });
+        auto error = json::object{};
+        error["command"] = translate(data.command_);
+        error["error"] = client::translate(result);
+        emit(error, {}, out);
     }
-    auto wait() const noexcept -> bool
-    {
-        auto poll = std::array<zmq_pollitem_t, 1>{};
-        poll[0].socket = socket_.get();
-        poll[0].events = ZMQ_POLLIN;
-        static constexpr auto timeout =
-            std::chrono::milliseconds{std::chrono::seconds{10}};
-        const auto events = ::zmq_poll(poll.data(), 1, timeout.count());
-
-        if (0 >= events) { return false; }
 
-        return true;
+    Imp() noexcept
+        : client_()
+        , time_()
+    {
+        time_.imbue(std::locale(
+            time_.getloc(),
+            std::make_unique<ptime::time_facet>("%a %b %d %l:%M:%S %p %Y")
+                .release()));
     }
 
-    auto receive(Message& out) noexcept -> bool
+private:
+    static constexpr auto account_window_ = std::size_t{8};
+    // NOTE matches the server's default --rpc-write-limit
+    static constexpr auto payment_window_ = std::size_t{1};
+
+    const client::Client client_;
+    std::stringstream time_;
+
+    // NOTE each event is written as soon as it is converted so no json
+    // representation of the complete history is ever constructed
+    auto account_activity(
+        const client::ActivityPage& page,
+        const bool paged,
+        Writer& out) noexcept -> void
     {
-        auto receiving{true};
+        out.key("account").string(page.account_);
 
-        while (receiving) {
-            auto& frame = add_frame(out);
-            const bool received =
-                (-1 != ::zmq_msg_recv(frame, socket_.get(), ZMQ_DONTWAIT));
+        if (false == page.ok()) {
+            out.key("error").string(page.error_);
 
-            if (false == received) { return false; }
+            return;
+        }
 
-            auto option = int{0};
-            auto optionBytes{sizeof(option)};
-            const bool haveOption =
-                (-1 != ::zmq_getsockopt(
-                           socket_.get(), ZMQ_RCVMORE, &option, &optionBytes));
+        out.key("transactions").begin_array();
 
-            if (false == haveOption) { return false; }
+        for (const auto& tx : page.transactions_) {
+            out.begin_object();
+            out.key("id").string(tx.id_);
+            out.key("time").string(timestamp(tx.timestamp_));
+            out.key("timestamp").value(tx.timestamp_);
+            out.key("amount").string(tx.amount_);
+            out.end_object();
+        }
 
-            if (optionBytes != sizeof(option)) { return false; }
+        out.end_array();
 
-            if (1 != option) { receiving = false; }
+        if (paged) {
+            out.key("cursor").string(page.cursor_);
+            out.key("more").value(page.more_);
         }
-
-        return true;
     }
-    template <typename Reply>
-    auto send(const ot::rpc::request::Base& in, Reply& out) noexcept -> Result
+    // NOTE in ndjson mode every element of the named array is written as a
+    // separate record unless the result is an error
+    auto emit(
+        const json::object& in,
+        const std::string_view array,
+        Writer& out) const noexcept -> void
     {
-        if (false == ready_) { return Result::socket_not_ready; }
+        if (Format::ndjson != out.format()) {
+            out.value(in);
+            out.finish();
+
+            return;
+        }
 
-        auto request = Message{};
-        auto reply = Message{};
-        in.Serialize([&](const auto bytes) -> ot::WritableView {
-            auto& frame = add_frame(request, bytes);
+        const auto* items = array.empty() ? nullptr : in.if_contains(array);
 
-            return {::zmq_msg_data(frame), ::zmq_msg_size(frame)};
-        });
+        if ((nullptr == items) || (nullptr != in.if_contains("error")) ||
+            (false == items->is_array())) {
+            out.line(in);
 
-        if (false == send(request)) { return Result::send_error; }
+            return;
+        }
 
-        if (false == wait()) { return Result::receive_timeout; }
+        for (const auto& item : items->get_array()) { out.line(item); }
+    }
+    auto page_records(
+        const client::ActivityPage& page,
+        const bool paged,
+        Writer& out) noexcept -> void
+    {
+        auto line = json::object{};
+        line["account"] = page.account_;
 
-        if (false == receive(reply)) { return Result::receive_error; }
+        if (false == page.ok()) {
+            line["error"] = page.error_;
+            out.line(line);
 
-        if (0 == reply.size()) { return Result::receive_error; }
+            return;
+        }
 
-        auto& frame = reply.front();
-        out = ot::rpc::response::Factory(
-            {static_cast<char*>(::zmq_msg_data(frame)), ::zmq_msg_size(frame)});
+        for (const auto& tx : page.transactions_) {
+            auto record = json::object{};
+            record["account"] = page.account_;
+            record["id"] = tx.id_;
+            record["time"] = timestamp(tx.timestamp_);
+            record["timestamp"] = tx.timestamp_;
+            record["amount"] = tx.amount_;
+            out.line(record);
+        }
 
-        return Result::success;
+        // NOTE the final record of each account carries the cursor for the
+        // next query
+        if (paged) {
+            line["cursor"] = page.cursor_;
+            line["more"] = page.more_;
+            out.line(line);
+        }
     }
-    auto send(Message& message) noexcept -> bool
+    // NOTE a payment is only failed if the server rejected it or it was never
+    // sent. Without a reply the server may still execute it.
+    static auto status(const client::PaymentReply& reply) noexcept
+        -> std::string
     {
-        const auto parts = message.size();
-        auto sent{true};
-        auto counter = std::size_t{0};
-
-        for (auto& frame : message) {
-            auto flags = int{0};
+        if (reply.ok()) { return "sent"; }
 
-            if (++counter < parts) { flags |= ZMQ_SNDMORE; }
-
-            sent |= (-1 != ::zmq_msg_send(frame, socket_.get(), flags));
+        if (client::Result::receive_timeout == reply.result_) {
+            return "unknown";
         }
 
-        return sent;
+        return "failed";
+    }
+    auto timestamp(const std::int64_t time) noexcept -> std::string
+    {
+        time_.str({});
+        time_.clear();
+        time_ << ptime::from_time_t(static_cast<std::time_t>(time));
+
+        return time_.str();
     }
 };
 
@@ -499,29 +403,33 @@ Processor::Processor() noexcept
 {
 }
 
-auto Processor::process(const Options& data) noexcept -> std::string
+auto Processor::process(const Options& data, std::ostream& out) noexcept
+    -> void
 {
+    auto writer = Writer{out, data.format_};
+
     switch (data.command_) {
         case Command::list_accounts: {
-
-            return imp_->list_accounts(data);
-        }
+            imp_->list_accounts(data, writer);
+        } break;
         case Command::list_nyms: {
-
-            return imp_->list_nyms(data);
-        }
+            imp_->list_nyms(data, writer);
+        } break;
+        case Command::send_batch: {
+            imp_->send_batch(data, writer);
+        } break;
         case Command::send_payment: {
-
-            return imp_->send_payment(data);
-        }
+            imp_->send_payment(data, writer);
+        } break;
         case Command::show_account: {
-
-            return imp_->get_account_activity(data);
-        }
+            imp_->get_account_activity(data, writer);
+        } break;
+        case Command::watch: {
+            imp_->watch(data, writer);
+        } break;
         case Command::error:
         default: {
-
-            return {};
+            imp_->invalid(writer);
         }
     }
 }
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <memory>
 #include <string>
 
@@ -18,22 +19,12 @@ struct Options;
 
 namespace metier::cli
 {
-enum class Result {
-    success,
-    socket_not_ready,
-    send_error,
-    receive_timeout,
-    receive_error,
-};
-
-auto translate(Result) noexcept -> std::string;
-
 class Processor
 {
 public:
     auto value() const noexcept -> int;
 
-    auto process(const Options& data) noexcept -> std::string;
+    auto process(const Options& data, std::ostream& out) noexcept -> void;
 
     Processor() noexcept;
     ~Processor();
@@ -0,0 +1,213 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "cli/writer.hpp"  // IWYU pragma: associated
+
+#include <boost/json.hpp>
+#include <ostream>
+
+namespace json = boost::json;
+
+namespace metier::cli
+{
+auto pretty_print(
+    const json::value& json,
+    std::ostream& out,
+    std::string& indent) noexcept -> void;
+auto pretty_print(
+    const json::value& json,
+    std::ostream& out,
+    std::string& indent) noexcept -> void
+{
+    switch (json.kind()) {
+        case json::kind::object: {
+            out << "{\n";
+            indent.append(4, ' ');
+            const auto& obj = json.get_object();
+
+            if (!obj.empty()) {
+                auto it = obj.begin();
+
+                for (;;) {
+                    out << indent << json::serialize(it->key()) << " : ";
+                    pretty_print(it->value(), out, indent);
+
+                    if (++it == obj.end()) { break; }
+
+                    out << ",\n";
+                }
+            }
+
+            out << "\n";
+            indent.resize(indent.size() - 4);
+            out << indent << "}";
+
+        } break;
+        case json::kind::array: {
+            out << "[\n";
+            indent.append(4, ' ');
+            auto const& arr = json.get_array();
+
+            if (!arr.empty()) {
+                auto it = arr.begin();
+
+                for (;;) {
+                    out << indent;
+                    pretty_print(*it, out, indent);
+
+                    if (++it == arr.end()) { break; }
+
+                    out << ",\n";
+                }
+            }
+
+            out << "\n";
+            indent.resize(indent.size() - 4);
+            out << indent << "]";
+        } break;
+        case json::kind::string: {
+            out << json::serialize(json.get_string());
+
+        } break;
+
+        case json::kind::uint64: {
+            out << json.get_uint64();
+        } break;
+        case json::kind::int64: {
+            out << json.get_int64();
+        } break;
+        case json::kind::double_: {
+            out << json.get_double();
+        } break;
+        case json::kind::bool_: {
+            if (json.get_bool()) {
+                out << "true";
+            } else {
+                out << "false";
+            }
+        } break;
+        case json::kind::null: {
+            out << "null";
+        } break;
+        default: {
+        }
+    }
+}
+
+Writer::Writer(std::ostream& out, const Format format) noexcept
+    : out_(out)
+    , format_(format)
+    , pretty_(Format::pretty == format_)
+    , indent_()
+    , scope_()
+    , have_key_(false)
+{
+}
+
+auto Writer::begin_array() noexcept -> Writer& { return open(false, '['); }
+
+auto Writer::begin_object() noexcept -> Writer& { return open(true, '{'); }
+
+auto Writer::close(const char symbol) noexcept -> Writer&
+{
+    if (scope_.empty()) { return *this; }
+
+    scope_.pop_back();
+
+    if (pretty_) {
+        indent_.resize(indent_.size() - 4);
+        out_ << '\n' << indent_;
+    }
+
+    out_ << symbol;
+
+    return *this;
+}
+
+auto Writer::end_array() noexcept -> Writer& { return close(']'); }
+
+auto Writer::end_object() noexcept -> Writer& { return close('}'); }
+
+auto Writer::finish() noexcept -> void
+{
+    while (false == scope_.empty()) {
+        close(scope_.back().object_ ? '}' : ']');
+    }
+
+    out_ << '\n';
+}
+
+auto Writer::flush() noexcept -> void { out_.flush(); }
+
+auto Writer::key(const std::string_view name) noexcept -> Writer&
+{
+    prefix();
+    out_ << json::serialize(name) << (pretty_ ? " : " : ":");
+    have_key_ = true;
+
+    return *this;
+}
+
+auto Writer::line(const json::value& value) noexcept -> void
+{
+    out_ << json::serialize(value) << '\n';
+}
+
+auto Writer::open(const bool object, const char symbol) noexcept -> Writer&
+{
+    prefix();
+    out_ << symbol;
+    scope_.push_back({object, true});
+
+    if (pretty_) {
+        out_ << '\n';
+        indent_.append(4, ' ');
+    }
+
+    return *this;
+}
+
+// NOTE emits the separator and indentation which precede the next array
+// element or object key. A value which follows a key needs neither.
+auto Writer::prefix() noexcept -> void
+{
+    if (have_key_) {
+        have_key_ = false;
+
+        return;
+    }
+
+    if (scope_.empty()) { return; }
+
+    auto& scope = scope_.back();
+
+    if (false == scope.empty_) { out_ << (pretty_ ? ",\n" : ","); }
+
+    scope.empty_ = false;
+
+    if (pretty_) { out_ << indent_; }
+}
+
+auto Writer::string(const std::string_view value) noexcept -> Writer&
+{
+    prefix();
+    out_ << json::serialize(value);
+
+    return *this;
+}
+
+auto Writer::value(const json::value& value) noexcept -> Writer&
+{
+    prefix();
+
+    if (pretty_) {
+        pretty_print(value, out_, indent_);
+    } else {
+        out_ << json::serialize(value);
+    }
+
+    return *this;
+}
+}  // namespace metier::cli
@@ -0,0 +1,64 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/json.hpp>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cli/parser.hpp"
+
+namespace metier::cli
+{
+// NOTE writes json incrementally so output size does not determine memory
+// usage. In ndjson mode documents are not nested: each call to line() emits
+// one complete compact value followed by a newline.
+class Writer
+{
+public:
+    auto format() const noexcept -> Format { return format_; }
+
+    auto begin_array() noexcept -> Writer&;
+    auto begin_object() noexcept -> Writer&;
+    auto end_array() noexcept -> Writer&;
+    auto end_object() noexcept -> Writer&;
+    auto finish() noexcept -> void;
+    auto flush() noexcept -> void;
+    auto key(const std::string_view name) noexcept -> Writer&;
+    auto line(const boost::json::value& value) noexcept -> void;
+    auto string(const std::string_view value) noexcept -> Writer&;
+    auto value(const boost::json::value& value) noexcept -> Writer&;
+
+    Writer(std::ostream& out, const Format format) noexcept;
+
+    ~Writer() = default;
+
+private:
+    struct Scope {
+        bool object_;
+        bool empty_;
+    };
+
+    std::ostream& out_;
+    const Format format_;
+    const bool pretty_;
+    std::string indent_;
+    std::vector<Scope> scope_;
+    bool have_key_;
+
+    auto close(const char symbol) noexcept -> Writer&;
+    auto open(const bool object, const char symbol) noexcept -> Writer&;
+    auto prefix() noexcept -> void;
+
+    Writer() = delete;
+    Writer(const Writer&) = delete;
+    Writer(Writer&&) = delete;
+    auto operator=(const Writer&) -> Writer& = delete;
+    auto operator=(Writer&&) -> Writer& = delete;
+};
+}  // namespace metier::cli
@@ -0,0 +1,686 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "client/client.hpp"  // IWYU pragma: associated
+
+#include <boost/container/flat_map.hpp>
+#include <boost/json.hpp>
+#include <zmq.h>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "rpc/protocol.hpp"
+#include "rpc/rpc.hpp"
+
+namespace json = boost::json;
+
+namespace metier::client
+{
+auto translate(Result code) noexcept -> std::string
+{
+    static const auto map = boost::container::flat_map<Result, std::string>{
+        {Result::success, "success"},
+        {Result::socket_not_ready, "rpc socket error"},
+        {Result::send_error, "rpc send error"},
+        {Result::receive_timeout, "rpc server timeout"},
+        {Result::receive_error, "rpc receive error"},
+        {Result::server_busy, "rpc server busy"},
+        {Result::server_error, "rpc server error"},
+    };
+
+    try {
+
+        return map.at(code);
+    } catch (...) {
+
+        return "unknown error";
+    }
+}
+
+struct Client::Imp {
+    using Body = std::vector<std::string>;
+    using Clock = std::chrono::steady_clock;
+    using CorrelationID = std::uint64_t;
+    using Frames = std::vector<std::string>;
+    using Lock = std::lock_guard<std::mutex>;
+    using Raw = std::pair<Result, std::string>;
+    using Callback = std::function<void(Raw&&)>;
+    using Socket = std::unique_ptr<void, decltype(&::zmq_close)>;
+
+    auto accounts() const noexcept -> std::future<AccountList>
+    {
+        auto params = json::object{};
+        params[rpc::param_session_] = config_.session_;
+
+        return request<AccountList>(
+            rpc::method_accounts_, params, config_.timeout_, [](Reply&& in) {
+                auto out = AccountList{};
+                static_cast<Status&>(out) = in;
+
+                if (false == out.ok()) { return out; }
+
+                try {
+                    const auto& accounts = in.data_.at("accounts").as_array();
+
+                    for (const auto& value : accounts) {
+                        const auto& item = value.as_object();
+                        auto& account = out.accounts_.emplace_back();
+                        account.id_ = text(item, "id");
+                        account.style_ = text(item, "style");
+                        account.name_ = text(item, "name");
+                        account.owner_ = text(item, "owner");
+                        account.issuer_ = text(item, "issuer");
+                        account.contract_ = text(item, "contract");
+                        account.confirmed_ = text(item, "confirmed");
+                        account.pending_ = text(item, "pending");
+                    }
+                } catch (...) {
+                    invalid(out);
+                }
+
+                return out;
+            });
+    }
+    auto activity(const ActivityQuery& query) const noexcept
+        -> std::future<ActivityPage>
+    {
+        auto params = json::object{};
+        params[rpc::param_session_] = config_.session_;
+        params[rpc::param_account_] = query.account_;
+
+        if (0u < query.limit_) { params[rpc::param_limit_] = query.limit_; }
+
+        if (query.since_.has_value()) {
+            params[rpc::param_since_] = query.since_.value();
+        }
+
+        if (false == query.cursor_.empty()) {
+            params[rpc::param_cursor_] = query.cursor_;
+        }
+
+        return request<ActivityPage>(
+            rpc::method_activity_,
+            params,
+            config_.timeout_,
+            [account = query.account_](Reply&& in) {
+                auto out = ActivityPage{};
+                static_cast<Status&>(out) = in;
+                out.account_ = account;
+
+                if (false == out.ok()) { return out; }
+
+                try {
+                    const auto& txs = in.data_.at("transactions").as_array();
+                    out.transactions_.reserve(txs.size());
+
+                    for (const auto& value : txs) {
+                        const auto& item = value.as_object();
+                        auto& tx = out.transactions_.emplace_back();
+                        tx.id_ = text(item, "id");
+                        tx.timestamp_ =
+                            item.at("timestamp").to_number<std::int64_t>();
+                        tx.amount_ = text(item, "amount");
+                    }
+
+                    out.cursor_ = text(in.data_, rpc::param_cursor_);
+                    out.more_ = in.data_.at("more").as_bool();
+                } catch (...) {
+                    invalid(out);
+                }
+
+                return out;
+            });
+    }
+    auto call(const std::string_view method, const json::object& params)
+        const noexcept -> std::future<Reply>
+    {
+        return request<Reply>(
+            method, params, config_.timeout_, [](Reply&& in) {
+                return std::move(in);
+            });
+    }
+    auto nyms() const noexcept -> std::future<NymList>
+    {
+        auto params = json::object{};
+        params[rpc::param_session_] = config_.session_;
+
+        return request<NymList>(
+            rpc::method_nyms_, params, config_.timeout_, [](Reply&& in) {
+                auto out = NymList{};
+                static_cast<Status&>(out) = in;
+
+                if (false == out.ok()) { return out; }
+
+                try {
+                    for (const auto& id : in.data_.at("nyms").as_array()) {
+                        out.nyms_.emplace_back(id.as_string());
+                    }
+                } catch (...) {
+                    invalid(out);
+                }
+
+                return out;
+            });
+    }
+    // NOTE a payment may wait in the server's write queue behind other
+    // payments before it starts, so its reply is waited for much longer than
+    // the reply to a query
+    auto send_payment(const Payment& payment) const noexcept
+        -> std::future<PaymentReply>
+    {
+        auto params = json::object{};
+        params[rpc::param_session_] = config_.session_;
+        params[rpc::param_from_] = payment.from_;
+        params[rpc::param_to_] = payment.to_;
+        params[rpc::param_amount_] = payment.amount_;
+
+        return request<PaymentReply>(
+            rpc::method_send_payment_,
+            params,
+            config_.send_timeout_,
+            [](Reply&& in) {
+                auto out = PaymentReply{};
+                static_cast<Status&>(out) = in;
+
+                if (false == out.ok()) { return out; }
+
+                try {
+                    out.txid_ = text(in.data_, "txid");
+                } catch (...) {
+                    invalid(out);
+                }
+
+                return out;
+            });
+    }
+    auto transactions(const std::string& account) const noexcept
+        -> std::future<ActivityPage>
+    {
+        auto query = ActivityQuery{};
+        query.account_ = account;
+
+        return activity(query);
+    }
+    auto watch(
+        const std::vector<std::string>& events,
+        const EventCallback& callback) const noexcept -> Result
+    {
+        auto socket =
+            Socket{::zmq_socket(context_.get(), ZMQ_SUB), &::zmq_close};
+        const auto& endpoint = config_.event_endpoint_;
+
+        if ((!socket) ||
+            (0 != ::zmq_connect(socket.get(), endpoint.c_str()))) {
+
+            return Result::socket_not_ready;
+        }
+
+        ::zmq_setsockopt(socket.get(), ZMQ_LINGER, &linger_, sizeof(linger_));
+
+        if (events.empty()) {
+            ::zmq_setsockopt(socket.get(), ZMQ_SUBSCRIBE, nullptr, 0);
+        } else {
+            for (const auto& event : events) {
+                ::zmq_setsockopt(
+                    socket.get(), ZMQ_SUBSCRIBE, event.data(), event.size());
+            }
+        }
+
+        for (;;) {
+            auto message = Frames{};
+
+            if (false == receive(socket.get(), 0, message)) {
+
+                return Result::receive_error;
+            }
+
+            if (2u != message.size()) { continue; }
+
+            auto event = Event{};
+            event.name_ = std::move(message.at(0));
+
+            try {
+                event.data_ = json::parse(message.at(1)).as_object();
+            } catch (...) {
+
+                continue;
+            }
+
+            if (false == callback(event)) { return Result::success; }
+        }
+    }
+
+    Imp(const Config& config) noexcept
+        : config_([&] {
+            auto out = config;
+
+            if (out.endpoint_.empty()) { out.endpoint_ = rpc_endpoint(); }
+
+            if (out.event_endpoint_.empty()) {
+                out.event_endpoint_ = rpc_event_endpoint();
+            }
+
+            return out;
+        }())
+        , internal_(
+              "inproc://metier/client/" +
+              std::to_string(reinterpret_cast<std::uintptr_t>(this)))
+        , linger_(0)
+        , context_(::zmq_ctx_new(), &::zmq_ctx_term)
+        , dealer_(::zmq_socket(context_.get(), ZMQ_DEALER), &::zmq_close)
+        , pull_(::zmq_socket(context_.get(), ZMQ_PULL), &::zmq_close)
+        , push_(::zmq_socket(context_.get(), ZMQ_PUSH), &::zmq_close)
+        , push_lock_()
+        , lock_()
+        , counter_(0)
+        , pending_()
+        , ready_([&] {
+            for (auto* socket : {dealer_.get(), pull_.get(), push_.get()}) {
+                if (nullptr == socket) { return false; }
+
+                ::zmq_setsockopt(socket, ZMQ_LINGER, &linger_, sizeof(linger_));
+            }
+
+            if (0 != ::zmq_bind(pull_.get(), internal_.c_str())) {
+                return false;
+            }
+
+            if (0 != ::zmq_connect(push_.get(), internal_.c_str())) {
+                return false;
+            }
+
+            const auto& endpoint = config_.endpoint_;
+
+            return 0 == ::zmq_connect(dealer_.get(), endpoint.c_str());
+        }())
+        , thread_()
+    {
+        if (ready_) { thread_ = std::thread{[this] { run(); }}; }
+    }
+
+    ~Imp()
+    {
+        if (thread_.joinable()) {
+            {
+                // NOTE a message with a single empty frame stops the thread
+                auto lock = Lock{push_lock_};
+                ::zmq_send(push_.get(), nullptr, 0, 0);
+            }
+
+            thread_.join();
+        }
+
+        fail(Result::socket_not_ready);
+    }
+
+private:
+    struct Pending {
+        Callback callback_;
+        Clock::time_point expires_;
+    };
+
+    static constexpr auto interval_ = std::chrono::milliseconds{100};
+
+    const Config config_;
+    const std::string internal_;
+    const int linger_;
+    std::unique_ptr<void, decltype(&::zmq_ctx_term)> context_;
+    Socket dealer_;
+    Socket pull_;
+    Socket push_;
+    // NOTE serializes callers on push_. It is never held by thread_ so a
+    // caller blocked on a full inproc pipe can not stop replies from being
+    // processed.
+    mutable std::mutex push_lock_;
+    mutable std::mutex lock_;
+    mutable CorrelationID counter_;
+    mutable std::unordered_map<CorrelationID, Pending> pending_;
+    const bool ready_;
+    std::thread thread_;
+
+    static auto invalid(Status& out) noexcept -> void
+    {
+        out.result_ = Result::receive_error;
+        out.error_ = "invalid rpc response";
+    }
+    static auto reply(Raw&& in) noexcept -> Reply
+    {
+        auto out = Reply{};
+        out.result_ = in.first;
+
+        if (false == out.ok()) {
+            out.error_ = translate(out.result_);
+
+            return out;
+        }
+
+        try {
+            out.data_ = json::parse(in.second).as_object();
+        } catch (...) {
+            invalid(out);
+
+            return out;
+        }
+
+        if (const auto* error = out.data_.if_contains("error");
+            nullptr != error) {
+            out.result_ = Result::server_error;
+            out.error_ = error->is_string() ? std::string{error->get_string()}
+                                            : json::serialize(*error);
+        }
+
+        return out;
+    }
+    static auto receive(void* socket, const int flags, Frames& out) noexcept
+        -> bool
+    {
+        auto more{true};
+
+        while (more) {
+            auto message = ::zmq_msg_t{};
+            ::zmq_msg_init(&message);
+
+            if (-1 == ::zmq_msg_recv(&message, socket, flags)) {
+                ::zmq_msg_close(&message);
+
+                return false;
+            }
+
+            out.emplace_back(
+                static_cast<const char*>(::zmq_msg_data(&message)),
+                ::zmq_msg_size(&message));
+            more = (0 != ::zmq_msg_more(&message));
+            ::zmq_msg_close(&message);
+        }
+
+        return true;
+    }
+    static auto send(void* socket, const Frames& frames) noexcept -> bool
+    {
+        auto sent{true};
+        const auto count = frames.size();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& frame = frames.at(i);
+            const auto flags = (i + 1u < count) ? ZMQ_SNDMORE : 0;
+            sent &=
+                (-1 != ::zmq_send(socket, frame.data(), frame.size(), flags));
+        }
+
+        return sent;
+    }
+    static auto text(const json::object& in, const std::string_view key)
+        noexcept(false) -> std::string
+    {
+        return std::string{in.at(key).as_string()};
+    }
+
+    // NOTE callbacks are always invoked without lock_ held
+    auto complete(const CorrelationID id, Raw&& reply) const noexcept -> void
+    {
+        if (auto callback = release(id); callback) {
+            callback(std::move(reply));
+        }
+    }
+    auto expire() const noexcept -> void
+    {
+        const auto now = Clock::now();
+        auto expired = std::vector<Callback>{};
+
+        {
+            auto lock = Lock{lock_};
+
+            for (auto it = pending_.begin(); it != pending_.end();) {
+                if (it->second.expires_ < now) {
+                    expired.emplace_back(std::move(it->second.callback_));
+                    it = pending_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& callback : expired) {
+            callback({Result::receive_timeout, {}});
+        }
+    }
+    auto fail(const Result code) const noexcept -> void
+    {
+        auto failed = decltype(pending_){};
+
+        {
+            auto lock = Lock{lock_};
+            failed.swap(pending_);
+        }
+
+        for (auto& [id, pending] : failed) { pending.callback_({code, {}}); }
+    }
+    static auto id(const Frames& message) noexcept
+        -> std::optional<CorrelationID>
+    {
+        if (message.empty()) { return std::nullopt; }
+
+        const auto& header = message.front();
+
+        if (sizeof(CorrelationID) != header.size()) { return std::nullopt; }
+
+        auto out = CorrelationID{};
+        std::memcpy(&out, header.data(), sizeof(out));
+
+        return out;
+    }
+    // NOTE replies to requests which previously timed out find nothing
+    auto release(const CorrelationID id) const noexcept -> Callback
+    {
+        auto lock = Lock{lock_};
+        const auto it = pending_.find(id);
+
+        if (pending_.end() == it) { return {}; }
+
+        auto out = std::move(it->second.callback_);
+        pending_.erase(it);
+
+        return out;
+    }
+    // NOTE parse runs on thread_ as soon as the reply arrives so the future
+    // becomes ready without any help from the thread which waits on it
+    template <typename Output, typename Function>
+    auto request(
+        const std::string_view method,
+        const json::object& params,
+        const std::chrono::milliseconds timeout,
+        Function&& parse) const noexcept -> std::future<Output>
+    {
+        auto promise = std::make_shared<std::promise<Output>>();
+        auto out = promise->get_future();
+        submit(
+            {std::string{method}, json::serialize(params)},
+            [promise, parse = std::forward<Function>(parse)](Raw&& in) {
+                try {
+                    promise->set_value(parse(reply(std::move(in))));
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            },
+            timeout);
+
+        return out;
+    }
+    // NOTE runs on thread_, which is the only user of dealer_ and pull_.
+    // Requests arrive from callers through the inproc socket and are
+    // forwarded to the rpc socket as [correlation id][delimiter][body]. The
+    // rpc router copies all frames preceding the delimiter into the reply so
+    // replies may be matched to their requests in any order.
+    auto run() noexcept -> void
+    {
+        auto poll = std::array<::zmq_pollitem_t, 2>{};
+        poll[0].socket = pull_.get();
+        poll[0].events = ZMQ_POLLIN;
+        poll[1].socket = dealer_.get();
+        poll[1].events = ZMQ_POLLIN;
+        auto next = Clock::now() + interval_;
+
+        for (;;) {
+            const auto events =
+                ::zmq_poll(poll.data(), poll.size(), interval_.count());
+
+            if ((0 > events) && (EINTR != ::zmq_errno())) { break; }
+
+            if (0 < events) {
+                for (;;) {
+                    auto message = Frames{};
+
+                    if (false == receive(pull_.get(), ZMQ_DONTWAIT, message)) {
+                        break;
+                    }
+
+                    if ((1u == message.size()) && message.front().empty()) {
+
+                        return;
+                    }
+
+                    if (false == send(dealer_.get(), message)) {
+                        if (const auto key = id(message); key.has_value()) {
+                            complete(key.value(), {Result::send_error, {}});
+                        }
+                    }
+                }
+
+                for (;;) {
+                    auto message = Frames{};
+
+                    if (false ==
+                        receive(dealer_.get(), ZMQ_DONTWAIT, message)) {
+                        break;
+                    }
+
+                    const auto key = id(message);
+
+                    if ((3u > message.size()) || (false == key.has_value())) {
+                        continue;
+                    }
+
+                    auto& payload = message.at(2);
+
+                    // NOTE an empty reply means the server is too busy
+                    if (payload.empty()) {
+                        complete(key.value(), {Result::server_busy, {}});
+                    } else {
+                        complete(
+                            key.value(), {Result::success, std::move(payload)});
+                    }
+                }
+            }
+
+            if (const auto now = Clock::now(); now >= next) {
+                expire();
+                next = now + interval_;
+            }
+        }
+    }
+    // NOTE the request is registered before it is sent so that lock_ is
+    // never held while the send blocks
+    auto submit(
+        Body&& body,
+        Callback&& callback,
+        const std::chrono::milliseconds timeout) const noexcept -> void
+    {
+        if (false == ready_) {
+            callback({Result::socket_not_ready, {}});
+
+            return;
+        }
+
+        const auto id = [&] {
+            auto lock = Lock{lock_};
+            const auto out = ++counter_;
+            pending_.emplace(
+                out,
+                Pending{std::move(callback), Clock::now() + timeout});
+
+            return out;
+        }();
+        auto message = Frames{};
+        message.reserve(body.size() + 2u);
+        message.emplace_back(reinterpret_cast<const char*>(&id), sizeof(id));
+        message.emplace_back();
+
+        for (auto& frame : body) { message.emplace_back(std::move(frame)); }
+
+        const auto sent = [&] {
+            auto lock = Lock{push_lock_};
+
+            return send(push_.get(), message);
+        }();
+
+        if (false == sent) { complete(id, {Result::send_error, {}}); }
+    }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+Client::Client() noexcept
+    : Client(Config{})
+{
+}
+
+Client::Client(const Config& config) noexcept
+    : imp_(std::make_unique<Imp>(config))
+{
+}
+
+auto Client::accounts() const noexcept -> std::future<AccountList>
+{
+    return imp_->accounts();
+}
+
+auto Client::activity(const ActivityQuery& query) const noexcept
+    -> std::future<ActivityPage>
+{
+    return imp_->activity(query);
+}
+
+auto Client::call(
+    const std::string_view method,
+    const boost::json::object& params) const noexcept -> std::future<Reply>
+{
+    return imp_->call(method, params);
+}
+
+auto Client::nyms() const noexcept -> std::future<NymList>
+{
+    return imp_->nyms();
+}
+
+auto Client::send_payment(const Payment& payment) const noexcept
+    -> std::future<PaymentReply>
+{
+    return imp_->send_payment(payment);
+}
+
+auto Client::transactions(const std::string& account) const noexcept
+    -> std::future<ActivityPage>
+{
+    return imp_->transactions(account);
+}
+
+auto Client::watch(
+    const std::vector<std::string>& events,
+    const EventCallback& callback) const noexcept -> Result
+{
+    return imp_->watch(events, callback);
+}
+
+Client::~Client() = default;
+}  // namespace metier::client
@@ -0,0 +1,151 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/json.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace metier::client
+{
+enum class Result {
+    success,
+    socket_not_ready,
+    send_error,
+    receive_timeout,
+    receive_error,
+    server_busy,
+    server_error,
+};
+
+auto translate(Result) noexcept -> std::string;
+
+struct Status {
+    Result result_{Result::success};
+    std::string error_{};
+
+    auto ok() const noexcept -> bool { return Result::success == result_; }
+};
+
+struct Account {
+    std::string id_{};
+    std::string style_{};
+    std::string name_{};
+    std::string owner_{};
+    std::string issuer_{};
+    std::string contract_{};
+    std::string confirmed_{};
+    std::string pending_{};
+};
+
+struct AccountList : public Status {
+    std::vector<Account> accounts_{};
+};
+
+struct Transaction {
+    std::string id_{};
+    std::int64_t timestamp_{};
+    std::string amount_{};
+};
+
+struct ActivityQuery {
+    std::string account_{};
+    std::size_t limit_{};
+    std::optional<std::int64_t> since_{};
+    std::string cursor_{};
+};
+
+struct ActivityPage : public Status {
+    std::string account_{};
+    std::vector<Transaction> transactions_{};
+    std::string cursor_{};
+    bool more_{false};
+};
+
+struct NymList : public Status {
+    std::vector<std::string> nyms_{};
+};
+
+struct Payment {
+    std::string from_{};
+    std::string to_{};
+    std::int64_t amount_{};
+};
+
+struct PaymentReply : public Status {
+    std::string txid_{};
+};
+
+struct Event {
+    std::string name_{};
+    boost::json::object data_{};
+};
+
+struct Reply : public Status {
+    boost::json::object data_{};
+};
+
+// NOTE a client owns one connection to the rpc socket which is shared by all
+// calls. Calls may be made from any thread and any number of them may be in
+// flight at the same time. Each call returns immediately; replies are matched
+// to their requests and parsed on a background thread, which is also where the
+// returned futures become ready.
+class Client
+{
+public:
+    using EventCallback = std::function<bool(const Event&)>;
+
+    struct Config {
+        std::string endpoint_{};
+        std::string event_endpoint_{};
+        std::chrono::milliseconds timeout_{std::chrono::seconds{10}};
+        // NOTE a payment whose reply times out may still be executed by the
+        // server, so its outcome is unknown rather than failed
+        std::chrono::milliseconds send_timeout_{std::chrono::minutes{10}};
+        int session_{0};
+    };
+
+    auto accounts() const noexcept -> std::future<AccountList>;
+    auto activity(const ActivityQuery& query) const noexcept
+        -> std::future<ActivityPage>;
+    auto call(const std::string_view method, const boost::json::object& params)
+        const noexcept -> std::future<Reply>;
+    auto nyms() const noexcept -> std::future<NymList>;
+    auto send_payment(const Payment& payment) const noexcept
+        -> std::future<PaymentReply>;
+    auto transactions(const std::string& account) const noexcept
+        -> std::future<ActivityPage>;
+    // NOTE blocks the calling thread, passing each event to the callback
+    // until the callback returns false or the event socket fails
+    auto watch(
+        const std::vector<std::string>& events,
+        const EventCallback& callback) const noexcept -> Result;
+
+    Client() noexcept;
+    Client(const Config& config) noexcept;
+
+    ~Client();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    Client(const Client&) = delete;
+    Client(Client&&) = delete;
+    auto operator=(const Client&) -> Client& = delete;
+    auto operator=(Client&&) -> Client& = delete;
+};
+}  // namespace metier::client
@@ -5,10 +5,8 @@
 
 #include "licenses.hpp"  // IWYU pragma: associated
 
-#include <iostream>
-#include <memory>
 #include <string>
-#include <vector>
+#include <string_view>
 
 #include "license.hpp"
 
@@ -18,23 +16,25 @@ Licenses::Licenses(QObject* parent) noexcept { moveToThread(parent->thread()); }
 
 auto Licenses::data(const QModelIndex& index, int role) const -> QVariant
 {
-    static const auto& data = MetierLicenseData();
-
     if (false == index.isValid()) { return {}; }
 
     const auto row = static_cast<std::size_t>(index.row());
 
     switch (role) {
         case Qt::DisplayRole: {
-            try {
-                return QString::fromLocal8Bit(data.at(row).first.c_str());
-            } catch (...) {
+            if (row < LicenseCount()) {
+                const auto name = LicenseName(row);
+
+                return QString::fromLocal8Bit(
+                    name.data(), static_cast<int>(name.size()));
             }
         } break;
         case Qt::UserRole: {
-            try {
-                return QString{data.at(row).second.c_str()};
-            } catch (...) {
+            if (row < LicenseCount()) {
+                const auto text = LicenseText(row);
+
+                return QString::fromUtf8(
+                    text.data(), static_cast<int>(text.size()));
             }
         } break;
         default: {
@@ -46,7 +46,7 @@ auto Licenses::data(const QModelIndex& index, int role) const -> QVariant
 
 auto Licenses::rowCount([[maybe_unused]] const QModelIndex& parent) const -> int
 {
-    static const auto output = MetierLicenseData().size();
+    static const auto output = LicenseCount();
 
     return static_cast<int>(output);
 }
@@ -6,9 +6,10 @@
 #include "otwrap.hpp"  // IWYU pragma: associated
 
 #include <opentxs/opentxs.hpp>
+#include <QCoreApplication>
 #include <QDebug>
 #include <QDesktopServices>
-#include <QGuiApplication>
+#include <QMetaObject>
 #include <QNetworkReply>
 #include <QUrl>
 #include <algorithm>
@@ -18,12 +19,13 @@
 #include "models/blockchainchooser.hpp"
 #include "otwrap/imp.hpp"
 #include "util/convertblockchain.hpp"
+#include "util/profiler.hpp"
 
 namespace qr = qrcodegen;
 
 namespace metier
 {
-OTWrap::OTWrap(QGuiApplication& parent, App& app, int& argc, char** argv)
+OTWrap::OTWrap(QCoreApplication& parent, App& app, int& argc, char** argv)
     : QObject(&parent)
     , imp_p_(std::make_unique<Imp>(parent, app, *this, argc, argv))
     , imp_(*imp_p_)
@@ -124,23 +126,32 @@ auto OTWrap::blockchainStatisticsModelQML() -> QObject*
 
 auto OTWrap::checkStartupConditions() -> void
 {
+    using Phase = Imp::Phase;
+
+    // NOTE chains enabled after this point are handled by check_chains
+    if (Phase::validating <= imp_.phase_) { return; }
+
     if (imp_.needSeed()) {
+        imp_.phase_ = Phase::seed;
         emit needSeed();
 
         return;
     }
 
-    if (false == imp_.validateSeed()) {
+    if (false == util::Profiler::Measure(
+                     "validateSeed", [&] { return imp_.validateSeed(); })) {
         qFatal("Unable to initialize wallet seed");
     }
 
     if (imp_.needNym()) {
+        imp_.phase_ = Phase::nym;
         emit needProfileName();
 
         return;
     }
 
-    if (false == imp_.validateNym()) {
+    if (false == util::Profiler::Measure(
+                     "validateNym", [&] { return imp_.validateNym(); })) {
         qFatal("Unable to initialize identity");
     }
 
@@ -149,31 +160,52 @@ auto OTWrap::checkStartupConditions() -> void
     {
         auto* model =
             imp_.api_.UI().BlockchainSelectionQt(ot::ui::Blockchains::All);
-
-        if (imp_.enableDefaultChain()) {
-            const auto start = ot::Clock::now();
-            constexpr auto limit = std::chrono::minutes{1};
-
-            while (0 == model->enabledCount()) {
-                if ((ot::Clock::now() - start) > limit) {
-                    qFatal("Timeout waiting for enabled blockchain");
-                }
+        const auto enabled = imp_.enableDefaultChain();
+
+        if (1 > model->enabledCount()) {
+            if (enabled) {
+                // NOTE startup resumes when the selection model reports the
+                // default chain via enabledChanged
+                imp_.phase_ = Phase::chain;
+                imp_.chain_timeout_.start();
+            } else {
+                imp_.phase_ = Phase::blockchain;
+                emit needBlockchain();
             }
-        } else if (1 > model->enabledCount()) {
-            emit needBlockchain();
 
             return;
         }
     }
 
-    if (false == imp_.validateBlockchains()) {
-        qFatal("Unable to initialize blockchains");
-    }
+    // NOTE accounts are created on the jobs_ worker and startup resumes on
+    // the Qt thread once they exist
+    imp_.phase_ = Phase::validating;
+    imp_.run_job(Job::checkAccounts, [this](const auto& progress) {
+        const auto output = util::Profiler::Measure(
+            "validateBlockchains",
+            [&] { return imp_.validateBlockchains(progress); });
+        QMetaObject::invokeMethod(
+            this,
+            [this, output] {
+                if (false == output) {
+                    qFatal("Unable to initialize blockchains");
+                }
+
+                imp_.phase_ = Phase::ready;
+                emit readyForMainWindow();
+            },
+            Qt::QueuedConnection);
 
-    emit readyForMainWindow();
+        return output;
+    });
 }
 
-auto OTWrap::checkAccounts() -> void { imp_.validateBlockchains(); }
+auto OTWrap::checkAccounts() -> void
+{
+    imp_.run_job(Job::checkAccounts, [this](const auto& progress) {
+        return imp_.validateBlockchains(progress);
+    });
+}
 
 auto OTWrap::Cleanup() noexcept -> void { ot::Cleanup(); }
 
@@ -203,8 +235,20 @@ auto OTWrap::createNewSeed(const int type, const int lang, const int strength)
 
 auto OTWrap::createNym(QString alias) -> void
 {
-    imp_.createNym(alias);
-    checkStartupConditions();
+    imp_.run_job(Job::createNym, [this, alias](const auto& progress) {
+        progress(0, 1);
+        const auto output = imp_.createNym(alias);
+        progress(1, 1);
+        QMetaObject::invokeMethod(
+            this, &OTWrap::checkStartupConditions, Qt::QueuedConnection);
+
+        return output;
+    });
+}
+
+auto OTWrap::enableBlockchain(const int chain) -> bool
+{
+    return imp_.api_.Network().Blockchain().Enable(util::convert(chain));
 }
 
 auto OTWrap::enabledBlockchains() -> BlockchainList
@@ -233,23 +277,34 @@ auto OTWrap::getRecoveryWords() -> QStringList
 auto OTWrap::importSeed(int type, int lang, QString words, QString password)
     -> void
 {
-    imp_.importSeed(type, lang, words, password);
-    checkStartupConditions();
+    imp_.run_job(
+        Job::importSeed,
+        [this, type, lang, words, password](const auto& progress) {
+            progress(0, 1);
+            const auto output = imp_.importSeed(type, lang, words, password);
+            progress(1, 1);
+            QMetaObject::invokeMethod(
+                this, &OTWrap::checkStartupConditions, Qt::QueuedConnection);
+
+            return output;
+        });
 }
 
 auto OTWrap::longestBlockchainName() -> int
 {
-    static const auto length = [&] {
-        auto out = std::size_t{0};
+    static const auto length = imp_.metadata_.integer(
+        "longest_blockchain_name", [&] {
+            auto out = std::size_t{0};
 
-        for (const auto chain : ot::blockchain::DefinedChains()) {
-            out = std::max(out, ot::blockchain::DisplayString(chain).size());
-        }
+            for (const auto chain : ot::blockchain::DefinedChains()) {
+                out =
+                    std::max(out, ot::blockchain::DisplayString(chain).size());
+            }
 
-        return out;
-    }();
+            return static_cast<int>(out);
+        });
 
-    return static_cast<int>(length);
+    return length;
 }
 
 auto OTWrap::longestSeedWord() -> int { return imp_.longest_seed_word_; }
@@ -266,6 +321,11 @@ auto OTWrap::profileModel() -> opentxs::ui::ProfileQt*
 
 auto OTWrap::profileModelQML() -> QObject* { return profileModel(); }
 
+auto OTWrap::requestAccountActivityModel(int chain) -> void
+{
+    imp_.requestAccountActivityModel(chain);
+}
+
 auto OTWrap::seedLanguageModel(const int type) -> model::SeedLanguage*
 {
     return imp_.seedLanguageModel(type);
@@ -13,7 +13,7 @@
 #include <memory>
 
 class QAbstractItemModel;
-class QGuiApplication;
+class QCoreApplication;
 
 namespace opentxs
 {
@@ -51,12 +51,39 @@ class OTWrap final : public QObject
     Q_PROPERTY(int longestSeedWord READ longestSeedWord)
 
 signals:
+    // NOTE emitted from a background thread as the accounts for an enabled
+    // chain are created. The first emission for each chain has created == 0
+    // and total is the number of subaccounts which are missing.
+    void accountProgress(int chain, int created, int total);
+    // NOTE emitted on the Qt thread in response to
+    // requestAccountActivityModel. The model is null if the account does not
+    // exist.
+    void accountActivityModelReady(
+        int chain,
+        opentxs::ui::AccountActivityQt* model);
     void chainsChanged(int enabledCount);
+    // NOTE checkAccounts, createNym and importSeed run on a worker thread.
+    // Each call emits jobStarted, then jobProgress zero or more times with
+    // the number of completed steps out of total, and finally jobFinished.
+    // The job argument is a Job value.
+    void jobFinished(int job, bool success);
+    void jobProgress(int job, int done, int total);
+    void jobStarted(int job);
     void needBlockchain();
     void needProfileName();
     void needSeed();
     void nymReady();
     void readyForMainWindow();
+    // NOTE emitted on the Qt thread at most once per frame for every chain
+    // which reported progress during the frame, followed by the total for
+    // all chains which uses chain 0. The rate is in blocks per second and
+    // eta is the estimated number of seconds remaining, or -1 if unknown.
+    void syncProgressChanged(
+        int chain,
+        int current,
+        int target,
+        double rate,
+        int eta);
 
 public slots:
     void checkAccounts();
@@ -65,6 +92,12 @@ public slots:
     void importSeed(int type, int lang, QString words, QString password);
 
 public:
+    enum class Job : int {
+        checkAccounts = 0,
+        createNym = 1,
+        importSeed = 2,
+    };
+
     using BlockchainList = QVector<int>;
     using AccountActivity = opentxs::ui::AccountActivityQt;
     using ActivityThread = opentxs::ui::ActivityThreadQt;
@@ -106,11 +139,15 @@ public:
 
     Q_INVOKABLE QString addContact(QString label, QString id);
     Q_INVOKABLE int convertBlockchainAccountID(const QString& id);
+    // NOTE returns immediately without ever blocking on storage or network
+    // activity. The result is delivered by accountActivityModelReady.
+    Q_INVOKABLE void requestAccountActivityModel(int chain);
     Q_INVOKABLE QStringList
     createNewSeed(const int type, const int lang, const int strength);
     Q_INVOKABLE QStringList getRecoveryWords();
     Q_INVOKABLE int wordCount(const int type, const int strength);
     Q_INVOKABLE int enabledCurrencyCount();
+    bool enableBlockchain(const int chain);
     BlockchainList enabledBlockchains();
     Q_INVOKABLE QString getQRcodeBase64(const QString input_string);
     Q_INVOKABLE int longestBlockchainName();
@@ -119,7 +156,7 @@ public:
     BlockchainList validBlockchains();
     Q_INVOKABLE QString versionString(int suffix = 0);
 
-    explicit OTWrap(QGuiApplication& parent, App& app, int& argc, char** argv);
+    explicit OTWrap(QCoreApplication& parent, App& app, int& argc, char** argv);
 
     ~OTWrap() final;
 
@@ -0,0 +1,148 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/eventfeed.hpp"  // IWYU pragma: associated
+
+#include <boost/json.hpp>
+#include <opentxs/opentxs.hpp>
+#include <QAbstractItemModel>
+#include <QDebug>
+#include <QModelIndex>
+#include <QObject>
+#include <QString>
+#include <mutex>
+#include <set>
+
+#include "rpc/protocol.hpp"
+#include "rpc/rpc.hpp"
+
+namespace ot = opentxs;
+namespace json = boost::json;
+
+namespace metier
+{
+struct EventFeed::Imp {
+    using Lock = std::lock_guard<std::mutex>;
+    using Model = ot::ui::AccountActivityQt;
+
+    auto publish(const std::string_view event, const json::object& data)
+        const noexcept -> void
+    {
+        auto message = ot_.ZMQ().Message();
+        message->AddFrame(std::string{event});
+        message->AddFrame(json::serialize(data));
+        auto lock = Lock{lock_};
+        socket_->Send(message);
+    }
+    // NOTE connections use context_ as their receiver so they are removed
+    // automatically when the feed is destroyed, even though the models
+    // themselves are owned by opentxs and outlive it
+    auto watch(const int chain, const std::string& account, Model* model)
+        const noexcept -> void
+    {
+        if (nullptr == model) { return; }
+
+        {
+            auto lock = Lock{lock_};
+
+            if (false == watched_.emplace(model).second) { return; }
+        }
+
+        const auto event = [=] {
+            auto out = json::object{};
+            out["chain"] = chain;
+            out["account"] = account;
+
+            return out;
+        };
+        auto* context = &context_;
+        QObject::connect(
+            model, &Model::balanceChanged, context, [=](QString balance) {
+                auto out = event();
+                out["balance"] = balance.toStdString();
+                publish(rpc::event_balance_, out);
+            });
+        QObject::connect(
+            model,
+            &QAbstractItemModel::rowsInserted,
+            context,
+            [=](const QModelIndex&, int first, int last) {
+                auto out = event();
+                out["count"] = last - first + 1;
+                publish(rpc::event_activity_, out);
+            });
+        // NOTE sync events are published by SyncMonitor at a fixed rate
+        QObject::connect(
+            model,
+            &Model::transactionSendResult,
+            context,
+            [=](int request, int result, QString txid) {
+                auto out = event();
+                out["request"] = request;
+                out["result"] = result;
+                out["txid"] = txid.toStdString();
+                publish(rpc::event_send_, out);
+            });
+    }
+
+    Imp(const ot::api::Context& ot) noexcept
+        : ot_(ot)
+        , lock_()
+        , context_()
+        , watched_()
+        , socket_([this] {
+            auto out = ot_.ZMQ().PublishSocket();
+            const auto endpoint = rpc_event_endpoint();
+
+            if (out->Start(endpoint)) {
+                qInfo() << QString("RPC event socket opened at: %1")
+                               .arg(endpoint.c_str());
+            } else {
+                qWarning() << "Failed to start RPC event socket";
+            }
+
+            return out;
+        }())
+    {
+    }
+
+    ~Imp() { socket_->Close(); }
+
+private:
+    const ot::api::Context& ot_;
+    mutable std::mutex lock_;
+    mutable QObject context_;
+    mutable std::set<const Model*> watched_;
+    ot::OTZMQPublishSocket socket_;
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+EventFeed::EventFeed(const ot::api::Context& ot) noexcept
+    : imp_(std::make_unique<Imp>(ot))
+{
+}
+
+auto EventFeed::publish(
+    const std::string_view event,
+    const json::object& data) const noexcept -> void
+{
+    imp_->publish(event, data);
+}
+
+auto EventFeed::watch(
+    const int chain,
+    const std::string& account,
+    ot::ui::AccountActivityQt* model) const noexcept -> void
+{
+    imp_->watch(chain, account, model);
+}
+
+EventFeed::~EventFeed() = default;
+}  // namespace metier
@@ -0,0 +1,54 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/json.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace opentxs
+{
+namespace api
+{
+class Context;
+}  // namespace api
+
+namespace ui
+{
+class AccountActivityQt;
+}  // namespace ui
+}  // namespace opentxs
+
+namespace metier
+{
+class EventFeed
+{
+public:
+    auto publish(
+        const std::string_view event,
+        const boost::json::object& data) const noexcept -> void;
+    auto watch(
+        const int chain,
+        const std::string& account,
+        opentxs::ui::AccountActivityQt* model) const noexcept -> void;
+
+    EventFeed(const opentxs::api::Context& ot) noexcept;
+
+    ~EventFeed();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    EventFeed() = delete;
+    EventFeed(const EventFeed&) = delete;
+    EventFeed(EventFeed&&) = delete;
+    auto operator=(const EventFeed&) -> EventFeed& = delete;
+    auto operator=(EventFeed&&) -> EventFeed& = delete;
+};
+}  // namespace metier
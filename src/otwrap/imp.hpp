@@ -7,49 +7,75 @@
 
 #include "otwrap.hpp"  // IWYU pragma: associated
 
+#include <boost/json.hpp>
+#include <boost/program_options.hpp>
 #include <opentxs/opentxs.hpp>
+#include <QCoreApplication>
 #include <QDebug>
 #include <QDir>
-#include <QGuiApplication>
+#include <QMetaObject>
 #include <QStandardPaths>
+#include <QTimer>
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "models/accountlist.hpp"
 #include "models/seedlang.hpp"
 #include "models/seedsize.hpp"
 #include "models/seedtype.hpp"
+#include "otwrap/eventfeed.hpp"
+#include "otwrap/locks.hpp"
+#include "otwrap/metadatacache.hpp"
 #include "otwrap/notary.hpp"
 #include "otwrap/passwordcallback.hpp"
+#include "otwrap/refreshscheduler.hpp"
+#include "otwrap/registrationcache.hpp"
+#include "otwrap/rpcextension.hpp"
+#include "otwrap/rpcqueue.hpp"
+#include "otwrap/syncmonitor.hpp"
+#include "otwrap/workqueue.hpp"
+#include "rpc/protocol.hpp"
 #include "rpc/rpc.hpp"
 #include "util/claim.hpp"
 #include "util/convertblockchain.hpp"
+#include "util/profiler.hpp"
 #include "util/scopeguard.hpp"
 
 namespace ot = opentxs;
 
 static const auto ot_args_ = ot::Options{};
 
-auto make_args(QGuiApplication& parent, int& argc, char** argv) noexcept
-    -> const ot::Options&;
-auto make_args(QGuiApplication& parent, int& argc, char** argv) noexcept
-    -> const ot::Options&
+// NOTE only valid after make_args has set the application name
+auto data_folder() noexcept -> QString;
+auto data_folder() noexcept -> QString
 {
-    parent.setOrganizationDomain(METIER_APP_DOMAIN);
-    parent.setApplicationName(METIER_APP_NAME);
     auto path =
         QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
 
     if (path.isEmpty()) { qFatal("Invalid app data folder"); }
 
-    auto folder = QDir{path.append("/opentxs/")};
-    const auto absolute = folder.absolutePath();
+    return QDir{path.append("/opentxs/")}.absolutePath();
+}
 
-    if (folder.mkpath(absolute)) {
+auto make_args(QCoreApplication& parent, int& argc, char** argv) noexcept
+    -> const ot::Options&;
+auto make_args(QCoreApplication& parent, int& argc, char** argv) noexcept
+    -> const ot::Options&
+{
+    parent.setOrganizationDomain(METIER_APP_DOMAIN);
+    parent.setApplicationName(METIER_APP_NAME);
+    const auto absolute = data_folder();
+
+    if (QDir{}.mkpath(absolute)) {
         qDebug() << QString("Setting opentxs data folder to: %1").arg(absolute);
     } else {
         qFatal("Failed to create opentxs data folder");
@@ -69,17 +95,51 @@ auto make_args(QGuiApplication& parent, int& argc, char** argv) noexcept
     return ot_args_;
 }
 
-auto ready(bool complete = false) noexcept -> std::shared_future<void>;
-auto ready(bool complete) noexcept -> std::shared_future<void>
+auto rpc_config(int argc, char** argv) noexcept -> metier::RPCQueue::Config;
+auto rpc_config(int argc, char** argv) noexcept -> metier::RPCQueue::Config
 {
-    static auto mutex = std::mutex{};
-    auto lock = std::lock_guard<std::mutex>{mutex};
-    static auto promise = std::promise<void>{};
-    static auto future = std::shared_future<void>{promise.get_future()};
-
-    if (complete) { promise.set_value(); }
+    namespace po = boost::program_options;
+    static constexpr auto threads{"rpc-threads"};
+    static constexpr auto read{"rpc-read-limit"};
+    static constexpr auto write{"rpc-write-limit"};
+    static constexpr auto queue{"rpc-queue-limit"};
+    auto out = metier::RPCQueue::Config{};
+    const auto options = [&] {
+        const auto text = std::string{METIER_APP_NAME} + " rpc options";
+        auto desc = po::options_description{text};
+        desc.add_options()(
+            threads,
+            po::value<std::size_t>(&out.workers_),
+            "Number of rpc worker threads");
+        desc.add_options()(
+            read,
+            po::value<std::size_t>(&out.read_limit_),
+            "Maximum number of concurrent read-only rpc commands");
+        desc.add_options()(
+            write,
+            po::value<std::size_t>(&out.write_limit_),
+            "Maximum number of concurrent mutating rpc commands");
+        desc.add_options()(
+            queue,
+            po::value<std::size_t>(&out.queue_limit_),
+            "Maximum number of queued rpc commands");
+
+        return desc;
+    }();
+
+    try {
+        auto variables = po::variables_map{};
+        po::store(
+            po::command_line_parser(argc, argv)
+                .options(options)
+                .allow_unregistered()
+                .run(),
+            variables);
+        po::notify(variables);
+    } catch (po::error&) {
+    }
 
-    return future;
+    return out;
 }
 
 namespace metier
@@ -94,74 +154,184 @@ private:
     OTWrap& parent_;
 
 public:
+    // NOTE startup advances through these phases in order. Every transition
+    // happens on the Qt thread in response to a signal so nothing ever waits
+    // for the next phase.
+    enum class Phase {
+        context,
+        seed,
+        nym,
+        blockchain,
+        chain,
+        validating,
+        ready,
+    };
+
+    // NOTE readers load the current snapshot and never lock or allocate.
+    // Writers are serialized, build a new snapshot and publish it atomically.
     struct EnabledChains {
         using Vector = std::set<ot::blockchain::Type>;
 
-        auto count() const noexcept
+        auto count() const noexcept { return load()->list_.size(); }
+        // NOTE QVector is implicitly shared so this only copies a reference
+        auto get() const noexcept -> BlockchainList { return load()->list_; }
+
+        auto add(ot::blockchain::Type chain) noexcept
+        {
+            update([&](auto& chains) { chains.emplace(chain); });
+        }
+        auto remove(ot::blockchain::Type chain) noexcept
         {
-            ot::Lock lock(lock_);
+            update([&](auto& chains) { chains.erase(chain); });
+        }
+        auto set(Vector&& in) noexcept
+        {
+            update([&](auto& chains) { std::swap(chains, in); });
+        }
 
-            return enabled_.size();
+        EnabledChains(Vector&& in) noexcept
+            : write_lock_()
+            , snapshot_(make(std::move(in)))
+        {
         }
-        auto get() const noexcept
+
+    private:
+        struct Snapshot {
+            Vector set_;
+            BlockchainList list_;
+        };
+
+        using Pointer = std::shared_ptr<const Snapshot>;
+
+        mutable std::mutex write_lock_;
+        Pointer snapshot_;
+
+        static auto make(Vector&& in) noexcept -> Pointer
         {
-            auto output = BlockchainList{};
-            auto copy = Vector{};
-            {
-                ot::Lock lock(lock_);
-                copy = enabled_;
-            }
+            auto list = BlockchainList{};
+            list.reserve(static_cast<int>(in.size()));
             std::transform(
-                std::begin(copy), std::end(copy), std::back_inserter(output), [
-                ](const auto& in) -> auto { return static_cast<int>(in); });
+                std::begin(in),
+                std::end(in),
+                std::back_inserter(list),
+                [](const auto& chain) { return static_cast<int>(chain); });
 
-            return output;
+            return std::make_shared<const Snapshot>(
+                Snapshot{std::move(in), std::move(list)});
         }
 
-        auto add(ot::blockchain::Type chain) noexcept
+        auto load() const noexcept -> Pointer
         {
-            ot::Lock lock(lock_);
-            enabled_.emplace(chain);
+            return std::atomic_load(&snapshot_);
         }
-        auto remove(ot::blockchain::Type chain) noexcept
+        template <typename Function>
+        auto update(Function modify) noexcept -> void
         {
-            ot::Lock lock(lock_);
-            enabled_.erase(chain);
+            ot::Lock lock(write_lock_);
+            auto chains = load()->set_;
+            modify(chains);
+            std::atomic_store(&snapshot_, make(std::move(chains)));
         }
-        auto set(Vector&& in) noexcept
+    };
+
+    // NOTE the seed and nym ids are written by the jobs_ worker and by startup
+    // on the Qt thread but read from every thread. Readers copy the id they
+    // need out of the current snapshot and never lock. Writers are
+    // serialized, build a new snapshot and publish it atomically.
+    struct Identity {
+        auto nym() const noexcept -> ot::OTNymID { return load()->nym_; }
+        auto seed() const noexcept -> std::string { return load()->seed_; }
+
+        auto set_nym(ot::OTNymID&& id) noexcept -> void
+        {
+            ot::Lock lock(write_lock_);
+            const auto current = load();
+            store(current->seed_, std::move(id));
+        }
+        auto set_seed(std::string&& id) noexcept -> void
         {
-            ot::Lock lock(lock_);
-            std::swap(enabled_, in);
+            ot::Lock lock(write_lock_);
+            const auto current = load();
+            store(std::move(id), current->nym_);
         }
 
-        EnabledChains(Vector&& in) noexcept
-            : enabled_(std::move(in))
+        Identity(ot::OTNymID&& nym) noexcept
+            : write_lock_()
+            , snapshot_(std::make_shared<const Snapshot>(
+                  Snapshot{std::string{}, std::move(nym)}))
         {
         }
 
     private:
-        mutable std::mutex lock_{};
-        Vector enabled_{};
+        struct Snapshot {
+            std::string seed_;
+            ot::OTNymID nym_;
+        };
+
+        using Pointer = std::shared_ptr<const Snapshot>;
+
+        mutable std::mutex write_lock_;
+        Pointer snapshot_;
+
+        auto load() const noexcept -> Pointer
+        {
+            return std::atomic_load(&snapshot_);
+        }
+        auto store(std::string seed, ot::OTNymID nym) noexcept -> void
+        {
+            std::atomic_store(
+                &snapshot_,
+                std::make_shared<const Snapshot>(
+                    Snapshot{std::move(seed), std::move(nym)}));
+        }
     };
 
+    // NOTE startup work which only depends on api_ runs on background threads
+    // while the Qt models are created on the calling thread. Each result is
+    // collected by the member which needs it.
+    struct Pending {
+        std::future<ot::OTServerID> introduction_notary_;
+        std::future<ot::OTServerID> messaging_notary_;
+        std::future<int> longest_seed_word_;
+    };
+
+    using Progress = std::function<void(int done, int total)>;
+
     PasswordCallback callback_;
     opentxs::OTCaller caller_;
     const opentxs::api::Context& ot_;
+    const RefreshScheduler refresh_;
+    const Locks locks_;
+    const SyncMonitor sync_;
+    const RPCExtension rpc_extension_;
+    RPCQueue rpc_queue_;
     const ot::OTZMQListenCallback rpc_cb_;
     ot::OTZMQRouterSocket rpc_socket_;
+    const EventFeed event_feed_;
     const opentxs::api::client::Manager& api_;
+    const MetadataCache metadata_;
+    const RegistrationCache registration_;
+    const ot::OTZMQListenCallback registration_cb_;
+    ot::OTZMQSubscribeSocket registration_socket_;
+    Pending pending_;
+    EnabledChains enabled_chains_;
+    std::unique_ptr<model::SeedType> seed_type_;
     const ot::OTServerID introduction_notary_id_;
     const ot::OTServerID messaging_notary_id_;
-    const std::string seed_id_;
-    const ot::OTNymID nym_id_;
+    Identity identity_;
+    std::string introduction_nym_;
     const int longest_seed_word_;
-    mutable std::mutex lock_;
-    EnabledChains enabled_chains_;
-    std::unique_ptr<model::SeedType> seed_type_;
     std::map<int, std::unique_ptr<model::SeedLanguage>> seed_language_;
     std::map<int, std::unique_ptr<model::SeedSize>> seed_size_;
     std::unique_ptr<model::AccountList> account_list_;
     std::unique_ptr<model::BlockchainChooser> mainnet_model_;
+    std::atomic<Phase> phase_;
+    QTimer chain_timeout_;
+    std::map<int, ot::OTIdentifier> account_ids_;
+    // NOTE a single worker so that jobs triggered by the user run in the
+    // order they were requested and never overlap
+    WorkQueue jobs_;
+    WorkQueue lookups_;
 
     template <typename OutputType, typename InputType>
     static auto transform(const InputType& data) noexcept -> OutputType
@@ -177,9 +347,34 @@ public:
         return output;
     }
 
-    auto check_chains(int count) const noexcept -> void
+    auto check_chains(int count) noexcept -> void
     {
-        validateBlockchains();
+        switch (phase_.load()) {
+            case Phase::chain: {
+                if (0 < count) {
+                    chain_timeout_.stop();
+                    parent_.checkStartupConditions();
+                }
+            } break;
+            case Phase::validating:
+            case Phase::ready: {
+                // NOTE chainsChanged is delayed until the accounts for newly
+                // enabled chains exist. jobs_ runs this after any validation
+                // which is already queued.
+                run_job(
+                    Job::checkAccounts, [this, count](const auto& progress) {
+                        const auto output = validateBlockchains(progress);
+                        emit parent_.chainsChanged(count);
+
+                        return output;
+                    });
+
+                return;
+            }
+            default: {
+            }
+        }
+
         emit parent_.chainsChanged(count);
     }
 
@@ -194,82 +389,163 @@ public:
     }
     auto needNym() const noexcept
     {
-        ready().get();
-
         return 0 == api_.Wallet().LocalNymCount();
     }
     auto needSeed() const noexcept
     {
-        ready().get();
-
         return api_.Storage().SeedList().empty();
     }
-    auto rpc(zmq::Message& in) const noexcept -> void
+    static auto rpc_kind(const ot::ReadView cmd) noexcept -> RPCQueue::Kind
     {
-        const auto body = in.Body();
+        using Kind = RPCQueue::Kind;
+        using Type = ot::rpc::CommandType;
+        const auto request = ot::rpc::request::Factory(cmd);
 
-        if (1u != body.size()) { qInfo() << "Invalid message"; }
+        if (!request) { return Kind::read; }
+
+        switch (request->Type()) {
+            case Type::list_accounts:
+            case Type::list_nyms:
+            case Type::get_account_balance:
+            case Type::get_account_activity: {
+
+                return Kind::read;
+            }
+            default: {
 
-        const auto& cmd = body.at(0);
-        auto out = ot_.ZMQ().ReplyMessage(in);
+                return Kind::write;
+            }
+        }
+    }
+    // NOTE this runs on the router socket's callback thread so it only
+    // queues the command. Execution happens on an rpc_queue_ worker.
+    auto rpc(zmq::Message& in) const noexcept -> void
+    {
+        using Kind = RPCQueue::Kind;
+        const auto body = in.Body();
+        auto kind = Kind::read;
+        auto job = RPCQueue::Job{};
+
+        if (1u == body.size()) {
+            auto cmd = std::string{body.at(0).Bytes()};
+            kind = rpc_kind(cmd);
+            job = [this, cmd, out = ot_.ZMQ().ReplyMessage(in)]() mutable {
+                if (ot_.RPC(cmd, out->AppendBytes())) {
+                    rpc_socket_->Send(out);
+                }
+            };
+        } else if (rpc::extension_frames_ == body.size()) {
+            auto method = std::string{body.at(0).Bytes()};
+            auto params = std::string{body.at(1).Bytes()};
+            kind = RPCExtension::IsReadOnly(method) ? Kind::read : Kind::write;
+            job = [this,
+                   method,
+                   params,
+                   out = ot_.ZMQ().ReplyMessage(in)]() mutable {
+                const auto reply = rpc_extension_.process(method, params);
+                out->AddFrame(reply.data(), reply.size());
+                rpc_socket_->Send(out);
+            };
+        } else {
+            qInfo() << "Invalid message";
+
+            return;
+        }
 
-        if (ot_.RPC(cmd.Bytes(), out->AppendBytes())) {
+        if (false == rpc_queue_.push(kind, std::move(job))) {
+            // NOTE an empty reply tells the client the server is too busy
+            auto out = ot_.ZMQ().ReplyMessage(in);
+            out->AddFrame();
             rpc_socket_->Send(out);
+        } else if (Kind::write == kind) {
+            refresh_.activity();
         }
     }
-    auto validateBlockchains() const noexcept -> bool
+    // NOTE every enabled chain is provisioned on its own thread. Chains only
+    // contend with themselves, which happens if validation is triggered again
+    // before an earlier run has finished. Progress counts one step per chain
+    // plus one for notary registration.
+    auto validateBlockchains(const Progress& progress = {}) noexcept -> bool
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        const auto chains = api_.Network().Blockchain().EnabledChains();
+        const auto total = static_cast<int>(chains.size()) + 1;
+        auto done = int{0};
+        const auto report = [&] {
+            if (progress) { progress(done, total); }
+        };
+        report();
+        auto futures = std::vector<std::future<bool>>{};
+        futures.reserve(chains.size());
+
+        for (const auto chain : chains) {
+            futures.emplace_back(std::async(std::launch::async, [this, chain] {
+                auto lock =
+                    Locks::Lock{locks_.chain(static_cast<int>(chain))};
+
+                return make_accounts(chain);
+            }));
+        }
+
+        auto output{true};
 
-        for (const auto chain : api_.Network().Blockchain().EnabledChains()) {
-            if (false == make_accounts(chain)) { return false; }
+        for (auto& future : futures) {
+            output &= future.get();
+            ++done;
+            report();
         }
 
+        if (false == output) { return false; }
+
+        // NOTE the account activity models are created and connected on the
+        // Qt thread, which is where the gui creates them as well
+        QMetaObject::invokeMethod(
+            &parent_,
+            [this, chains] {
+                for (const auto chain : chains) { watch(chain); }
+            },
+            Qt::QueuedConnection);
+
+        auto lock = Locks::Lock{locks_.registration()};
         check_registration();
-        api_.OTX().StartIntroductionServer(nym_id_);
-        api_.Schedule(std::chrono::minutes{2}, [&] { api_.OTX().Refresh(); });
+        start_introduction_server();
+        refresh_.start();
+        refresh_.activity();
+        ++done;
+        report();
 
         return true;
     }
-    auto validateNym() const noexcept
+    auto validateNym() noexcept
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        auto lock = Locks::Lock{locks_.identity()};
         auto postcondition = ScopeGuard{[this] {
-            if (nym_id_->empty()) { return; }
-
-            {
-                auto& pointer =
-                    const_cast<std::unique_ptr<model::AccountList>&>(
-                        account_list_);
+            const auto nym = identity_.nym();
 
-                if (!pointer) {
+            if (nym->empty()) { return; }
 
-                    pointer = std::make_unique<model::AccountList>(
-                        api_.UI().AccountListQt(nym_id_));
+            if (!account_list_) {
+                account_list_ = std::make_unique<model::AccountList>(
+                    api_.UI().AccountListQt(nym));
 
-                    OT_ASSERT(pointer);
+                OT_ASSERT(account_list_);
 
-                    Ownership::Claim(pointer.get());
-                }
+                Ownership::Claim(account_list_.get());
             }
         }};
 
-        if (false == nym_id_->empty()) { return true; }
+        if (false == identity_.nym()->empty()) { return true; }
 
-        auto& nymID = const_cast<ot::identifier::Nym&>(nym_id_.get());
         auto id = ot::String::Factory();
         bool notUsed{false};
         api_.Config().Check_str(
             ot::String::Factory(
-                QGuiApplication::applicationName().toStdString()),
+                QCoreApplication::applicationName().toStdString()),
             ot::String::Factory(nym_id_key),
             id,
             notUsed);
 
         if (id->Exists()) {
-            nymID.SetString(id->Get());
+            identity_.set_nym(api_.Factory().NymID(id->Get()));
 
             return true;
         }
@@ -281,7 +557,7 @@ public:
             id->Set(firstID->str().c_str());
             const auto config = api_.Config().Set_str(
                 ot::String::Factory(
-                    QGuiApplication::applicationName().toStdString()),
+                    QCoreApplication::applicationName().toStdString()),
                 ot::String::Factory(nym_id_key),
                 id,
                 notUsed);
@@ -290,33 +566,31 @@ public:
 
             if (false == api_.Config().Save()) { return false; }
 
-            nymID.SetString(id->Get());
-            api_.OTX().StartIntroductionServer(nym_id_);
+            identity_.set_nym(api_.Factory().NymID(id->Get()));
+            api_.OTX().StartIntroductionServer(identity_.nym());
 
             return true;
         }
 
         return false;
     }
-    auto validateSeed() const noexcept
+    auto validateSeed() noexcept
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        auto lock = Locks::Lock{locks_.identity()};
 
-        if (false == seed_id_.empty()) { return true; }
+        if (false == identity_.seed().empty()) { return true; }
 
-        auto& seed = const_cast<std::string&>(seed_id_);
         auto id = ot::String::Factory();
         bool notUsed{false};
         api_.Config().Check_str(
             ot::String::Factory(
-                QGuiApplication::applicationName().toStdString()),
+                QCoreApplication::applicationName().toStdString()),
             ot::String::Factory(seed_id_key),
             id,
             notUsed);
 
         if (id->Exists()) {
-            seed = id->Get();
+            identity_.set_seed(id->Get());
 
             return true;
         }
@@ -328,7 +602,7 @@ public:
             id->Set(firstID.c_str());
             const auto config = api_.Config().Set_str(
                 ot::String::Factory(
-                    QGuiApplication::applicationName().toStdString()),
+                    QCoreApplication::applicationName().toStdString()),
                 ot::String::Factory(seed_id_key),
                 id,
                 notUsed);
@@ -337,7 +611,7 @@ public:
 
             if (false == api_.Config().Save()) { return false; }
 
-            seed = id->Get();
+            identity_.set_seed(id->Get());
 
             return true;
         }
@@ -347,88 +621,105 @@ public:
 
     auto accountActivityModel(const int chain) noexcept -> AccountActivity*
     {
-        ready().get();
-        const auto& account =
-            api_.Blockchain().Account(nym_id_, util::convert(chain));
-
-        return api_.UI().AccountActivityQt(nym_id_, account.AccountID());
+        return api_.UI().AccountActivityQt(
+            identity_.nym(), account_id(chain));
     }
     auto accountActivityModel(const ot::Identifier& id) noexcept
         -> AccountActivity*
     {
-        ready().get();
-
-        return api_.UI().AccountActivityQt(nym_id_, id);
+        return api_.UI().AccountActivityQt(identity_.nym(), id);
     }
     auto accountStatusModel(const int chain) noexcept
         -> ot::ui::BlockchainAccountStatusQt*
     {
-        ready().get();
-
         return api_.UI().BlockchainAccountStatusQt(
-            nym_id_, util::convert(chain));
+            identity_.nym(), util::convert(chain));
     }
     auto activityThreadModel(const ot::Identifier& id) noexcept
         -> ActivityThread*
     {
-        ready().get();
+        return api_.UI().ActivityThreadQt(identity_.nym(), id);
+    }
+    // NOTE the account is resolved on a lookups_ worker unless it is already
+    // cached. The model is always constructed on the Qt thread, which is
+    // also where accountActivityModelReady is emitted.
+    auto requestAccountActivityModel(const int chain) noexcept -> void
+    {
+        const auto ready = [this, chain] {
+            QMetaObject::invokeMethod(
+                &parent_,
+                [this, chain] {
+                    const auto id = account_id(chain);
+                    auto* model =
+                        api_.UI().AccountActivityQt(identity_.nym(), id);
+
+                    // NOTE sync progress is reported as soon as the model
+                    // has been loaded instead of waiting for validation
+                    if (false == id->empty()) {
+                        sync_.watch(chain, id->str(), model);
+                    }
+
+                    emit parent_.accountActivityModelReady(chain, model);
+                },
+                Qt::QueuedConnection);
+        };
+
+        if (have_account_id(chain)) {
+            ready();
 
-        return api_.UI().ActivityThreadQt(nym_id_, id);
+            return;
+        }
+
+        const auto queued = lookups_.push([=] {
+            account_id(chain);
+            ready();
+        });
+
+        if (false == queued) { ready(); }
     }
     auto contactListModel() noexcept -> ContactList*
     {
-        ready().get();
-
-        return api_.UI().ContactListQt(nym_id_);
+        return api_.UI().ContactListQt(identity_.nym());
     }
-    auto createNym(QString alias) noexcept -> void
+    auto createNym(QString alias) noexcept -> bool
     {
-        ready().get();
-        ot::Lock lock(lock_);
-        auto success{false};
-        auto& id = const_cast<ot::identifier::Nym&>(nym_id_.get());
-        auto postcondition = ScopeGuard{[&]() {
-            if (false == success) { id.Release(); }
-        }};
+        auto lock = Locks::Lock{locks_.identity()};
+        const auto seed = identity_.seed();
         const auto reason =
             api_.Factory().PasswordPrompt("Generate a new Metier identity");
 
-        OT_ASSERT(false == seed_id_.empty());
+        OT_ASSERT(false == seed.empty());
 
         const auto pNym =
-            api_.Wallet().Nym(reason, alias.toStdString(), {seed_id_, 0});
+            api_.Wallet().Nym(reason, alias.toStdString(), {seed, 0});
 
-        if (!pNym) { return; }
+        if (!pNym) { return false; }
 
         const auto& nym = *pNym;
         bool notUsed{false};
         const auto config = api_.Config().Set_str(
             ot::String::Factory(
-                QGuiApplication::applicationName().toStdString()),
+                QCoreApplication::applicationName().toStdString()),
             ot::String::Factory(nym_id_key),
             ot::String::Factory(nym.ID().str()),
             notUsed);
 
-        if (false == config) { return; }
-        if (false == api_.Config().Save()) { return; }
+        if (false == config) { return false; }
+        if (false == api_.Config().Save()) { return false; }
+
+        identity_.set_nym(ot::OTNymID{nym.ID()});
 
-        id.Assign(nym.ID());
+        return true;
     }
     auto createNewSeed(
         const int type,
         const int lang,
         const int strength) noexcept -> QStringList
     {
-        ready().get();
-        ot::Lock lock(lock_);
-        auto success{false};
-        auto& id = const_cast<std::string&>(seed_id_);
-        auto postcondition = ScopeGuard{[&]() {
-            if (false == success) { id = {}; }
-        }};
+        auto lock = Locks::Lock{locks_.identity()};
         const auto& seeds = api_.Seeds();
 
-        OT_ASSERT(id.empty());
+        OT_ASSERT(identity_.seed().empty());
         OT_ASSERT(seeds.DefaultSeed().empty());
 
         const auto invalid = [](const int in) -> auto
@@ -440,7 +731,7 @@ public:
 
         auto reason =
             api_.Factory().PasswordPrompt("Generate a new Metier wallet seed");
-        id = seeds.NewSeed(
+        auto id = seeds.NewSeed(
             static_cast<ot::crypto::SeedStyle>(static_cast<std::uint8_t>(type)),
             static_cast<ot::crypto::Language>(static_cast<std::uint8_t>(lang)),
             static_cast<ot::crypto::SeedStrength>(
@@ -452,7 +743,7 @@ public:
         auto notUsed{false};
         const auto config = api_.Config().Set_str(
             ot::String::Factory(
-                QGuiApplication::applicationName().toStdString()),
+                QCoreApplication::applicationName().toStdString()),
             ot::String::Factory(seed_id_key),
             ot::String::Factory(id),
             notUsed);
@@ -460,19 +751,20 @@ public:
         if (false == config) { return {}; }
         if (false == api_.Config().Save()) { return {}; }
 
-        success = true;
         const auto words = QString{seeds.Words(id, reason).c_str()};
+        identity_.set_seed(std::move(id));
 
         return words.split(' ', Qt::SkipEmptyParts);
     }
+    // NOTE no lock is held while the password prompt is displayed so a
+    // prompt never blocks seed or nym validation
     auto getRecoveryWords() -> QStringList
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        const auto id = identity_.seed();
         const auto& seeds = api_.Seeds();
         const auto reason =
             api_.Factory().PasswordPrompt("Loading recovery words for backup");
-        const auto words = QString{seeds.Words(seed_id_, reason).c_str()};
+        const auto words = QString{seeds.Words(id, reason).c_str()};
 
         return words.split(' ', Qt::SkipEmptyParts);
     }
@@ -480,18 +772,12 @@ public:
         int type,
         int lang,
         const QString& input,
-        const QString& password) -> void
-    {
-        ready().get();
-        ot::Lock lock(lock_);
-        auto success{false};
-        auto& id = const_cast<std::string&>(seed_id_);
-        auto postcondition = ScopeGuard{[&]() {
-            if (false == success) { id = {}; }
-        }};
+        const QString& password) -> bool
+    {
+        auto lock = Locks::Lock{locks_.identity()};
         const auto& seeds = api_.Seeds();
 
-        OT_ASSERT(id.empty());
+        OT_ASSERT(identity_.seed().empty());
         OT_ASSERT(seeds.DefaultSeed().empty());
 
         auto reason =
@@ -499,38 +785,54 @@ public:
         const auto words = api_.Factory().SecretFromText(input.toStdString());
         const auto passphrase =
             api_.Factory().SecretFromText(password.toStdString());
-        id = seeds.ImportSeed(
+        auto id = seeds.ImportSeed(
             words,
             passphrase,
             static_cast<ot::crypto::SeedStyle>(static_cast<std::uint8_t>(type)),
             static_cast<ot::crypto::Language>(static_cast<std::uint8_t>(lang)),
             reason);
 
-        if (id.empty()) { return; }
+        if (id.empty()) { return false; }
 
         auto notUsed{false};
         const auto config = api_.Config().Set_str(
             ot::String::Factory(
-                QGuiApplication::applicationName().toStdString()),
+                QCoreApplication::applicationName().toStdString()),
             ot::String::Factory(seed_id_key),
             ot::String::Factory(id),
             notUsed);
 
-        if (false == config) { return; }
-        if (false == api_.Config().Save()) { return; }
+        if (false == config) { return false; }
+        if (false == api_.Config().Save()) { return false; }
+
+        identity_.set_seed(std::move(id));
 
-        success = true;
+        return true;
     }
-    auto profileModel() noexcept -> ot::ui::ProfileQt*
+    // NOTE work runs on the jobs_ worker so every signal is emitted from that
+    // thread. jobFinished is emitted even if the job could not be queued.
+    template <typename Work>
+    auto run_job(const Job job, Work&& work) noexcept -> void
     {
-        ready().get();
+        const auto id = static_cast<int>(job);
+        const auto queued =
+            jobs_.push([this, id, work = std::forward<Work>(work)]() mutable {
+                emit parent_.jobStarted(id);
+                const auto success = work([&](int done, int total) {
+                    emit parent_.jobProgress(id, done, total);
+                });
+                emit parent_.jobFinished(id, success);
+            });
 
-        return api_.UI().ProfileQt(nym_id_);
+        if (false == queued) { emit parent_.jobFinished(id, false); }
+    }
+    auto profileModel() noexcept -> ot::ui::ProfileQt*
+    {
+        return api_.UI().ProfileQt(identity_.nym());
     }
     auto seedLanguageModel(const int type) -> model::SeedLanguage*
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        auto lock = Locks::Lock{locks_.seed_language()};
         {
             auto it = seed_language_.find(type);
 
@@ -549,8 +851,11 @@ public:
             type,
             std::make_unique<model::SeedLanguage>(
                 &qt_parent_,
-                transform<model::SeedLanguage::Data>(
-                    api_.Seeds().AllowedLanguages(style))));
+                metadata_.table(
+                    QString("seed_languages_%1").arg(type), [&] {
+                        return transform<model::SeedLanguage::Data>(
+                            api_.Seeds().AllowedLanguages(style));
+                    })));
         auto& pModel = it->second;
 
         OT_ASSERT(pModel);
@@ -562,8 +867,7 @@ public:
     }
     auto seedSizeModel(const int type) -> model::SeedSize*
     {
-        ready().get();
-        ot::Lock lock(lock_);
+        auto lock = Locks::Lock{locks_.seed_size()};
         {
             auto it = seed_size_.find(type);
 
@@ -582,8 +886,11 @@ public:
             type,
             std::make_unique<model::SeedSize>(
                 &qt_parent_,
-                transform<model::SeedSize::Data>(
-                    api_.Seeds().AllowedSeedStrength(style))));
+                metadata_.table(
+                    QString("seed_strengths_%1").arg(type), [&] {
+                        return transform<model::SeedSize::Data>(
+                            api_.Seeds().AllowedSeedStrength(style));
+                    })));
         auto& pModel = it->second;
 
         OT_ASSERT(pModel);
@@ -596,7 +903,6 @@ public:
     auto seedWordValidator(const int type, const int lang)
         -> const opentxs::ui::SeedValidator*
     {
-        ready().get();
         const auto style =
             static_cast<ot::crypto::SeedStyle>(static_cast<std::uint8_t>(type));
         const auto language =
@@ -606,7 +912,6 @@ public:
     }
     auto wordCount(const int type, const int strength) -> int
     {
-        ready().get();
         const auto output = api_.Seeds().WordCount(
             static_cast<ot::crypto::SeedStyle>(static_cast<std::uint8_t>(type)),
             static_cast<ot::crypto::SeedStrength>(
@@ -615,16 +920,24 @@ public:
         return static_cast<int>(output);
     }
 
-    Imp(QGuiApplication& parent, App& app, OTWrap& me, int& argc, char** argv)
+    Imp(QCoreApplication& parent, App& app, OTWrap& me, int& argc, char** argv)
         : parent_(me)
         , callback_(app)
         , caller_()
-        , ot_(ot::InitContext(
-              make_args(parent, argc, argv),
-              [this]() -> auto {
-                  caller_.SetCallback(&callback_);
-                  return &caller_;
-              }()))
+        , ot_(util::Profiler::Measure(
+              "ot::InitContext",
+              [&]() -> const opentxs::api::Context& {
+                  return ot::InitContext(
+                      make_args(parent, argc, argv), [this]() -> auto {
+                          caller_.SetCallback(&callback_);
+                          return &caller_;
+                      }());
+              }))
+        , refresh_([this] { api_.OTX().Refresh(); })
+        , locks_()
+        , sync_([this](const auto& status) { publish_sync(status); })
+        , rpc_extension_(ot_, refresh_, locks_, sync_)
+        , rpc_queue_(rpc_config(argc, argv))
         , rpc_cb_(zmq::ListenCallback::Factory([this](auto& in) { rpc(in); }))
         , rpc_socket_([this] {
             using Dir = zmq::socket::Socket::Direction;
@@ -640,53 +953,54 @@ public:
 
             return out;
         }())
-        , api_(ot_.StartClient(ot_args_, 0))
-        , introduction_notary_id_([&] {
-            try {
-                const auto contract =
-                    import_contract(introduction_notary_contract_);
-                auto out = api_.Factory().ServerID();
-                out->Assign(contract->ID()->Bytes());
-
-                return out;
-            } catch (...) {
-
-                return api_.Factory().ServerID();
+        , event_feed_(ot_)
+        , api_(util::Profiler::Measure(
+              "StartClient",
+              [&]() -> const opentxs::api::client::Manager& {
+                  return ot_.StartClient(ot_args_, 0);
+              }))
+        , metadata_(data_folder() + "/metier.cache")
+        , registration_(data_folder() + "/metier.registration")
+        , registration_cb_(zmq::ListenCallback::Factory([this](auto& in) {
+            // NOTE the first frame of a nym or notary update is its id
+            const auto body = in.Body();
+
+            if (0u < body.size()) {
+                registration_.invalidate(std::string{body.at(0).Bytes()});
             }
-        }())
-        , messaging_notary_id_([&] {
-            try {
-                const auto contract =
-                    import_contract(messaging_notary_contract_);
-                auto out = api_.Factory().ServerID();
-                out->Assign(contract->ID()->Bytes());
+        }))
+        , registration_socket_([this] {
+            auto out = ot_.ZMQ().SubscribeSocket(registration_cb_);
+            const auto& endpoints = api_.Endpoints();
 
-                return out;
-            } catch (...) {
-
-                return api_.Factory().ServerID();
+            if (false == out->Start(endpoints.NymDownload())) {
+                qWarning() << "Failed to subscribe to nym updates";
             }
-        }())
-        , seed_id_()
-        , nym_id_(api_.Factory().NymID())
-        , longest_seed_word_([&]() -> auto {
-            const auto& api = api_.Seeds();
-            auto output = int{};
-            const auto types = api.AllowedSeedTypes();
-
-            for (const auto& [style, description] : types) {
-                const auto langs = api.AllowedLanguages(style);
 
-                for (const auto& [lang, name] : langs) {
-                    output = std::max(
-                        output, static_cast<int>(api.LongestWord(style, lang)));
-                }
+            if (false == out->Start(endpoints.ServerUpdate())) {
+                qWarning() << "Failed to subscribe to notary updates";
             }
 
-            return output;
+            return out;
         }())
-        , lock_()
+        , pending_{
+              std::async(
+                  std::launch::async,
+                  [this] {
+                      return import_notary(
+                          "import_contract introduction notary",
+                          introduction_notary_contract_);
+                  }),
+              std::async(
+                  std::launch::async,
+                  [this] {
+                      return import_notary(
+                          "import_contract messaging notary",
+                          messaging_notary_contract_);
+                  }),
+              std::async(std::launch::async, [this] { return longest_word(); })}
         , enabled_chains_([&] {
+            const auto span = util::Profiler::Span{"BlockchainSelectionQt"};
             auto* full =
                 api_.UI().BlockchainSelectionQt(ot::ui::Blockchains::All);
             auto* main =
@@ -699,8 +1013,14 @@ public:
             OT_ASSERT(nullptr != test);
 
             using Model = ot::ui::BlockchainSelectionQt;
+            // NOTE queued so that no selection model signal is handled until
+            // construction is complete and the event loop is running
             connect(
-                full, &Model::enabledChanged, [&](int c) { check_chains(c); });
+                full,
+                &Model::enabledChanged,
+                &me,
+                [&](int c) { check_chains(c); },
+                Qt::QueuedConnection);
             connect(full, &Model::chainEnabled, [&](const int chain) {
                 enabled_chains_.add(static_cast<ot::blockchain::Type>(chain));
             });
@@ -713,28 +1033,111 @@ public:
         }())
         , seed_type_(std::make_unique<model::SeedType>(
               &parent,
-              transform<model::SeedType::Data>(
-                  api_.Seeds().AllowedSeedTypes())))
+              metadata_.table("seed_types", [&] {
+                  return transform<model::SeedType::Data>(
+                      api_.Seeds().AllowedSeedTypes());
+              })))
+        , introduction_notary_id_(pending_.introduction_notary_.get())
+        , messaging_notary_id_(pending_.messaging_notary_.get())
+        , identity_(api_.Factory().NymID())
+        , introduction_nym_()
+        , longest_seed_word_(pending_.longest_seed_word_.get())
         , seed_language_()
         , seed_size_()
         , account_list_()
         , mainnet_model_(std::make_unique<model::BlockchainChooser>(
               api_.UI().BlockchainSelectionQt(ot::ui::Blockchains::Main)))
+        , phase_(Phase::context)
+        , chain_timeout_()
+        , account_ids_()
+        , jobs_(1)
+        , lookups_(2)
         , qt_parent_(parent)
     {
         OT_ASSERT(seed_type_);
 
+        chain_timeout_.setSingleShot(true);
+        chain_timeout_.setInterval(std::chrono::minutes{1});
+        connect(&chain_timeout_, &QTimer::timeout, [] {
+            qFatal("Timeout waiting for enabled blockchain");
+        });
+
         Ownership::Claim(mainnet_model_.get());
         Ownership::Claim(seed_type_.get());
         check_introduction_notary();
-        ready(true);
     }
 
-    ~Imp() { rpc_socket_->Close(); }
+    ~Imp()
+    {
+        lookups_.stop();
+        jobs_.stop();
+        rpc_queue_.stop();
+        rpc_socket_->Close();
+        registration_socket_->Close();
+    }
 
 private:
-    QGuiApplication& qt_parent_;
+    QCoreApplication& qt_parent_;
+
+    auto account_id(const int chain) noexcept -> ot::OTIdentifier
+    {
+        {
+            auto lock = Locks::Lock{locks_.account_ids()};
+
+            if (auto it = account_ids_.find(chain); account_ids_.end() != it) {
+                return it->second;
+            }
+        }
+
+        // NOTE not cached while the account does not exist so a later
+        // request picks up the account once it has been created
+        const auto& account =
+            api_.Blockchain().Account(identity_.nym(), util::convert(chain));
+        auto id = ot::OTIdentifier{account.AccountID()};
+
+        if (id->empty()) { return id; }
 
+        auto lock = Locks::Lock{locks_.account_ids()};
+        account_ids_.try_emplace(chain, id);
+
+        return id;
+    }
+    auto have_account_id(const int chain) const noexcept -> bool
+    {
+        auto lock = Locks::Lock{locks_.account_ids()};
+
+        return 0 < account_ids_.count(chain);
+    }
+    // NOTE only called on the Qt thread, once per sync_ frame
+    auto publish_sync(const SyncMonitor::Status& status) noexcept -> void
+    {
+        for (const auto& progress : status.chains_) {
+            if (false == progress.changed_) { continue; }
+
+            emit parent_.syncProgressChanged(
+                progress.chain_,
+                progress.current_,
+                progress.target_,
+                progress.rate_,
+                static_cast<int>(progress.eta_));
+            auto out = boost::json::object{};
+            out["chain"] = progress.chain_;
+            out["account"] = progress.account_;
+            out["progress"] = progress.current_;
+            out["target"] = progress.target_;
+            out["rate"] = progress.rate_;
+            out["eta"] = progress.eta_;
+            event_feed_.publish(rpc::event_sync_, out);
+        }
+
+        const auto& total = status.total_;
+        emit parent_.syncProgressChanged(
+            total.chain_,
+            total.current_,
+            total.target_,
+            total.rate_,
+            static_cast<int>(total.eta_));
+    }
     auto check_introduction_notary() const noexcept -> void
     {
         if (introduction_notary_id_->empty()) { return; }
@@ -743,47 +1146,98 @@ private:
             api_.Wallet().Server(introduction_notary_id_));
     }
 
+    // NOTE confirmed state is recorded in registration_ so once everything
+    // has been confirmed a check performs no wallet writes and contacts no
+    // notary. Only called with the registration lock held.
     auto check_registration() const noexcept -> bool
     {
-        if (nym_id_->empty()) { return false; }
+        const auto id = identity_.nym();
+
+        if (id->empty()) { return false; }
         if (messaging_notary_id_->empty()) { return false; }
 
-        {
-            const auto reason = api_.Factory().PasswordPrompt(
-                "Checking or updating public contact data");
-            auto nym = api_.Wallet().mutable_Nym(nym_id_, reason);
-            const auto notary = nym.PreferredOTServer();
-
-            if (notary.empty()) {
-                nym.AddPreferredOTServer(
-                    messaging_notary_id_->str(), true, reason);
-            }
-        }
+        const auto nymID = id->str();
+
+        // NOTE the preferred notary is only recorded once the nym is known to
+        // have one so a failed update is retried by the next check
+        const auto preferred = [&]() -> bool {
+            if (registration_.has_preferred(nymID)) { return true; }
+
+            const auto current = [&] {
+                const auto nym = api_.Wallet().Nym(id);
+
+                return nym ? nym->Claims().PreferredOTServer()->str()
+                           : std::string{};
+            }();
+            const auto set = [&]() -> bool {
+                if (false == current.empty()) { return true; }
+
+                try {
+                    const auto reason = api_.Factory().PasswordPrompt(
+                        "Checking or updating public contact data");
+                    auto nym = api_.Wallet().mutable_Nym(id, reason);
+
+                    if (false == nym.PreferredOTServer().empty()) {
+                        return true;
+                    }
+
+                    return nym.AddPreferredOTServer(
+                        messaging_notary_id_->str(), true, reason);
+                } catch (...) {
+
+                    return false;
+                }
+            }();
+
+            if (set) { registration_.set_preferred(nymID); }
+
+            return set;
+        }();
 
         const auto isRegistered = [&](const auto& server) {
-            auto context = api_.Wallet().ServerContext(nym_id_, server);
+            auto context = api_.Wallet().ServerContext(id, server);
 
             if (context) { return (0 != context->Request()); }
 
             return false;
         };
+        // NOTE a registration request is not recorded as confirmed until a
+        // later check finds the server context
         const auto check = [&](const auto& server) {
-            if (false == isRegistered(server)) {
-                const auto [id, future] =
-                    api_.OTX().RegisterNym(nym_id_, server);
+            const auto notary = server->str();
+
+            if (registration_.is_registered(nymID, notary)) { return true; }
+
+            if (isRegistered(server)) {
+                registration_.set_registered(nymID, notary);
 
-                if (0 > id) { return false; }
+                return true;
             }
 
-            return true;
+            const auto [request, future] = api_.OTX().RegisterNym(id, server);
+
+            return 0 <= request;
         };
 
-        auto output = check(messaging_notary_id_);
+        auto output = preferred;
+        output &= check(messaging_notary_id_);
         output &= check(introduction_notary_id_);
 
         return output;
     }
 
+    // NOTE only called with the registration lock held
+    auto start_introduction_server() noexcept -> void
+    {
+        const auto id = identity_.nym();
+        auto nym = id->str();
+
+        if (nym == introduction_nym_) { return; }
+
+        api_.OTX().StartIntroductionServer(id);
+        introduction_nym_ = std::move(nym);
+    }
+
     auto import_contract(const char* text) const noexcept(false)
         -> ot::OTServerContract
     {
@@ -802,11 +1256,50 @@ private:
         return api_.Wallet().Server(proto->Bytes());
     }
 
+    auto import_notary(const char* name, const char* text) const noexcept
+        -> ot::OTServerID
+    {
+        const auto span = util::Profiler::Span{name};
+
+        try {
+            const auto contract = import_contract(text);
+            auto out = api_.Factory().ServerID();
+            out->Assign(contract->ID()->Bytes());
+
+            return out;
+        } catch (...) {
+
+            return api_.Factory().ServerID();
+        }
+    }
+    auto longest_word() const noexcept -> int
+    {
+        const auto span = util::Profiler::Span{"longest_seed_word"};
+
+        return metadata_.integer("longest_seed_word", [&] {
+            const auto& api = api_.Seeds();
+            auto output = int{};
+            const auto types = api.AllowedSeedTypes();
+
+            for (const auto& [style, description] : types) {
+                const auto langs = api.AllowedLanguages(style);
+
+                for (const auto& [lang, name] : langs) {
+                    output = std::max(
+                        output,
+                        static_cast<int>(api.LongestWord(style, lang)));
+                }
+            }
+
+            return output;
+        });
+    }
     auto make_accounts(const ot::blockchain::Type chain) const noexcept -> bool
     {
         using Chain = ot::blockchain::Type;
         using Protocol = ot::blockchain::crypto::HDProtocol;
 
+        const auto nym = identity_.nym();
         const auto want = [&] {
             auto out = std::set<Protocol>{};
             out.emplace(Protocol::BIP_44);
@@ -820,7 +1313,7 @@ private:
         }();
         const auto have = [&] {
             auto out = std::set<Protocol>{};
-            const auto& account = api_.Blockchain().Account(nym_id_, chain);
+            const auto& account = api_.Blockchain().Account(nym, chain);
 
             for (const auto& hd : account.GetHD()) {
                 out.emplace(hd.Standard());
@@ -839,6 +1332,9 @@ private:
 
             return out;
         }();
+        const auto total = static_cast<int>(need.size());
+        auto created = int{0};
+        emit parent_.accountProgress(static_cast<int>(chain), created, total);
 
         for (const auto& type : need) {
             const auto prompt = std::string{"Creating a new "} +
@@ -850,18 +1346,33 @@ private:
                     // TODO only do this if the primary seed is a pktwallet type
 
                     return api_.Blockchain().NewHDSubaccount(
-                        nym_id_, type, Chain::Bitcoin, chain, reason);
+                        nym, type, Chain::Bitcoin, chain, reason);
                 } else {
 
                     return api_.Blockchain().NewHDSubaccount(
-                        nym_id_, type, chain, reason);
+                        nym, type, chain, reason);
                 }
             }();
 
             if (id->empty()) { return false; }
+
+            emit parent_.accountProgress(
+                static_cast<int>(chain), ++created, total);
         }
 
         return true;
     }
+
+    // NOTE publishes events from the chain's account activity model on the
+    // rpc event socket and feeds its sync progress to sync_. Only called on
+    // the Qt thread.
+    auto watch(const ot::blockchain::Type chain) const noexcept -> void
+    {
+        const auto nym = identity_.nym();
+        const auto& account = api_.Blockchain().Account(nym, chain).AccountID();
+        auto* model = api_.UI().AccountActivityQt(nym, account);
+        event_feed_.watch(static_cast<int>(chain), account.str(), model);
+        sync_.watch(static_cast<int>(chain), account.str(), model);
+    }
 };
 }  // namespace metier
@@ -0,0 +1,114 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/locks.hpp"  // IWYU pragma: associated
+
+#include <tuple>
+
+namespace metier
+{
+InstrumentedMutex::InstrumentedMutex(const std::string& name) noexcept
+    : name_(name)
+    , mutex_()
+    , acquired_(0)
+    , contended_(0)
+    , waited_(0)
+    , longest_wait_(0)
+{
+}
+
+auto InstrumentedMutex::lock() noexcept -> void
+{
+    if (mutex_.try_lock()) {
+        ++acquired_;
+
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    mutex_.lock();
+    const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                          Clock::now() - start)
+                          .count();
+    ++acquired_;
+    ++contended_;
+    waited_ += wait;
+    auto longest = longest_wait_.load();
+
+    while ((wait > longest) &&
+           (false == longest_wait_.compare_exchange_weak(longest, wait))) {
+    }
+}
+
+auto InstrumentedMutex::stats() const noexcept -> Stats
+{
+    return {
+        name_,
+        acquired_.load(),
+        contended_.load(),
+        std::chrono::microseconds{waited_.load()},
+        std::chrono::microseconds{longest_wait_.load()}};
+}
+
+auto InstrumentedMutex::try_lock() noexcept -> bool
+{
+    if (mutex_.try_lock()) {
+        ++acquired_;
+
+        return true;
+    }
+
+    return false;
+}
+
+auto InstrumentedMutex::unlock() noexcept -> void { mutex_.unlock(); }
+
+Locks::Locks() noexcept
+    : account_ids_("account_ids")
+    , identity_("identity")
+    , registration_("registration")
+    , seed_language_("seed_language")
+    , seed_size_("seed_size")
+    , chain_lock_()
+    , chains_()
+{
+}
+
+auto Locks::chain(const int chain) const noexcept -> InstrumentedMutex&
+{
+    auto lock = std::lock_guard<std::mutex>{chain_lock_};
+    auto it = chains_.find(chain);
+
+    if (chains_.end() == it) {
+        it = chains_
+                 .emplace(
+                     std::piecewise_construct,
+                     std::forward_as_tuple(chain),
+                     std::forward_as_tuple(
+                         "chain_" + std::to_string(chain)))
+                 .first;
+    }
+
+    return it->second;
+}
+
+auto Locks::stats() const noexcept -> StatsList
+{
+    auto output = StatsList{
+        account_ids_.stats(),
+        identity_.stats(),
+        registration_.stats(),
+        seed_language_.stats(),
+        seed_size_.stats()};
+    auto lock = std::lock_guard<std::mutex>{chain_lock_};
+
+    for (const auto& [chain, mutex] : chains_) {
+        output.emplace_back(mutex.stats());
+    }
+
+    return output;
+}
+}  // namespace metier
@@ -0,0 +1,107 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace metier
+{
+// NOTE a mutex which counts how often it was taken, how often the caller had
+// to wait for it and for how long. Meets the Lockable requirements so it can
+// be used with std::lock_guard and std::unique_lock.
+class InstrumentedMutex
+{
+public:
+    struct Stats {
+        std::string name_{};
+        std::uint64_t acquired_{0};
+        std::uint64_t contended_{0};
+        std::chrono::microseconds waited_{};
+        std::chrono::microseconds longest_wait_{};
+    };
+
+    auto lock() noexcept -> void;
+    auto stats() const noexcept -> Stats;
+    auto try_lock() noexcept -> bool;
+    auto unlock() noexcept -> void;
+
+    InstrumentedMutex(const std::string& name) noexcept;
+
+private:
+    const std::string name_;
+    std::mutex mutex_;
+    std::atomic<std::uint64_t> acquired_;
+    std::atomic<std::uint64_t> contended_;
+    std::atomic<std::int64_t> waited_;
+    std::atomic<std::int64_t> longest_wait_;
+
+    InstrumentedMutex() = delete;
+    InstrumentedMutex(const InstrumentedMutex&) = delete;
+    InstrumentedMutex(InstrumentedMutex&&) = delete;
+    auto operator=(const InstrumentedMutex&) -> InstrumentedMutex& = delete;
+    auto operator=(InstrumentedMutex&&) -> InstrumentedMutex& = delete;
+};
+
+// NOTE every lock used by OTWrap. Each one protects a single resource so a
+// long running operation never delays an unrelated reader.
+class Locks
+{
+public:
+    using Lock = std::unique_lock<InstrumentedMutex>;
+    using StatsList = std::vector<InstrumentedMutex::Stats>;
+
+    // NOTE the cache of blockchain account ids
+    auto account_ids() const noexcept -> InstrumentedMutex&
+    {
+        return account_ids_;
+    }
+    // NOTE account provisioning, one lock per blockchain
+    auto chain(const int chain) const noexcept -> InstrumentedMutex&;
+    // NOTE seed and nym selection or creation
+    auto identity() const noexcept -> InstrumentedMutex&
+    {
+        return identity_;
+    }
+    // NOTE notary registration and the introduction server
+    auto registration() const noexcept -> InstrumentedMutex&
+    {
+        return registration_;
+    }
+    // NOTE the seed language model cache
+    auto seed_language() const noexcept -> InstrumentedMutex&
+    {
+        return seed_language_;
+    }
+    // NOTE the seed size model cache
+    auto seed_size() const noexcept -> InstrumentedMutex&
+    {
+        return seed_size_;
+    }
+    auto stats() const noexcept -> StatsList;
+
+    Locks() noexcept;
+
+private:
+    mutable InstrumentedMutex account_ids_;
+    mutable InstrumentedMutex identity_;
+    mutable InstrumentedMutex registration_;
+    mutable InstrumentedMutex seed_language_;
+    mutable InstrumentedMutex seed_size_;
+    mutable std::mutex chain_lock_;
+    mutable std::map<int, InstrumentedMutex> chains_;
+
+    Locks(const Locks&) = delete;
+    Locks(Locks&&) = delete;
+    auto operator=(const Locks&) -> Locks& = delete;
+    auto operator=(Locks&&) -> Locks& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,128 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/metadatacache.hpp"  // IWYU pragma: associated
+
+#include <QDebug>
+#include <QSettings>
+#include <QString>
+#include <QVariant>
+#include <mutex>
+
+namespace metier
+{
+constexpr auto version_key_{"version"};
+constexpr auto name_key_{"name"};
+constexpr auto value_key_{"value"};
+
+struct MetadataCache::Imp {
+    using Lock = std::lock_guard<std::mutex>;
+
+    auto integer(const QString& key, const IntegerSource& calculate) noexcept
+        -> int
+    {
+        auto lock = Lock{lock_};
+        const auto cached = settings_.value(key);
+
+        if (cached.isValid()) {
+            auto ok{false};
+            const auto output = cached.toInt(&ok);
+
+            if (ok) { return output; }
+        }
+
+        const auto output = calculate();
+        settings_.setValue(key, output);
+        settings_.sync();
+
+        return output;
+    }
+    auto table(const QString& key, const TableSource& calculate) noexcept
+        -> Table
+    {
+        auto lock = Lock{lock_};
+
+        // NOTE an empty table is never stored so a missing array always
+        // means the table has not been calculated yet
+        if (const auto size = settings_.beginReadArray(key); 0 < size) {
+            auto output = Table{};
+            output.reserve(static_cast<std::size_t>(size));
+
+            for (auto i{0}; i < size; ++i) {
+                settings_.setArrayIndex(i);
+                output.emplace_back(
+                    settings_.value(name_key_).toString().toStdString(),
+                    settings_.value(value_key_).toInt());
+            }
+
+            settings_.endArray();
+
+            return output;
+        }
+
+        settings_.endArray();
+        const auto output = calculate();
+
+        if (output.empty()) { return output; }
+
+        settings_.beginWriteArray(key, static_cast<int>(output.size()));
+        auto i{0};
+
+        for (const auto& [name, value] : output) {
+            settings_.setArrayIndex(i++);
+            settings_.setValue(name_key_, QString::fromStdString(name));
+            settings_.setValue(value_key_, value);
+        }
+
+        settings_.endArray();
+        settings_.sync();
+
+        return output;
+    }
+
+    Imp(const QString& path) noexcept
+        : lock_()
+        , settings_(path, QSettings::IniFormat)
+    {
+        const auto version = QString::fromStdString(Version());
+
+        if (settings_.value(version_key_).toString() != version) {
+            qDebug() << QString("Rebuilding metadata cache at %1").arg(path);
+            settings_.clear();
+            settings_.setValue(version_key_, version);
+            settings_.sync();
+        }
+    }
+
+private:
+    std::mutex lock_;
+    QSettings settings_;
+};
+
+MetadataCache::MetadataCache(const QString& path) noexcept
+    : imp_(std::make_unique<Imp>(path))
+{
+}
+
+auto MetadataCache::integer(const QString& key, const IntegerSource& calculate)
+    const noexcept -> int
+{
+    return imp_->integer(key, calculate);
+}
+
+auto MetadataCache::table(const QString& key, const TableSource& calculate)
+    const noexcept -> Table
+{
+    return imp_->table(key, calculate);
+}
+
+auto MetadataCache::Version() noexcept -> std::string
+{
+    return std::string{METIER_VERSION_STRING} + '/' +
+           std::string{METIER_OPENTXS_VERSION};
+}
+
+MetadataCache::~MetadataCache() = default;
+}  // namespace metier
@@ -0,0 +1,51 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class QString;
+
+namespace metier
+{
+// NOTE values which only change when opentxs changes are stored in a file in
+// the opentxs data folder. The file records the version it was written by and
+// is discarded automatically when that version does not match the running
+// build. Values missing from the file are calculated and then stored.
+class MetadataCache
+{
+public:
+    using Table = std::vector<std::pair<std::string, int>>;
+    using IntegerSource = std::function<int()>;
+    using TableSource = std::function<Table()>;
+
+    static auto Version() noexcept -> std::string;
+
+    auto integer(const QString& key, const IntegerSource& calculate)
+        const noexcept -> int;
+    auto table(const QString& key, const TableSource& calculate) const noexcept
+        -> Table;
+
+    MetadataCache(const QString& path) noexcept;
+
+    ~MetadataCache();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    MetadataCache() = delete;
+    MetadataCache(const MetadataCache&) = delete;
+    MetadataCache(MetadataCache&&) = delete;
+    auto operator=(const MetadataCache&) -> MetadataCache& = delete;
+    auto operator=(MetadataCache&&) -> MetadataCache& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,126 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/refreshscheduler.hpp"  // IWYU pragma: associated
+
+#include <QMetaObject>
+#include <QTimer>
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+namespace metier
+{
+struct RefreshScheduler::Imp {
+    using Milliseconds = std::chrono::milliseconds;
+    using SystemClock = std::chrono::system_clock;
+
+    static constexpr auto jitter_percent_ = 10;
+
+    auto activity() noexcept -> void
+    {
+        active_ = true;
+
+        if (false == started_) { return; }
+
+        // NOTE a pending run further away than the minimum interval is
+        // brought forward so activity is picked up promptly
+        QMetaObject::invokeMethod(
+            &timer_,
+            [this] {
+                const auto minimum = Milliseconds{minimum_interval_}.count();
+
+                if (timer_.remainingTime() > minimum) {
+                    arm(minimum_interval_);
+                }
+            },
+            Qt::QueuedConnection);
+    }
+    auto start() noexcept -> void
+    {
+        if (started_.exchange(true)) { return; }
+
+        QMetaObject::invokeMethod(
+            &timer_, [this] { arm(minimum_interval_); }, Qt::QueuedConnection);
+    }
+    auto status() const noexcept -> Status
+    {
+        return {
+            started_,
+            Milliseconds{interval_.load()},
+            last_run_.load(),
+            next_run_.load()};
+    }
+
+    Imp(Callback&& refresh) noexcept
+        : refresh_(std::move(refresh))
+        , started_(false)
+        , active_(false)
+        , interval_(Milliseconds{minimum_interval_}.count())
+        , last_run_(0)
+        , next_run_(0)
+        , rng_(std::random_device{}())
+        , timer_()
+    {
+        timer_.setSingleShot(true);
+        QObject::connect(&timer_, &QTimer::timeout, [this] { run(); });
+    }
+
+private:
+    const Callback refresh_;
+    std::atomic_bool started_;
+    std::atomic_bool active_;
+    std::atomic<std::int64_t> interval_;
+    std::atomic<std::int64_t> last_run_;
+    std::atomic<std::int64_t> next_run_;
+    std::minstd_rand rng_;
+    QTimer timer_;
+
+    static auto now() noexcept -> std::int64_t
+    {
+        return SystemClock::to_time_t(SystemClock::now());
+    }
+
+    // NOTE only called on the Qt thread
+    auto arm(const Milliseconds interval) noexcept -> void
+    {
+        const auto base = interval.count();
+        auto jitter = std::uniform_int_distribution<std::int64_t>{
+            -base * jitter_percent_ / 100, base * jitter_percent_ / 100};
+        const auto delay = base + jitter(rng_);
+        interval_ = base;
+        next_run_ = now() + (delay / 1000);
+        timer_.start(static_cast<int>(delay));
+    }
+    auto run() noexcept -> void
+    {
+        refresh_();
+        last_run_ = now();
+
+        if (active_.exchange(false)) {
+            arm(minimum_interval_);
+        } else {
+            arm(std::min<Milliseconds>(
+                Milliseconds{interval_.load() * 2}, maximum_interval_));
+        }
+    }
+};
+
+RefreshScheduler::RefreshScheduler(Callback&& refresh) noexcept
+    : imp_(std::make_unique<Imp>(std::move(refresh)))
+{
+}
+
+auto RefreshScheduler::activity() const noexcept -> void { imp_->activity(); }
+
+auto RefreshScheduler::start() const noexcept -> void { imp_->start(); }
+
+auto RefreshScheduler::status() const noexcept -> Status
+{
+    return imp_->status();
+}
+
+RefreshScheduler::~RefreshScheduler() = default;
+}  // namespace metier
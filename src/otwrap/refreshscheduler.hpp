@@ -0,0 +1,55 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace metier
+{
+// NOTE runs a single recurring refresh job no matter how many times start is
+// called. The interval drops to the minimum whenever activity is reported and
+// doubles after every idle run up to the maximum. Each run is offset by a
+// random jitter so that wallets started together do not refresh together.
+// Must be constructed on the Qt thread; every other function may be called
+// from any thread.
+class RefreshScheduler
+{
+public:
+    using Callback = std::function<void()>;
+
+    struct Status {
+        bool started_{false};
+        std::chrono::milliseconds interval_{};
+        std::int64_t last_run_{0};
+        std::int64_t next_run_{0};
+    };
+
+    static constexpr auto minimum_interval_ = std::chrono::seconds{30};
+    static constexpr auto maximum_interval_ = std::chrono::minutes{8};
+
+    auto activity() const noexcept -> void;
+    auto start() const noexcept -> void;
+    auto status() const noexcept -> Status;
+
+    RefreshScheduler(Callback&& refresh) noexcept;
+
+    ~RefreshScheduler();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    RefreshScheduler() = delete;
+    RefreshScheduler(const RefreshScheduler&) = delete;
+    RefreshScheduler(RefreshScheduler&&) = delete;
+    auto operator=(const RefreshScheduler&) -> RefreshScheduler& = delete;
+    auto operator=(RefreshScheduler&&) -> RefreshScheduler& = delete;
+};
+}  // namespace metier
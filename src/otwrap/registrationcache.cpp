@@ -0,0 +1,165 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/registrationcache.hpp"  // IWYU pragma: associated
+
+#include <QSettings>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace metier
+{
+constexpr auto preferred_key_{"preferred"};
+constexpr auto notaries_key_{"notaries"};
+
+struct RegistrationCache::Imp {
+    using Lock = std::lock_guard<std::mutex>;
+
+    auto has_preferred(const std::string& nym) const noexcept -> bool
+    {
+        auto lock = Lock{lock_};
+        const auto it = nyms_.find(nym);
+
+        return (nyms_.end() != it) && it->second.preferred_;
+    }
+    auto invalidate(const std::string& id) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        auto modified{false};
+
+        for (auto& [nym, entry] : nyms_) {
+            auto changed = (0 < entry.notaries_.erase(id));
+
+            if ((nym == id) && entry.preferred_) {
+                entry.preferred_ = false;
+                changed = true;
+            }
+
+            if (changed) {
+                save(nym, entry);
+                modified = true;
+            }
+        }
+
+        if (modified) { settings_.sync(); }
+    }
+    auto is_registered(const std::string& nym, const std::string& notary)
+        const noexcept -> bool
+    {
+        auto lock = Lock{lock_};
+        const auto it = nyms_.find(nym);
+
+        return (nyms_.end() != it) && (0 < it->second.notaries_.count(notary));
+    }
+    auto set_preferred(const std::string& nym) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        auto& entry = nyms_[nym];
+
+        if (entry.preferred_) { return; }
+
+        entry.preferred_ = true;
+        save(nym, entry);
+        settings_.sync();
+    }
+    auto set_registered(const std::string& nym, const std::string& notary)
+        noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        auto& entry = nyms_[nym];
+
+        if (false == entry.notaries_.emplace(notary).second) { return; }
+
+        save(nym, entry);
+        settings_.sync();
+    }
+
+    Imp(const QString& path) noexcept
+        : lock_()
+        , settings_(path, QSettings::IniFormat)
+        , nyms_()
+    {
+        for (const auto& group : settings_.childGroups()) {
+            settings_.beginGroup(group);
+            auto& entry = nyms_[group.toStdString()];
+            entry.preferred_ = settings_.value(preferred_key_).toBool();
+
+            for (const auto& notary :
+                 settings_.value(notaries_key_).toStringList()) {
+                entry.notaries_.emplace(notary.toStdString());
+            }
+
+            settings_.endGroup();
+        }
+    }
+
+private:
+    struct Entry {
+        bool preferred_{false};
+        std::set<std::string> notaries_{};
+    };
+
+    mutable std::mutex lock_;
+    QSettings settings_;
+    std::map<std::string, Entry> nyms_;
+
+    auto save(const std::string& nym, const Entry& entry) noexcept -> void
+    {
+        auto notaries = QStringList{};
+
+        for (const auto& notary : entry.notaries_) {
+            notaries.append(QString::fromStdString(notary));
+        }
+
+        settings_.beginGroup(QString::fromStdString(nym));
+        settings_.setValue(preferred_key_, entry.preferred_);
+        settings_.setValue(notaries_key_, notaries);
+        settings_.endGroup();
+    }
+};
+
+RegistrationCache::RegistrationCache(const QString& path) noexcept
+    : imp_(std::make_unique<Imp>(path))
+{
+}
+
+auto RegistrationCache::has_preferred(const std::string& nym) const noexcept
+    -> bool
+{
+    return imp_->has_preferred(nym);
+}
+
+auto RegistrationCache::invalidate(const std::string& id) const noexcept
+    -> void
+{
+    imp_->invalidate(id);
+}
+
+auto RegistrationCache::is_registered(
+    const std::string& nym,
+    const std::string& notary) const noexcept -> bool
+{
+    return imp_->is_registered(nym, notary);
+}
+
+auto RegistrationCache::set_preferred(const std::string& nym) const noexcept
+    -> void
+{
+    imp_->set_preferred(nym);
+}
+
+auto RegistrationCache::set_registered(
+    const std::string& nym,
+    const std::string& notary) const noexcept -> void
+{
+    imp_->set_registered(nym, notary);
+}
+
+RegistrationCache::~RegistrationCache() = default;
+}  // namespace metier
@@ -0,0 +1,48 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+class QString;
+
+namespace metier
+{
+// NOTE remembers which nyms are known to have a preferred notary and which
+// notaries each nym is known to be registered on. The state is kept in memory
+// and written through to a file in the opentxs data folder so that it
+// survives restarts. Only confirmed state is recorded: anything missing must
+// be checked against the wallet.
+class RegistrationCache
+{
+public:
+    auto has_preferred(const std::string& nym) const noexcept -> bool;
+    // NOTE an id which belongs to a nym clears its preferred notary state. An
+    // id which belongs to a notary clears every registration on it.
+    auto invalidate(const std::string& id) const noexcept -> void;
+    auto is_registered(const std::string& nym, const std::string& notary)
+        const noexcept -> bool;
+    auto set_preferred(const std::string& nym) const noexcept -> void;
+    auto set_registered(const std::string& nym, const std::string& notary)
+        const noexcept -> void;
+
+    RegistrationCache(const QString& path) noexcept;
+
+    ~RegistrationCache();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    RegistrationCache() = delete;
+    RegistrationCache(const RegistrationCache&) = delete;
+    RegistrationCache(RegistrationCache&&) = delete;
+    auto operator=(const RegistrationCache&) -> RegistrationCache& = delete;
+    auto operator=(RegistrationCache&&) -> RegistrationCache& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,467 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/rpcextension.hpp"  // IWYU pragma: associated
+
+#include <boost/container/flat_map.hpp>
+#include <boost/json.hpp>
+#include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "otwrap/locks.hpp"
+#include "otwrap/refreshscheduler.hpp"
+#include "otwrap/syncmonitor.hpp"
+#include "rpc/protocol.hpp"
+
+namespace ot = opentxs;
+namespace json = boost::json;
+
+namespace metier
+{
+struct RPCExtension::Imp {
+    using Handler = void (Imp::*)(const json::object&, json::object&) const;
+    using Reply = std::unique_ptr<ot::rpc::response::Base>;
+    using Position = std::pair<std::int64_t, std::string>;
+
+    struct Method {
+        Handler handler_;
+        bool read_only_;
+    };
+
+    using Map = boost::container::flat_map<std::string_view, Method>;
+
+    static auto methods() noexcept -> const Map&
+    {
+        static const auto map = Map{
+            {rpc::method_accounts_, {&Imp::accounts, true}},
+            {rpc::method_activity_, {&Imp::activity, true}},
+            {rpc::method_lock_stats_, {&Imp::lock_stats, true}},
+            {rpc::method_nyms_, {&Imp::nyms, true}},
+            {rpc::method_refresh_status_, {&Imp::refresh_status, true}},
+            {rpc::method_send_payment_, {&Imp::send_payment, false}},
+            {rpc::method_sync_status_, {&Imp::sync_status, true}},
+        };
+
+        return map;
+    }
+
+    auto process(const std::string_view method, const std::string_view params)
+        const noexcept -> std::string
+    {
+        auto out = json::object{};
+
+        try {
+            const auto& map = methods();
+            const auto it = map.find(method);
+
+            if (map.end() == it) {
+                throw std::runtime_error{"unknown method"};
+            }
+
+            const auto args = json::parse(params);
+            (this->*(it->second.handler_))(args.as_object(), out);
+        } catch (const std::exception& e) {
+            out = json::object{};
+            out["error"] = e.what();
+        }
+
+        return json::serialize(out);
+    }
+
+    Imp(const ot::api::Context& ot,
+        const RefreshScheduler& refresh,
+        const Locks& locks,
+        const SyncMonitor& sync) noexcept
+        : ot_(ot)
+        , refresh_(refresh)
+        , locks_(locks)
+        , sync_(sync)
+    {
+    }
+
+private:
+    const ot::api::Context& ot_;
+    const RefreshScheduler& refresh_;
+    const Locks& locks_;
+    const SyncMonitor& sync_;
+
+    // NOTE cursors are opaque to clients. They encode the position of the
+    // last event returned as <nanoseconds since epoch>:<event id>.
+    static auto decode(const std::string_view cursor) noexcept(false)
+        -> Position
+    {
+        const auto split = cursor.find(':');
+
+        if (std::string_view::npos == split) {
+            throw std::runtime_error{"invalid cursor"};
+        }
+
+        try {
+
+            return {
+                std::stoll(std::string{cursor.substr(0, split)}),
+                std::string{cursor.substr(split + 1u)}};
+        } catch (...) {
+            throw std::runtime_error{"invalid cursor"};
+        }
+    }
+    static auto encode(const Position& position) noexcept -> std::string
+    {
+        return std::to_string(position.first) + ':' + position.second;
+    }
+    static auto position(const ot::rpc::AccountEvent& event) noexcept
+        -> Position
+    {
+        using Nanoseconds = std::chrono::nanoseconds;
+
+        return {
+            std::chrono::duration_cast<Nanoseconds>(
+                event.Timestamp().time_since_epoch())
+                .count(),
+            event.UUID()};
+    }
+    static auto text(const json::object& params, const std::string_view key)
+        noexcept(false) -> std::string
+    {
+        return std::string{params.at(key).as_string()};
+    }
+    static auto session(const json::object& params) noexcept(false) -> int
+    {
+        if (const auto* value = params.if_contains(rpc::param_session_);
+            nullptr != value) {
+
+            return static_cast<int>(value->as_int64());
+        }
+
+        return 0;
+    }
+
+    // NOTE executes an opentxs rpc command in process, which is the same path
+    // the router socket uses but without any serialization to a client
+    auto call(const ot::rpc::request::Base& request) const noexcept(false)
+        -> Reply
+    {
+        auto command = ot::Space{};
+        auto response = ot::Space{};
+
+        if (false == request.Serialize(ot::writer(command))) {
+            throw std::runtime_error{"failed to serialize rpc command"};
+        }
+
+        if (false == ot_.RPC(ot::reader(command), ot::writer(response))) {
+            throw std::runtime_error{"rpc command failed"};
+        }
+
+        auto out = ot::rpc::response::Factory(ot::reader(response));
+
+        if (!out) { throw std::runtime_error{"invalid rpc response"}; }
+
+        return out;
+    }
+
+    // NOTE combines ListAccounts and GetAccountBalance so the client needs a
+    // single round trip and the account id list never leaves the process
+    auto accounts(const json::object& params, json::object& out) const
+        noexcept(false) -> void
+    {
+        const auto index = session(params);
+        const auto ids = [&] {
+            const auto reply = call(ot::rpc::request::ListAccounts{index});
+            auto output = reply->asListAccounts().AccountIDs();
+
+            return output;
+        }();
+        auto accounts = json::array{};
+
+        if (false == ids.empty()) {
+            const auto reply = call(ot::rpc::request::GetAccountBalance{
+                index, ot::rpc::request::Base::Identifiers{ids}});
+            const auto& balances = reply->asGetAccountBalance().Balances();
+
+            for (const auto& balance : balances) {
+                auto account = json::object{};
+                account["id"] = balance.ID();
+                account["style"] = ot::print(balance.Type());
+                account["name"] = balance.Name();
+                account["owner"] = balance.Owner();
+                account["issuer"] = balance.Issuer();
+                account["contract"] = balance.Unit();
+                account["confirmed"] = balance.ConfirmedBalance_str();
+                account["pending"] = balance.PendingBalance_str();
+                // TODO account type
+                accounts.emplace_back(std::move(account));
+            }
+        }
+
+        out.emplace("accounts", std::move(accounts));
+    }
+    // NOTE events are ordered by timestamp and then by id, so a cursor which
+    // names the last event a client received selects exactly the events it
+    // has not seen yet. An event recorded later with an earlier timestamp
+    // than the cursor is not returned.
+    auto activity(const json::object& params, json::object& out) const
+        noexcept(false) -> void
+    {
+        const auto index = session(params);
+        const auto account = text(params, rpc::param_account_);
+        const auto limit = [&] {
+            const auto* value = params.if_contains(rpc::param_limit_);
+
+            return (nullptr == value) ? std::size_t{0}
+                                      : value->to_number<std::size_t>();
+        }();
+        const auto since = [&]() -> std::optional<ot::Time> {
+            const auto* value = params.if_contains(rpc::param_since_);
+
+            if (nullptr == value) { return std::nullopt; }
+
+            return ot::Clock::from_time_t(value->to_number<std::time_t>());
+        }();
+        const auto* cursor = params.if_contains(rpc::param_cursor_);
+        const auto after = [&]() -> std::optional<Position> {
+            if (nullptr == cursor) { return std::nullopt; }
+
+            return decode(cursor->as_string());
+        }();
+        const auto reply = call(ot::rpc::request::GetAccountActivity{
+            index, ot::rpc::request::Base::Identifiers{account}});
+        auto events =
+            std::vector<std::pair<Position, const ot::rpc::AccountEvent*>>{};
+
+        for (const auto& event : reply->asGetAccountActivity().Activity()) {
+            if (since.has_value() && (event.Timestamp() < since.value())) {
+                continue;
+            }
+
+            auto key = position(event);
+
+            if (after.has_value() && (false == (after.value() < key))) {
+                continue;
+            }
+
+            events.emplace_back(std::move(key), &event);
+        }
+
+        const auto count =
+            (0u == limit) ? events.size() : std::min(limit, events.size());
+        const auto order = [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        };
+
+        // NOTE a request without a limit returns the complete history from
+        // one query so it is sorted once instead of once per page
+        if (count == events.size()) {
+            std::sort(events.begin(), events.end(), order);
+        } else {
+            std::partial_sort(
+                events.begin(),
+                std::next(events.begin(), count),
+                events.end(),
+                order);
+        }
+        auto transactions = json::array{};
+        transactions.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& event = *events.at(i).second;
+            auto tx = json::object{};
+            tx["id"] = event.UUID();
+            tx["timestamp"] = static_cast<std::int64_t>(
+                ot::Clock::to_time_t(event.Timestamp()));
+            tx["amount"] = event.ConfirmedAmount_str();
+            transactions.emplace_back(std::move(tx));
+        }
+
+        out["account"] = account;
+        out.emplace("transactions", std::move(transactions));
+
+        if (0u < count) {
+            out["cursor"] = encode(events.at(count - 1u).first);
+        } else if (nullptr != cursor) {
+            out["cursor"] = *cursor;
+        } else {
+            out["cursor"] = "";
+        }
+
+        out["more"] = (count < events.size());
+    }
+    // NOTE counters are cumulative since startup. A contended acquisition is
+    // one where the caller had to wait for another thread to release the lock.
+    auto lock_stats(
+        [[maybe_unused]] const json::object& params,
+        json::object& out) const noexcept(false) -> void
+    {
+        const auto stats = locks_.stats();
+        auto locks = json::array{};
+        locks.reserve(stats.size());
+
+        for (const auto& lock : stats) {
+            auto item = json::object{};
+            item["name"] = lock.name_;
+            item["acquired"] = lock.acquired_;
+            item["contended"] = lock.contended_;
+            item["waited_us"] = lock.waited_.count();
+            item["longest_wait_us"] = lock.longest_wait_.count();
+            locks.emplace_back(std::move(item));
+        }
+
+        out.emplace("locks", std::move(locks));
+    }
+    auto nyms(const json::object& params, json::object& out) const
+        noexcept(false) -> void
+    {
+        const auto reply = call(ot::rpc::request::ListNyms{session(params)});
+        auto nyms = json::array{};
+
+        for (const auto& id : reply->asListNyms().NymIDs()) {
+            nyms.emplace_back(id);
+        }
+
+        out.emplace("nyms", std::move(nyms));
+    }
+    // NOTE times are seconds since the epoch and are zero until the first
+    // refresh has been scheduled or run
+    auto refresh_status(
+        [[maybe_unused]] const json::object& params,
+        json::object& out) const noexcept(false) -> void
+    {
+        const auto status = refresh_.status();
+        out["started"] = status.started_;
+        out["interval_ms"] = status.interval_.count();
+        out["last_run"] = status.last_run_;
+        out["next_run"] = status.next_run_;
+    }
+    auto send_payment(const json::object& params, json::object& out) const
+        noexcept(false) -> void
+    {
+        const auto reply = call(ot::rpc::request::SendPayment{
+            session(params),
+            text(params, rpc::param_from_),
+            text(params, rpc::param_to_),
+            params.at(rpc::param_amount_).to_number<std::int64_t>()});
+        const auto& sent = reply->asSendPayment();
+        const auto& codes = sent.ResponseCodes();
+
+        if (codes.empty()) {
+            throw std::runtime_error{"invalid rpc response"};
+        }
+
+        const auto& code = codes.front().second;
+        using Code = ot::rpc::ResponseCode;
+
+        switch (code) {
+            case Code::txid: {
+                out["txid"] = sent.Pending().front().second;
+            } break;
+            case Code::invalid:
+            case Code::success:
+            case Code::bad_session:
+            case Code::none:
+            case Code::queued:
+            case Code::unnecessary:
+            case Code::retry:
+            case Code::no_path_to_recipient:
+            case Code::bad_server_argument:
+            case Code::cheque_not_found:
+            case Code::payment_not_found:
+            case Code::start_task_failed:
+            case Code::nym_not_found:
+            case Code::add_claim_failed:
+            case Code::add_contact_failed:
+            case Code::register_account_failed:
+            case Code::bad_server_response:
+            case Code::workflow_not_found:
+            case Code::unit_definition_not_found:
+            case Code::session_not_found:
+            case Code::create_nym_failed:
+            case Code::create_unit_definition_failed:
+            case Code::delete_claim_failed:
+            case Code::account_not_found:
+            case Code::move_funds_failed:
+            case Code::register_nym_failed:
+            case Code::contact_not_found:
+            case Code::account_owner_not_found:
+            case Code::send_payment_failed:
+            case Code::transaction_failed:
+            case Code::unimplemented:
+            case Code::error:
+            default: {
+                out["error"] = ot::print(code).c_str();
+            }
+        }
+    }
+    // NOTE the total uses chain 0. Rates are in blocks per second and eta is
+    // the estimated number of seconds remaining, or -1 if unknown.
+    auto sync_status(
+        [[maybe_unused]] const json::object& params,
+        json::object& out) const noexcept(false) -> void
+    {
+        const auto status = sync_.status();
+        const auto convert = [](const auto& progress) {
+            auto output = json::object{};
+            output["chain"] = progress.chain_;
+            output["progress"] = progress.current_;
+            output["target"] = progress.target_;
+            output["rate"] = progress.rate_;
+            output["eta"] = progress.eta_;
+
+            return output;
+        };
+        auto chains = json::array{};
+        chains.reserve(status.chains_.size());
+
+        for (const auto& progress : status.chains_) {
+            auto chain = convert(progress);
+            chain["account"] = progress.account_;
+            chains.emplace_back(std::move(chain));
+        }
+
+        out.emplace("total", convert(status.total_));
+        out.emplace("chains", std::move(chains));
+    }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+RPCExtension::RPCExtension(
+    const ot::api::Context& ot,
+    const RefreshScheduler& refresh,
+    const Locks& locks,
+    const SyncMonitor& sync) noexcept
+    : imp_(std::make_unique<Imp>(ot, refresh, locks, sync))
+{
+}
+
+auto RPCExtension::IsReadOnly(const std::string_view method) noexcept -> bool
+{
+    const auto& map = Imp::methods();
+    const auto it = map.find(method);
+
+    if (map.end() == it) { return true; }
+
+    return it->second.read_only_;
+}
+
+auto RPCExtension::process(
+    const std::string_view method,
+    const std::string_view params) const noexcept -> std::string
+{
+    return imp_->process(method, params);
+}
+
+RPCExtension::~RPCExtension() = default;
+}  // namespace metier
@@ -0,0 +1,56 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace opentxs
+{
+namespace api
+{
+class Context;
+}  // namespace api
+}  // namespace opentxs
+
+namespace metier
+{
+class Locks;
+class RefreshScheduler;
+class SyncMonitor;
+}  // namespace metier
+
+namespace metier
+{
+class RPCExtension
+{
+public:
+    static auto IsReadOnly(const std::string_view method) noexcept -> bool;
+
+    auto process(const std::string_view method, const std::string_view params)
+        const noexcept -> std::string;
+
+    RPCExtension(
+        const opentxs::api::Context& ot,
+        const RefreshScheduler& refresh,
+        const Locks& locks,
+        const SyncMonitor& sync) noexcept;
+
+    ~RPCExtension();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    RPCExtension() = delete;
+    RPCExtension(const RPCExtension&) = delete;
+    RPCExtension(RPCExtension&&) = delete;
+    auto operator=(const RPCExtension&) -> RPCExtension& = delete;
+    auto operator=(RPCExtension&&) -> RPCExtension& = delete;
+};
+}  // namespace metier
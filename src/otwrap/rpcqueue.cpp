@@ -0,0 +1,137 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/rpcqueue.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include "otwrap/workqueue.hpp"
+
+namespace metier
+{
+// NOTE admission control on top of a WorkQueue. A job is only handed to the
+// workers once its class is below its concurrency limit.
+struct RPCQueue::Imp {
+    using Lock = std::lock_guard<std::mutex>;
+    using Item = std::pair<Kind, Job>;
+
+    auto push(const Kind kind, Job&& job) noexcept -> bool
+    {
+        auto lock = Lock{lock_};
+
+        if (stopped_) { return false; }
+        if (waiting_.size() >= config_.queue_limit_) { return false; }
+
+        waiting_.emplace_back(kind, std::move(job));
+        dispatch();
+
+        return true;
+    }
+    auto stop() noexcept -> void
+    {
+        {
+            auto lock = Lock{lock_};
+            stopped_ = true;
+            waiting_.clear();
+        }
+
+        workers_.stop();
+    }
+
+    Imp(const Config& config) noexcept
+        : config_([&] {
+            auto out = config;
+            out.workers_ = std::max<std::size_t>(out.workers_, 1u);
+            out.read_limit_ = std::max<std::size_t>(out.read_limit_, 1u);
+            out.write_limit_ = std::max<std::size_t>(out.write_limit_, 1u);
+
+            return out;
+        }())
+        , lock_()
+        , stopped_(false)
+        , running_read_(0)
+        , running_write_(0)
+        , waiting_()
+        , workers_(config_.workers_)
+    {
+    }
+
+    ~Imp() { stop(); }
+
+private:
+    const Config config_;
+    std::mutex lock_;
+    bool stopped_;
+    std::size_t running_read_;
+    std::size_t running_write_;
+    std::deque<Item> waiting_;
+    WorkQueue workers_;
+
+    auto running(const Kind kind) noexcept -> std::size_t&
+    {
+        return (Kind::read == kind) ? running_read_ : running_write_;
+    }
+    auto limit(const Kind kind) const noexcept -> std::size_t
+    {
+        return (Kind::read == kind) ? config_.read_limit_
+                                    : config_.write_limit_;
+    }
+    // NOTE the oldest job whose class is below its concurrency limit runs
+    // next, so a backlog of mutating commands never stalls read-only queries.
+    // Only called with lock_ held.
+    auto dispatch() noexcept -> void
+    {
+        if (stopped_) { return; }
+
+        for (auto it = next(); waiting_.end() != it; it = next()) {
+            auto item = std::move(*it);
+            waiting_.erase(it);
+            const auto kind = item.first;
+            ++running(kind);
+            workers_.push([this, kind, job = std::move(item.second)] {
+                try {
+                    job();
+                } catch (...) {
+                }
+
+                // NOTE a finished job may unblock a queued job of either class
+                auto lock = Lock{lock_};
+                --running(kind);
+                dispatch();
+            });
+        }
+    }
+    auto next() noexcept -> std::deque<Item>::iterator
+    {
+        return std::find_if(
+            waiting_.begin(), waiting_.end(), [&](const auto& i) {
+                return running(i.first) < limit(i.first);
+            });
+    }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+RPCQueue::RPCQueue(const Config& config) noexcept
+    : imp_(std::make_unique<Imp>(config))
+{
+}
+
+auto RPCQueue::push(const Kind kind, Job&& job) const noexcept -> bool
+{
+    return imp_->push(kind, std::move(job));
+}
+
+auto RPCQueue::stop() noexcept -> void { imp_->stop(); }
+
+RPCQueue::~RPCQueue() = default;
+}  // namespace metier
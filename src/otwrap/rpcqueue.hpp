@@ -0,0 +1,49 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace metier
+{
+class RPCQueue
+{
+public:
+    using Job = std::function<void()>;
+
+    enum class Kind {
+        read,
+        write,
+    };
+
+    struct Config {
+        std::size_t queue_limit_{256};
+        std::size_t workers_{4};
+        std::size_t read_limit_{4};
+        std::size_t write_limit_{1};
+    };
+
+    auto push(const Kind kind, Job&& job) const noexcept -> bool;
+    auto stop() noexcept -> void;
+
+    RPCQueue(const Config& config) noexcept;
+
+    ~RPCQueue();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    RPCQueue() = delete;
+    RPCQueue(const RPCQueue&) = delete;
+    RPCQueue(RPCQueue&&) = delete;
+    auto operator=(const RPCQueue&) -> RPCQueue& = delete;
+    auto operator=(RPCQueue&&) -> RPCQueue& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,240 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/syncmonitor.hpp"  // IWYU pragma: associated
+
+#include <opentxs/opentxs.hpp>
+#include <QObject>
+#include <QTimer>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace metier
+{
+struct SyncMonitor::Imp {
+    using Clock = std::chrono::steady_clock;
+    using Lock = std::lock_guard<std::mutex>;
+    using Model = opentxs::ui::AccountActivityQt;
+
+    // NOTE weight of the newest frame in the smoothed rate
+    static constexpr auto smoothing_ = 0.2;
+
+    auto status() const noexcept -> Status
+    {
+        auto lock = Lock{lock_};
+
+        return make_status();
+    }
+    // NOTE only called on the Qt thread. A chain which does not know its
+    // target yet has nothing to report so it does not start the timer.
+    auto update(const int chain, const int current, const int target) noexcept
+        -> void
+    {
+        {
+            auto lock = Lock{lock_};
+            auto& state = chains_[chain];
+            state.current_ = current;
+            state.target_ = target;
+            state.changed_ = true;
+            dirty_ = true;
+        }
+
+        if (0 < target) { start(); }
+    }
+    // NOTE connections use context_ as their receiver so updates are always
+    // handled on the Qt thread and stop when the monitor is destroyed
+    auto watch(const int chain, const std::string& account, Model* model)
+        noexcept -> void
+    {
+        if (nullptr == model) { return; }
+
+        {
+            auto lock = Lock{lock_};
+
+            if (false == watched_.emplace(model).second) { return; }
+
+            chains_[chain].account_ = account;
+        }
+
+        QObject::connect(
+            model,
+            &Model::syncProgressUpdated,
+            &context_,
+            [=](int value, int max) { update(chain, value, max); });
+    }
+
+    Imp(Callback&& publish) noexcept
+        : publish_(std::move(publish))
+        , lock_()
+        , context_()
+        , watched_()
+        , chains_()
+        , dirty_(false)
+        , last_frame_(Clock::now())
+        , timer_()
+    {
+        timer_.setInterval(frame_interval_);
+        QObject::connect(&timer_, &QTimer::timeout, [this] { frame(); });
+    }
+
+private:
+    struct State {
+        std::string account_{};
+        int current_{0};
+        int target_{0};
+        int previous_{-1};
+        double rate_{0.0};
+        bool changed_{false};
+    };
+
+    const Callback publish_;
+    mutable std::mutex lock_;
+    QObject context_;
+    std::set<const Model*> watched_;
+    std::map<int, State> chains_;
+    bool dirty_;
+    Clock::time_point last_frame_;
+    QTimer timer_;
+
+    // NOTE a chain is idle once it is caught up or while its target is still
+    // unknown
+    static auto idle(const State& state) noexcept -> bool
+    {
+        return (0 >= state.target_) || (state.current_ >= state.target_);
+    }
+    static auto eta(const State& state) noexcept -> std::int64_t
+    {
+        const auto remaining = state.target_ - state.current_;
+
+        if ((0 < state.target_) && (0 >= remaining)) { return 0; }
+        if (0.0 >= state.rate_) { return -1; }
+
+        return static_cast<std::int64_t>(remaining / state.rate_);
+    }
+
+    // NOTE only called on the Qt thread. The timer stops once every watched
+    // chain is idle and restarts with the next update that has a target.
+    auto frame() noexcept -> void
+    {
+        auto status = Status{};
+        auto publish{false};
+        auto stop{false};
+
+        {
+            auto lock = Lock{lock_};
+            const auto now = Clock::now();
+            const auto elapsed =
+                std::chrono::duration<double>{now - last_frame_}.count();
+            last_frame_ = now;
+
+            if (0.0 < elapsed) {
+                for (auto& [chain, state] : chains_) {
+                    if (idle(state)) {
+                        state.rate_ = 0.0;
+                    } else if (
+                        (0 <= state.previous_) &&
+                        (state.current_ >= state.previous_)) {
+                        const auto rate =
+                            (state.current_ - state.previous_) / elapsed;
+                        state.rate_ =
+                            (smoothing_ * rate) +
+                            ((1.0 - smoothing_) * state.rate_);
+                    }
+
+                    state.previous_ = state.current_;
+                }
+            }
+
+            stop = std::all_of(
+                chains_.begin(), chains_.end(), [](const auto& item) {
+                    return idle(item.second);
+                });
+
+            if (dirty_) {
+                dirty_ = false;
+                publish = true;
+                status = make_status();
+
+                for (auto& [chain, state] : chains_) {
+                    state.changed_ = false;
+                }
+            }
+        }
+
+        if (publish) { publish_(status); }
+
+        if (stop) { timer_.stop(); }
+    }
+    // NOTE only called on the Qt thread. Progress made while the timer was
+    // stopped is not counted in the rate.
+    auto start() noexcept -> void
+    {
+        if (timer_.isActive()) { return; }
+
+        {
+            auto lock = Lock{lock_};
+            last_frame_ = Clock::now();
+
+            for (auto& [chain, state] : chains_) { state.previous_ = -1; }
+        }
+
+        timer_.start();
+    }
+    auto make_status() const noexcept -> Status
+    {
+        auto output = Status{};
+        auto& total = output.total_;
+        auto unknown{false};
+        output.chains_.reserve(chains_.size());
+
+        for (const auto& [chain, state] : chains_) {
+            auto& progress = output.chains_.emplace_back();
+            progress.chain_ = chain;
+            progress.account_ = state.account_;
+            progress.current_ = state.current_;
+            progress.target_ = state.target_;
+            progress.rate_ = state.rate_;
+            progress.eta_ = eta(state);
+            progress.changed_ = state.changed_;
+            total.current_ += state.current_;
+            total.target_ += state.target_;
+            total.rate_ += state.rate_;
+            total.changed_ |= state.changed_;
+            unknown |= (0 > progress.eta_);
+            // NOTE chains download in parallel so the slowest one decides
+            total.eta_ = std::max(total.eta_, progress.eta_);
+        }
+
+        if (unknown) { total.eta_ = -1; }
+
+        return output;
+    }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+SyncMonitor::SyncMonitor(Callback&& publish) noexcept
+    : imp_(std::make_unique<Imp>(std::move(publish)))
+{
+}
+
+auto SyncMonitor::status() const noexcept -> Status { return imp_->status(); }
+
+auto SyncMonitor::watch(
+    const int chain,
+    const std::string& account,
+    opentxs::ui::AccountActivityQt* model) const noexcept -> void
+{
+    imp_->watch(chain, account, model);
+}
+
+SyncMonitor::~SyncMonitor() = default;
+}  // namespace metier
@@ -0,0 +1,78 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+namespace ui
+{
+class AccountActivityQt;
+}  // namespace ui
+}  // namespace opentxs
+
+namespace metier
+{
+// NOTE collects sync progress from every watched account activity model and
+// publishes it at a fixed frame rate no matter how often the models report.
+// Each frame also carries the total for all chains, a smoothed download rate
+// in blocks per second and an estimate of the seconds remaining. The frame
+// timer only runs while a watched chain with a known target is not caught
+// up. Must be constructed on the Qt thread; every other function may be called
+// from any thread.
+class SyncMonitor
+{
+public:
+    struct Progress {
+        int chain_{0};
+        std::string account_{};
+        int current_{0};
+        int target_{0};
+        double rate_{0.0};
+        // NOTE -1 if unknown
+        std::int64_t eta_{-1};
+        bool changed_{false};
+    };
+    // NOTE the total uses chain 0, which is blockchain::Type::Unknown
+    struct Status {
+        Progress total_{};
+        std::vector<Progress> chains_{};
+    };
+
+    using Callback = std::function<void(const Status&)>;
+
+    static constexpr auto frame_interval_ = std::chrono::milliseconds{250};
+
+    auto status() const noexcept -> Status;
+    auto watch(
+        const int chain,
+        const std::string& account,
+        opentxs::ui::AccountActivityQt* model) const noexcept -> void;
+
+    // NOTE publish is called on the Qt thread once per frame in which at
+    // least one chain reported progress
+    SyncMonitor(Callback&& publish) noexcept;
+
+    ~SyncMonitor();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    SyncMonitor() = delete;
+    SyncMonitor(const SyncMonitor&) = delete;
+    SyncMonitor(SyncMonitor&&) = delete;
+    auto operator=(const SyncMonitor&) -> SyncMonitor& = delete;
+    auto operator=(SyncMonitor&&) -> SyncMonitor& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,125 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otwrap/workqueue.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace metier
+{
+struct WorkQueue::Imp {
+    using Lock = std::unique_lock<std::mutex>;
+
+    auto push(Job&& job) noexcept -> bool
+    {
+        {
+            auto lock = Lock{lock_};
+
+            if (stopped_) { return false; }
+            if ((0u < limit_) && (queue_.size() >= limit_)) { return false; }
+
+            queue_.emplace_back(std::move(job));
+        }
+
+        cv_.notify_one();
+
+        return true;
+    }
+    auto stop() noexcept -> void
+    {
+        {
+            auto lock = Lock{lock_};
+
+            if (stopped_) { return; }
+
+            stopped_ = true;
+            queue_.clear();
+        }
+
+        cv_.notify_all();
+
+        for (auto& thread : workers_) {
+            if (thread.joinable()) { thread.join(); }
+        }
+    }
+
+    Imp(const std::size_t workers, const std::size_t limit) noexcept
+        : limit_(limit)
+        , lock_()
+        , cv_()
+        , stopped_(false)
+        , queue_()
+        , workers_()
+    {
+        const auto count = std::max<std::size_t>(workers, 1u);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    ~Imp() { stop(); }
+
+private:
+    const std::size_t limit_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    bool stopped_;
+    std::deque<Job> queue_;
+    std::vector<std::thread> workers_;
+
+    auto run() noexcept -> void
+    {
+        auto lock = Lock{lock_};
+
+        for (;;) {
+            cv_.wait(lock, [&] {
+                return stopped_ || (false == queue_.empty());
+            });
+
+            if (stopped_) { return; }
+
+            auto job = std::move(queue_.front());
+            queue_.pop_front();
+            lock.unlock();
+
+            try {
+                job();
+            } catch (...) {
+            }
+
+            lock.lock();
+        }
+    }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+WorkQueue::WorkQueue(
+    const std::size_t workers,
+    const std::size_t limit) noexcept
+    : imp_(std::make_unique<Imp>(workers, limit))
+{
+}
+
+auto WorkQueue::push(Job&& job) const noexcept -> bool
+{
+    return imp_->push(std::move(job));
+}
+
+auto WorkQueue::stop() noexcept -> void { imp_->stop(); }
+
+WorkQueue::~WorkQueue() = default;
+}  // namespace metier
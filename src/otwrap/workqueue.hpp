@@ -0,0 +1,44 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace metier
+{
+// NOTE runs jobs on a fixed number of worker threads in the order they were
+// pushed. A queue with a single worker never runs two jobs at the same time.
+class WorkQueue
+{
+public:
+    using Job = std::function<void()>;
+
+    // NOTE fails if the queue has been stopped or already holds limit jobs
+    // which have not started yet
+    auto push(Job&& job) const noexcept -> bool;
+    // NOTE discards every job which has not started and waits for the running
+    // ones to finish
+    auto stop() noexcept -> void;
+
+    // NOTE a limit of zero does not limit the number of queued jobs
+    WorkQueue(const std::size_t workers, const std::size_t limit = 0) noexcept;
+
+    ~WorkQueue();
+
+private:
+    struct Imp;
+
+    std::unique_ptr<Imp> imp_;
+
+    WorkQueue() = delete;
+    WorkQueue(const WorkQueue&) = delete;
+    WorkQueue(WorkQueue&&) = delete;
+    auto operator=(const WorkQueue&) -> WorkQueue& = delete;
+    auto operator=(WorkQueue&&) -> WorkQueue& = delete;
+};
+}  // namespace metier
@@ -0,0 +1,8 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// NOTE the Boost.JSON implementation is compiled exactly once here and shared
+// by every target which links metier-rpc
+#include <boost/json/src.hpp>
@@ -0,0 +1,40 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// NOTE a message with a single body frame is an opentxs rpc command. Metier
+// extension commands use two body frames: the method name followed by a json
+// object holding the parameters. The reply to an extension command is a
+// single json object which contains an "error" member if the command failed.
+//
+// The event endpoint publishes two frame messages: the event name, which is
+// also the subscription topic, followed by a json object.
+namespace metier::rpc
+{
+constexpr auto extension_frames_{2u};
+
+constexpr auto method_accounts_{"accounts"};
+constexpr auto method_activity_{"activity"};
+constexpr auto method_lock_stats_{"lock_stats"};
+constexpr auto method_nyms_{"nyms"};
+constexpr auto method_refresh_status_{"refresh_status"};
+constexpr auto method_send_payment_{"send_payment"};
+constexpr auto method_sync_status_{"sync_status"};
+
+constexpr auto event_activity_{"activity"};
+constexpr auto event_balance_{"balance"};
+constexpr auto event_send_{"send"};
+constexpr auto event_sync_{"sync"};
+
+constexpr auto param_account_{"account"};
+constexpr auto param_amount_{"amount"};
+constexpr auto param_cursor_{"cursor"};
+constexpr auto param_from_{"from"};
+constexpr auto param_limit_{"limit"};
+constexpr auto param_session_{"session"};
+constexpr auto param_since_{"since"};
+constexpr auto param_to_{"to"};
+}  // namespace metier::rpc
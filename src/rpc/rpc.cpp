@@ -10,7 +10,8 @@
 
 namespace metier
 {
-auto rpc_endpoint() noexcept -> std::string
+auto ipc_endpoint(const std::string& filename) noexcept -> std::string;
+auto ipc_endpoint(const std::string& filename) noexcept -> std::string
 {
     auto base =
         QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation);
@@ -21,9 +22,17 @@ auto rpc_endpoint() noexcept -> std::string
         qFatal("Failed to create RPC socket folder");
     }
 
-    const auto filename = std::string{METIER_APP_NAME} + ".sock";
-
     return std::string{"ipc://"} +
            QDir{absolute}.filePath(filename.c_str()).toStdString();
 }
+
+auto rpc_endpoint() noexcept -> std::string
+{
+    return ipc_endpoint(std::string{METIER_APP_NAME} + ".sock");
+}
+
+auto rpc_event_endpoint() noexcept -> std::string
+{
+    return ipc_endpoint(std::string{METIER_APP_NAME} + ".events.sock");
+}
 }  // namespace metier
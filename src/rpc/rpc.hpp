@@ -10,4 +10,5 @@
 namespace metier
 {
 auto rpc_endpoint() noexcept -> std::string;
+auto rpc_event_endpoint() noexcept -> std::string;
 }  // namespace metier
@@ -0,0 +1,132 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "profiler.hpp"  // IWYU pragma: associated
+
+#include <QDebug>
+#include <QString>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace metier::util
+{
+namespace
+{
+struct Event {
+    const char* name_;
+    Profiler::Clock::time_point start_;
+    Profiler::Clock::time_point end_;
+    int thread_;
+};
+
+struct Trace {
+    std::atomic_bool enabled_{false};
+    std::mutex lock_{};
+    std::string path_{};
+    Profiler::Clock::time_point origin_{};
+    std::vector<Event> events_{};
+    std::map<std::thread::id, int> threads_{};
+};
+
+auto trace() noexcept -> Trace&
+{
+    static auto output = Trace{};
+
+    return output;
+}
+
+auto micros(
+    const Profiler::Clock::time_point from,
+    const Profiler::Clock::time_point to) noexcept -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from)
+        .count();
+}
+}  // namespace
+
+Profiler::Span::Span(const char* name) noexcept
+    : name_(name)
+    , start_(Enabled() ? Clock::now() : Clock::time_point{})
+{
+}
+
+auto Profiler::Enabled() noexcept -> bool { return trace().enabled_; }
+
+auto Profiler::Finish() noexcept -> void
+{
+    auto& data = trace();
+
+    if (false == data.enabled_.exchange(false)) { return; }
+
+    const auto end = Clock::now();
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+    auto file = std::ofstream{data.path_, std::ios::out | std::ios::trunc};
+
+    if (false == file.good()) {
+        qWarning() << QString("Unable to write startup profile to %1")
+                          .arg(data.path_.c_str());
+
+        return;
+    }
+
+    const auto write = [&](const char* name, const auto& from, const auto& to,
+                           const int thread) {
+        file << R"({"name":")" << name << R"(","cat":"startup","ph":"X")"
+             << R"(,"ts":)" << micros(data.origin_, from) << R"(,"dur":)"
+             << micros(from, to) << R"(,"pid":1,"tid":)" << thread << '}';
+    };
+
+    file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+    write("startup", data.origin_, end, 0);
+
+    for (const auto& event : data.events_) {
+        file << ',';
+        write(event.name_, event.start_, event.end_, event.thread_);
+    }
+
+    file << "]}\n";
+    qInfo() << QString("Startup profile written to %1")
+                   .arg(data.path_.c_str());
+}
+
+auto Profiler::Record(
+    const char* name,
+    const Clock::time_point start,
+    const Clock::time_point end) noexcept -> void
+{
+    auto& data = trace();
+
+    if (false == data.enabled_) { return; }
+
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+    const auto [it, added] = data.threads_.try_emplace(
+        std::this_thread::get_id(), static_cast<int>(data.threads_.size()));
+    data.events_.push_back({name, start, end, it->second});
+}
+
+auto Profiler::Start(const std::string& path) noexcept -> void
+{
+    auto& data = trace();
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+    data.path_ = path;
+    data.origin_ = Clock::now();
+    data.events_.clear();
+    data.threads_.clear();
+    data.threads_.try_emplace(std::this_thread::get_id(), 0);
+    data.enabled_ = true;
+}
+
+Profiler::Span::~Span()
+{
+    if (Clock::time_point{} == start_) { return; }
+
+    Record(name_, start_, Clock::now());
+}
+}  // namespace metier::util
@@ -0,0 +1,59 @@
+// Copyright (c) 2019-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace metier::util
+{
+// NOTE records named spans of startup work and writes them as a Chrome trace
+// (also readable by Perfetto) once startup is complete. Every function is a
+// cheap no-op unless Start has been called.
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Span
+    {
+    public:
+        Span(const char* name) noexcept;
+
+        ~Span();
+
+    private:
+        const char* name_;
+        const Clock::time_point start_;
+
+        Span() = delete;
+        Span(const Span&) = delete;
+        Span(Span&&) = delete;
+        auto operator=(const Span&) -> Span& = delete;
+        auto operator=(Span&&) -> Span& = delete;
+    };
+
+    static auto Enabled() noexcept -> bool;
+    // NOTE writes the trace file and disables further recording
+    static auto Finish() noexcept -> void;
+    template <typename Function>
+    static auto Measure(const char* name, Function&& function)
+        -> decltype(auto)
+    {
+        const auto span = Span{name};
+
+        return function();
+    }
+    static auto Record(
+        const char* name,
+        const Clock::time_point start,
+        const Clock::time_point end) noexcept -> void;
+    static auto Start(const std::string& path) noexcept -> void;
+
+private:
+    Profiler() = delete;
+};
+}  // namespace metier::util
@@ -40,17 +40,34 @@ MainWindow::MainWindow(QObject* parent, OTWrap& ot) noexcept
     auto* quit = imp_.ui_->action_file_quit;
     auto* bc = imp_.ui_->action_settings_blockchain;
     auto* words = imp_.ui_->action_settings_recovery_phrase;
-    auto* bcdone = imp_.blockchains_->Ok();
     auto* license = imp_.ui_->action_help_opensource;
     auto* toolbox = imp_.ui_->moneyToolbox;
     auto* prog = imp_.ui_->syncProgress;
     connect(&ot, &OTWrap::nymReady, this, &MainWindow::initModels);
     connect(&ot, &OTWrap::readyForMainWindow, this, &MainWindow::updateToolbox);
     connect(&ot, &OTWrap::chainsChanged, this, &MainWindow::updateToolbox);
+    connect(
+        &ot,
+        &OTWrap::accountActivityModelReady,
+        this,
+        [this](int chain, OTWrap::AccountActivity* model) {
+            imp_.receiveAccountActivity(chain, model);
+        });
+    connect(
+        &ot,
+        &OTWrap::syncProgressChanged,
+        this,
+        [this](int chain, int current, int target, double rate, int eta) {
+            imp_.updateSyncProgress(chain, {current, target, rate, eta});
+        });
+    connect(&ot, &OTWrap::jobStarted, this, [this](int job) {
+        updateJobProgress(job, 0, 0);
+    });
+    connect(&ot, &OTWrap::jobProgress, this, &MainWindow::updateJobProgress);
+    connect(&ot, &OTWrap::jobFinished, this, &MainWindow::finishJob);
     connect(quit, &QAction::triggered, this, &MainWindow::exit);
     connect(bc, &QAction::triggered, this, &MainWindow::showBlockchainChooser);
     connect(words, &QAction::triggered, this, &MainWindow::showRecoveryWords);
-    connect(bcdone, &QPushButton::clicked, &ot, &OTWrap::checkAccounts);
     connect(license, &QAction::triggered, this, &MainWindow::showLicenseViewer);
     connect(toolbox, &QToolBox::currentChanged, this, &MainWindow::changeChain);
     connect(this, &MainWindow::progMaxUpdated, prog, &QProgressBar::setMaximum);
@@ -121,6 +138,11 @@ auto MainWindow::contactListUpdated(
 
 auto MainWindow::exit() -> void { QCoreApplication::exit(); }
 
+auto MainWindow::finishJob(int job, bool success) -> void
+{
+    imp_.finishJob(job, success);
+}
+
 auto MainWindow::initModels() -> void { imp_.init_models(this); }
 
 auto MainWindow::sendMessage() -> void
@@ -151,14 +173,12 @@ auto MainWindow::showAddContact() -> void { imp_.showAddContact(); }
 
 auto MainWindow::showAccountActivity(int chain) -> void
 {
-    auto& accountActivity = *imp_.ui_->accountActivity;
-    accountActivity.setModel(imp_.ot_.accountActivityModel(chain));
+    imp_.showAccountActivity(chain);
 }
 
 auto MainWindow::showAccountActivity(QString account) -> void
 {
-    auto& accountActivity = *imp_.ui_->accountActivity;
-    accountActivity.setModel(imp_.ot_.accountActivityModel(account));
+    imp_.showAccountActivity(imp_.ot_.accountActivityModel(account));
 }
 
 auto MainWindow::showActivityThread(QString contact) -> void
@@ -195,18 +215,17 @@ auto MainWindow::showActivityThread(QString contact) -> void
 
 auto MainWindow::showBlockchainChooser() -> void
 {
-    util::Focuser(imp_.blockchains_.get()).show();
+    util::Focuser(&imp_.blockchains()).show();
 }
 
 auto MainWindow::showBlockchainStatistics() -> void
 {
-    auto& accountActivity = *imp_.ui_->accountActivity;
-    accountActivity.setModel(imp_.ot_.blockchainStatisticsModel());
+    imp_.showAccountActivity(imp_.ot_.blockchainStatisticsModel());
 }
 
 auto MainWindow::showLicenseViewer() -> void
 {
-    util::Focuser(imp_.licenses_.get()).show();
+    util::Focuser(&imp_.licenses()).show();
 }
 
 auto MainWindow::showRecoveryWords() -> void
@@ -229,6 +248,11 @@ auto MainWindow::changeChain() -> void
     imp_.updateProgress();
 }
 
+auto MainWindow::updateJobProgress(int job, int done, int total) -> void
+{
+    imp_.updateJobProgress(job, done, total);
+}
+
 auto MainWindow::updateName(QString value) -> void { imp_.updateName(value); }
 
 auto MainWindow::updatePaymentCode(QString value) -> void
@@ -29,6 +29,7 @@ signals:
     void progValueUpdated(int);
 
 public slots:
+    void initModels();
     void setProgressMax(int);
     void setProgressValue(int);
 
@@ -42,7 +43,7 @@ private slots:
         const QItemSelection& current,
         const QItemSelection& previous);
     void exit();
-    void initModels();
+    void finishJob(int job, bool success);
     void sendMessage();
     void showAddContact();
     void showAccountActivity(int chain);
@@ -53,6 +54,7 @@ private slots:
     void showLicenseViewer();
     void showRecoveryWords();
     void changeChain();
+    void updateJobProgress(int job, int done, int total);
     void updateToolbox();
     void updateName(QString value);
     void updatePaymentCode(QString value);
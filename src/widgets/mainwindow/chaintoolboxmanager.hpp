@@ -8,10 +8,12 @@
 #include "widgets/mainwindow.hpp"  // IWYU pragma: associated
 
 #include <opentxs/opentxs.hpp>
+#include <QStatusBar>
 #include <QTableView>
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <tuple>
 
 #include "otwrap.hpp"
@@ -123,6 +125,39 @@ struct ChainToolboxManager {
         }
     }
 
+    // NOTE completes a send or receive request once the account activity
+    // model for the chain is available
+    auto receive(const int chain, OTWrap::AccountActivity* model) noexcept
+        -> void
+    {
+        auto action = Action{};
+
+        {
+            ot::rLock lock{lock_};
+            auto it = pending_.find(chain);
+
+            if (pending_.end() == it) { return; }
+
+            action = it->second;
+            pending_.erase(it);
+        }
+
+        parent_->statusBar()->clearMessage();
+
+        if (nullptr == model) { return; }
+
+        switch (action) {
+            case Action::receive: {
+                show_receiving(*model);
+            } break;
+            case Action::send: {
+                show_send(*model);
+            } break;
+            default: {
+            }
+        }
+    }
+
     ChainToolboxManager(
         QMainWindow* parent,
         OTWrap& ot,
@@ -136,11 +171,17 @@ struct ChainToolboxManager {
         , account_list_(accountList)
         , toolbox_(toolbox)
         , items_({dummyIndex})  // NOTE: dummy index represents overview tab
+        , pending_()
     {
         assert(progress);
     }
 
 private:
+    enum class Action {
+        receive,
+        send,
+    };
+
     QMainWindow* parent_;
     mutable std::recursive_mutex lock_;
     const RegisterProgress progress_cb_;
@@ -148,6 +189,7 @@ private:
     AccountList& account_list_;
     ToolBox& toolbox_;
     std::vector<int> items_;
+    std::map<int, Action> pending_;
 
     auto create_tab(const int position, const int chain) noexcept -> void
     {
@@ -198,13 +240,14 @@ private:
         receive->setText(
             QCoreApplication::translate("MainWindow", "Receive", nullptr));
         receive->connect(receive.get(), &QPushButton::clicked, [=]() {
-            show_receiving(chain);
+            request(chain, Action::receive);
         });
         send->setObjectName(QString::fromUtf8(sendName.c_str()));
         send->setText(
             QCoreApplication::translate("MainWindow", "Send", nullptr));
-        send->connect(
-            send.get(), &QPushButton::clicked, [=]() { show_send(chain); });
+        send->connect(send.get(), &QPushButton::clicked, [=]() {
+            request(chain, Action::send);
+        });
         details->setObjectName(QString::fromUtf8(detailsName.c_str()));
         details->setText(
             QCoreApplication::translate("MainWindow", "Details", nullptr));
@@ -229,27 +272,33 @@ private:
         }};
         dialog->exec();
     }
-    auto show_receiving(const ot::blockchain::Type chain) noexcept -> void
+    auto request(const ot::blockchain::Type chain, const Action action) noexcept
+        -> void
     {
-        auto* model = ot_.accountActivityModel(static_cast<int>(chain));
-
-        if (nullptr == model) { return; }
+        {
+            ot::rLock lock{lock_};
+            pending_[static_cast<int>(chain)] = action;
+        }
 
+        parent_->statusBar()->showMessage(
+            QString("Loading %1 account")
+                .arg(QString::fromStdString(
+                    ot::blockchain::DisplayString(chain))));
+        ot_.requestAccountActivityModel(static_cast<int>(chain));
+    }
+    auto show_receiving(OTWrap::AccountActivity& model) noexcept -> void
+    {
         auto dialog = std::make_unique<ReceivingAddress>(
-            parent_, model->getDepositAddress());
+            parent_, model.getDepositAddress());
         auto postcondition = ScopeGuard{[&dialog]() {
             dialog->deleteLater();
             dialog.release();
         }};
         dialog->exec();
     }
-    auto show_send(const ot::blockchain::Type chain) noexcept -> void
+    auto show_send(OTWrap::AccountActivity& model) noexcept -> void
     {
-        auto* model = ot_.accountActivityModel(static_cast<int>(chain));
-
-        if (nullptr == model) { return; }
-
-        auto dialog = std::make_unique<BlockchainSend>(parent_, model);
+        auto dialog = std::make_unique<BlockchainSend>(parent_, &model);
         auto postcondition = ScopeGuard{[&dialog]() {
             dialog->deleteLater();
             dialog.release();
@@ -8,14 +8,20 @@
 #include "widgets/mainwindow.hpp"  // IWYU pragma: associated
 
 #include <opentxs/opentxs.hpp>
+#include <QCoreApplication>
+#include <QProgressBar>
+#include <QStandardItemModel>
+#include <QStatusBar>
 #include <deque>
 #include <iostream>
+#include <optional>
 #include <set>
 #include <tuple>
 
 #include "models/accountlist.hpp"
 #include "otwrap.hpp"
 #include "ui_mainwindow.h"
+#include "util/convertblockchain.hpp"
 #include "util/resizer.hpp"
 #include "util/scopeguard.hpp"
 #include "widgets/addcontact.hpp"
@@ -34,7 +40,9 @@ struct MainWindow::Imp {
     std::unique_ptr<Ui::MainWindow> ui_;
     std::unique_ptr<widget::BlockchainChooser> blockchains_;
     std::unique_ptr<widget::Licenses> licenses_;
-    std::set<std::uintptr_t> registered_chains_;
+    QProgressBar* job_progress_;
+    QStandardItemModel loading_;
+    std::optional<int> pending_activity_;
     SyncProgress sync_progress_;
     ChainToolboxManager chain_toolbox_;
 
@@ -78,6 +86,61 @@ struct MainWindow::Imp {
         updatePaymentCode(profile->paymentCode());
         updateProgress();
     }
+    auto blockchains() noexcept -> widget::BlockchainChooser&
+    {
+        if (!blockchains_) {
+            blockchains_ =
+                std::make_unique<widget::BlockchainChooser>(&parent_, ot_);
+            connect(
+                blockchains_->Ok(),
+                &QPushButton::clicked,
+                &ot_,
+                &OTWrap::checkAccounts);
+        }
+
+        return *blockchains_;
+    }
+    auto finishJob(const int job, const bool success) noexcept -> void
+    {
+        job_progress_->hide();
+
+        if (false == success) {
+            ui_->statusBar->showMessage(
+                QString("%1 failed").arg(job_name(job)), 5000);
+        }
+    }
+    auto licenses() noexcept -> widget::Licenses&
+    {
+        if (!licenses_) {
+            licenses_ = std::make_unique<widget::Licenses>(&parent_);
+        }
+
+        return *licenses_;
+    }
+    auto receiveAccountActivity(
+        const int chain,
+        OTWrap::AccountActivity* model) noexcept -> void
+    {
+        chain_toolbox_.receive(chain, model);
+
+        if (pending_activity_ == chain) {
+            pending_activity_.reset();
+            ui_->accountActivity->setModel(model);
+        }
+    }
+    // NOTE a placeholder is displayed until the model is ready. A result for
+    // a chain which is no longer selected is ignored.
+    auto showAccountActivity(const int chain) noexcept -> void
+    {
+        pending_activity_ = chain;
+        ui_->accountActivity->setModel(&loading_);
+        ot_.requestAccountActivityModel(chain);
+    }
+    auto showAccountActivity(QAbstractItemModel* model) noexcept -> void
+    {
+        pending_activity_.reset();
+        ui_->accountActivity->setModel(model);
+    }
     auto showAddContact() noexcept -> void
     {
         auto dialog = std::make_unique<AddContact>(&parent_, ot_);
@@ -87,6 +150,15 @@ struct MainWindow::Imp {
         }};
         dialog->exec();
     }
+    auto updateJobProgress(const int job, const int done, const int total)
+        -> void
+    {
+        auto& bar = *job_progress_;
+        bar.setFormat(job_name(job) + QString(": %v/%m"));
+        bar.setMaximum(total);
+        bar.setValue(done);
+        bar.show();
+    }
     auto updateName(QString value) noexcept -> void
     {
         auto& name = *ui_->profileName;
@@ -102,18 +174,33 @@ struct MainWindow::Imp {
     auto updateProgress() noexcept -> void
     {
         const auto chain = chain_toolbox_.currentChain();
-        const auto [current, max] = sync_progress_.get(chain);
-        parent_.setProgressMax(max);
-        parent_.setProgressValue(current);
+        const auto progress = sync_progress_.get(chain);
+        ui_->syncProgress->setFormat(progress_format(progress));
+        parent_.setProgressMax(progress.target_);
+        parent_.setProgressValue(progress.current_);
+    }
+    // NOTE OTWrap coalesces sync progress so this runs at most a few times
+    // per second
+    auto updateSyncProgress(
+        const int chain,
+        const SyncProgress::Progress& progress) noexcept -> void
+    {
+        sync_progress_.update(util::convert(chain), progress);
+
+        if (util::convert(chain) == chain_toolbox_.currentChain()) {
+            updateProgress();
+        }
     }
 
     Imp(MainWindow* parent, OTWrap& ot) noexcept
         : parent_(*parent)
         , ot_(ot)
         , ui_(std::make_unique<Ui::MainWindow>())
-        , blockchains_(std::make_unique<widget::BlockchainChooser>(parent, ot_))
-        , licenses_(std::make_unique<widget::Licenses>(parent))
-        , registered_chains_()
+        , blockchains_()
+        , licenses_()
+        , job_progress_(nullptr)
+        , loading_()
+        , pending_activity_()
         , sync_progress_()
         , chain_toolbox_(
               parent,
@@ -123,6 +210,14 @@ struct MainWindow::Imp {
               [this](const auto chain) { register_progress(chain); })
     {
         ui_->setupUi(parent);
+        // NOTE owned by the status bar and only visible while a background
+        // job is running
+        job_progress_ = new QProgressBar(ui_->statusBar);
+        job_progress_->setTextVisible(true);
+        job_progress_->hide();
+        ui_->statusBar->addPermanentWidget(job_progress_);
+        loading_.appendRow(new QStandardItem(
+            QCoreApplication::translate("MainWindow", "Loading", nullptr)));
         ui_->moneyToolbox->setMaximumWidth(util::line_width(
             *ui_->accountList, ot_.longestBlockchainName() + 16));
         {
@@ -166,31 +261,60 @@ struct MainWindow::Imp {
     auto operator=(Imp&&) -> Imp& = delete;
 
 private:
-    auto receive_progress_update(
-        const ot::blockchain::Type chain,
-        const int value,
-        const int max) noexcept
+    static auto duration(const int seconds) noexcept -> QString
     {
-        sync_progress_.update(chain, {value, max});
-        updateProgress();
+        if (3600 <= seconds) {
+            return QString("%1h %2m")
+                .arg(seconds / 3600)
+                .arg((seconds % 3600) / 60, 2, 10, QChar('0'));
+        } else if (60 <= seconds) {
+            return QString("%1m %2s")
+                .arg(seconds / 60)
+                .arg(seconds % 60, 2, 10, QChar('0'));
+        }
+
+        return QString("%1s").arg(seconds);
     }
-    auto register_progress(const ot::blockchain::Type chain) noexcept -> void
+    static auto job_name(const int job) noexcept -> QString
+    {
+        switch (static_cast<OTWrap::Job>(job)) {
+            case OTWrap::Job::checkAccounts: {
+                return "Checking accounts";
+            }
+            case OTWrap::Job::createNym: {
+                return "Creating identity";
+            }
+            case OTWrap::Job::importSeed: {
+                return "Importing seed";
+            }
+            default: {
+                return "Background job";
+            }
+        }
+    }
+    static auto progress_format(const SyncProgress::Progress& progress) noexcept
+        -> QString
     {
-        using Model = OTWrap::AccountActivity;
-        auto* model = ot_.accountActivityModel(static_cast<int>(chain));
+        auto output = QString("%p%");
 
-        assert(nullptr != model);
+        if ((progress.current_ >= progress.target_) ||
+            (0.0 >= progress.rate_)) {
+            return output;
+        }
+
+        output += QString(" (%1 blocks/s").arg(progress.rate_, 0, 'f', 1);
 
-        if (auto ptr = reinterpret_cast<std::uintptr_t>(model);
-            0 < registered_chains_.count(ptr)) {
-            return;
-        } else {
-            registered_chains_.emplace(ptr);
+        if (0 <= progress.eta_) {
+            output += QString(", %1 remaining").arg(duration(progress.eta_));
         }
 
-        connect(model, &Model::syncProgressUpdated, [=](int value, int max) {
-            receive_progress_update(chain, value, max);
-        });
+        return output + ')';
+    }
+    // NOTE requesting the model makes OTWrap start reporting sync progress
+    // for the chain, so the progress bar fills in before it is selected
+    auto register_progress(const ot::blockchain::Type chain) noexcept -> void
+    {
+        ot_.requestAccountActivityModel(static_cast<int>(chain));
     }
 };
 }  // namespace metier::widget
@@ -16,8 +16,14 @@ namespace ot = opentxs;
 
 namespace metier::widget
 {
+// NOTE blockchain::Type::Unknown holds the total for all chains
 struct SyncProgress {
-    using Progress = std::pair<int, int>;
+    struct Progress {
+        int current_{0};
+        int target_{0};
+        double rate_{0.0};
+        int eta_{-1};
+    };
 
     auto get(const ot::blockchain::Type chain) const noexcept -> Progress
     {